@@ -32,7 +32,7 @@ void adams() {
   //   for (int j=0; j<ny; j++) {
   //     for (int i=0; i<nx; i++) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  parallel_for( CrmBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     real dtdz = dtn/dz(icrm);
     real rhox = rho (k,icrm)*dtdx;
     real rhoy = rho (k,icrm)*dtdy;
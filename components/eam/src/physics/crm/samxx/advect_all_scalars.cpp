@@ -32,11 +32,11 @@ void advect_all_scalars() {
   if (use_ESMT) {
     // the esmt_offset simply ensures that the scalar momentum
     // tracers are positive definite during the advection calculation
-    parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       esmt_min(icrm) = min(min(u_esmt(k,j+offy_s,i+offx_s,icrm), v_esmt(k,j+offy_s,i+offx_s,icrm)), esmt_min(icrm));
     });
 
-    parallel_for( SimpleBounds<4>(nzm,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(nzm,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       esmt_offset(icrm)  = abs(esmt_min(icrm)) + 50.;
       u_esmt(k,j,i,icrm) = u_esmt(k,j,i,icrm) + esmt_offset(icrm);
       v_esmt(k,j,i,icrm) = v_esmt(k,j,i,icrm) + esmt_offset(icrm);
@@ -46,7 +46,7 @@ void advect_all_scalars() {
     advect_scalar(u_esmt,dummy,dummy);
     advect_scalar(v_esmt,dummy,dummy);
 
-    parallel_for( SimpleBounds<4>(nzm,dimy_s,dimx_s,ncrms), YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(nzm,dimy_s,dimx_s,ncrms), YAKL_LAMBDA (int k, int j, int i, int icrm) {
       u_esmt(k,j,i,icrm) = u_esmt(k,j,i,icrm) - esmt_offset(icrm);
       v_esmt(k,j,i,icrm) = v_esmt(k,j,i,icrm) - esmt_offset(icrm);
     });
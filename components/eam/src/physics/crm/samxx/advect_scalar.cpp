@@ -9,7 +9,7 @@ void advect_scalar(real4d &f, real2d &fadv, real2d &flux) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
   if (docolumn) {
 
-    parallel_for( SimpleBounds<2>(nz,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+    parallel_for( CrmBounds<2>(nz,ncrms) , YAKL_LAMBDA (int k, int icrm) {
       flux(k,icrm) = 0.0;
     });
 
@@ -19,7 +19,7 @@ void advect_scalar(real4d &f, real2d &fadv, real2d &flux) {
     //   for (int j=0; j<dimy_s; j++) {
     //     for (int i=0; i<dimx_s; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(nzm,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(nzm,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       f0(k,j,i,icrm) = f(k,j,i,icrm);
     });
 
@@ -31,7 +31,7 @@ void advect_scalar(real4d &f, real2d &fadv, real2d &flux) {
 
     // for (int k=0; k<nzm; k++) {
     //  for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+    parallel_for( CrmBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
       fadv(k,icrm)=0.0;
     });
     
@@ -39,7 +39,7 @@ void advect_scalar(real4d &f, real2d &fadv, real2d &flux) {
     //   for (int j=0; j<ny; j++) {
     //     for (int i=0; i<nx; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       real tmp = f(k,j+offy_s,i+offx_s,icrm)-f0(k,j+offy_s,i+offx_s,icrm);
       yakl::atomicAdd(fadv(k,icrm),tmp);
     });
@@ -57,7 +57,7 @@ void advect_scalar(real5d &f, int ind_f, real2d &fadv, real2d &flux) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
   if(docolumn) {
 
-    parallel_for( SimpleBounds<2>(nz,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+    parallel_for( CrmBounds<2>(nz,ncrms) , YAKL_LAMBDA (int k, int icrm) {
       flux(k,icrm) = 0.0;
     });
 
@@ -67,7 +67,7 @@ void advect_scalar(real5d &f, int ind_f, real2d &fadv, real2d &flux) {
     //   for (int j=0; j<dimy_s; j++) {
     //     for (int i=0; i<dimx_s; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(nzm,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(nzm,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       f0(k,j,i,icrm) = f(ind_f,k,j,i,icrm);
     });
 
@@ -79,7 +79,7 @@ void advect_scalar(real5d &f, int ind_f, real2d &fadv, real2d &flux) {
 
     // for (int k=0; k<nzm; k++) {
     //  for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+    parallel_for( CrmBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
       fadv(k,icrm)=0.0;
     });
     
@@ -87,7 +87,7 @@ void advect_scalar(real5d &f, int ind_f, real2d &fadv, real2d &flux) {
     //   for (int j=0; j<ny; j++) {
     //     for (int i=0; i<nx; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       real tmp = f(ind_f,k,j+offy_s,i+offx_s,icrm)-f0(k,j+offy_s,i+offx_s,icrm);
       yakl::atomicAdd(fadv(k,icrm),tmp);
     });
@@ -104,7 +104,7 @@ void advect_scalar(real5d &f, int ind_f, real3d &fadv, int ind_fadv, real3d &flu
   // for (int k=0; k<nzm; k++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
   if (docolumn) {
-    parallel_for( SimpleBounds<2>(nz,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+    parallel_for( CrmBounds<2>(nz,ncrms) , YAKL_LAMBDA (int k, int icrm) {
       flux(ind_flux,k,icrm) = 0.0;
     });
 
@@ -114,7 +114,7 @@ void advect_scalar(real5d &f, int ind_f, real3d &fadv, int ind_fadv, real3d &flu
     //   for (int j=0; j<dimy_s; j++) {
     //     for (int i=0; i<dimx_s; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(nzm,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(nzm,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       f0(k,j,i,icrm) = f(ind_f,k,j,i,icrm);
     });
 
@@ -126,7 +126,7 @@ void advect_scalar(real5d &f, int ind_f, real3d &fadv, int ind_fadv, real3d &flu
 
     // for (int k=0; k<nzm; k++) {
     //  for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+    parallel_for( CrmBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
       fadv(ind_fadv,k,icrm)=0.0;
     });
     
@@ -134,7 +134,7 @@ void advect_scalar(real5d &f, int ind_f, real3d &fadv, int ind_fadv, real3d &flu
     //   for (int j=0; j<ny; j++) {
     //     for (int i=0; i<nx; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       real tmp = f(ind_f,k,j+offy_s,i+offx_s,icrm)-f0(k,j+offy_s,i+offx_s,icrm);
       yakl::atomicAdd(fadv(ind_fadv,k,icrm),tmp);
     });
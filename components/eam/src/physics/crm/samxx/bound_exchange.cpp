@@ -1,6 +1,8 @@
 #include "bound_exchange.h"
 
-void bound_exchange(real4d &f, int dimz, int i_1, int i_2, int j_1, int j_2, int id) {
+// Original implementation, with one pack and one unpack kernel per face and
+// corner. Used instead of the fused exchange below with -DSAMXX_UNFUSED_BOUND_EXCHANGE.
+static void bound_exchange_unfused(real4d &f, int dimz, int i_1, int i_2, int j_1, int j_2, int id) {
   YAKL_SCOPE( ncrms  , ::ncrms);
 
   real1d buffer("buffer", (nx+ny)*3*nz*ncrms);
@@ -41,7 +43,7 @@ void bound_exchange(real4d &f, int dimz, int i_1, int i_2, int j_1, int j_2, int
     //   for (int j=ny-j1-1; j<ny; j++) {
     //     for (int i=0; i<nx; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j1p,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(dimz,j1p,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       int jStart = ny-j1-1;
       int jInd = ny-j1-1+j;
       int jEnd = ny-1;
@@ -54,7 +56,7 @@ void bound_exchange(real4d &f, int dimz, int i_1, int i_2, int j_1, int j_2, int
     //   for (int j=-j1-1; j<0; j++) {
     //     for (int i=0; i<nx; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j1p,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(dimz,j1p,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       int jStart = -j1-1;
       int jInd = -j1-1+j;
       int jEnd = 0-1;
@@ -68,7 +70,7 @@ void bound_exchange(real4d &f, int dimz, int i_1, int i_2, int j_1, int j_2, int
     //   for (int j=ny-j1-1; j<ny; j++) {
     //     for (int i=nx-i1-1; i<nx; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j1p,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(dimz,j1p,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       int jStart = ny-j1-1;
       int jInd = ny-j1-1+j;
       int jEnd = ny-1;
@@ -84,7 +86,7 @@ void bound_exchange(real4d &f, int dimz, int i_1, int i_2, int j_1, int j_2, int
     //   for (int j=-j1-1; j<0; j++) {
     //     for (int i=-i1-1; i<0; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j1p,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(dimz,j1p,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       int jStart = -j1-1;
       int jInd = -j1-1+j;
       int jEnd = 0-1;
@@ -101,7 +103,7 @@ void bound_exchange(real4d &f, int dimz, int i_1, int i_2, int j_1, int j_2, int
     //   for (int j=1-1; j<i+j2; j++) {
     //     for (int i=nx-i1-1; i<nx; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j2p,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(dimz,j2p,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       int jStart = 1-1;
       int jInd = 1-1+j;
       int jEnd = 1+j2-1;
@@ -117,7 +119,7 @@ void bound_exchange(real4d &f, int dimz, int i_1, int i_2, int j_1, int j_2, int
     //   for (int j=nyp1-1; j<nyp1+j2; j++) {
     //     for (int i=-i1-1; i<0; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j2p,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(dimz,j2p,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       int jStart = nyp1-1;
       int jInd = nyp1-1+j;
       int jEnd = nyp1+j2-1;
@@ -134,7 +136,7 @@ void bound_exchange(real4d &f, int dimz, int i_1, int i_2, int j_1, int j_2, int
     //   for (int j=0; j<1+j2; j++) {
     //     for (int i=0; i<nx; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j2p,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(dimz,j2p,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       int jStart = 1-1;
       int jInd = 1-1+j;
       int jEnd = 1+j2-1;
@@ -147,7 +149,7 @@ void bound_exchange(real4d &f, int dimz, int i_1, int i_2, int j_1, int j_2, int
     //   for (int j=nyp1-1; j<nyp1+j2; j++) {
     //     for (int i=0; i<nx; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j2p,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(dimz,j2p,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       int jStart = nyp1-1;
       int jInd = nyp1-1+j;
       int jEnd = nyp1+j2-1;
@@ -161,7 +163,7 @@ void bound_exchange(real4d &f, int dimz, int i_1, int i_2, int j_1, int j_2, int
     //   for (int j=0; j<1+j2; j++) {
     //     for (int i=0; i<1+i2; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j2p,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(dimz,j2p,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       int jStart = 1-1;
       int jInd = 1-1+j;
       int jEnd = 1+j2-1;
@@ -177,7 +179,7 @@ void bound_exchange(real4d &f, int dimz, int i_1, int i_2, int j_1, int j_2, int
     //   for (int j=nyp1-1; j<nyp1+j2; j++) {
     //     for (int i=nxp1-1; i<nxp1+i2; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j2p,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(dimz,j2p,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       int jStart = nyp1-1;
       int jInd = nyp1-1+j;
       int jEnd = nyp1+j2-1;
@@ -194,7 +196,7 @@ void bound_exchange(real4d &f, int dimz, int i_1, int i_2, int j_1, int j_2, int
     //   for (int j=ny-j1-1; j<ny; j++) {
     //     for (int i=0; i<1+i2; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j1p,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(dimz,j1p,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       int jStart = ny-j1-1;
       int jInd = ny-j1-1+j;
       int jEnd = ny-1;
@@ -210,7 +212,7 @@ void bound_exchange(real4d &f, int dimz, int i_1, int i_2, int j_1, int j_2, int
     //   for (int j=-j1-1; j<0; j++) {
     //     for (int i=nxp1-1; i<nxp1+i2; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j1p,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(dimz,j1p,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       int jStart = -j1-1;
       int jInd = -j1-1+j;
       int jEnd = 0-1;
@@ -229,7 +231,7 @@ void bound_exchange(real4d &f, int dimz, int i_1, int i_2, int j_1, int j_2, int
     //   for (int j=0; j<ny; j++) {
     //     for (int i=nx-i1-1; i<nx; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(dimz,ny,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  parallel_for( CrmBounds<4>(dimz,ny,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     int iStart = nx-i1-1;
     int iInd = nx-i1-1+i;
     int iEnd = nx-1;
@@ -242,7 +244,7 @@ void bound_exchange(real4d &f, int dimz, int i_1, int i_2, int j_1, int j_2, int
     //   for (int j=0; j<ny; j++) {
     //     for (int i=-i1-1; i<0; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(dimz,ny,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  parallel_for( CrmBounds<4>(dimz,ny,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     int iStart = -i1-1;
     int iInd = -i1-1+i;
     int iEnd = 0-1;
@@ -256,7 +258,7 @@ void bound_exchange(real4d &f, int dimz, int i_1, int i_2, int j_1, int j_2, int
     //   for (int j=0; j<ny; j++) {
     //     for (int i=0; i<1+i2; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(dimz,ny,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  parallel_for( CrmBounds<4>(dimz,ny,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     int iStart = 1-1;
     int iInd = 1-1+i;
     int iEnd = 1+i2-1;
@@ -269,7 +271,7 @@ void bound_exchange(real4d &f, int dimz, int i_1, int i_2, int j_1, int j_2, int
     //   for (int j=0; j<ny; j++) {
     //     for (int i=nxp1-1; i<nxp1+i2; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(dimz,ny,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  parallel_for( CrmBounds<4>(dimz,ny,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     int iStart = nxp1-1;
     int iInd = nxp1-1+i;
     int iEnd = nxp1+i2-1;
@@ -280,7 +282,7 @@ void bound_exchange(real4d &f, int dimz, int i_1, int i_2, int j_1, int j_2, int
 
 }
 
-void bound_exchange(real5d &f, int offL,int dimz, int i_1, int i_2, int j_1, int j_2, int id) {
+static void bound_exchange_unfused(real5d &f, int offL,int dimz, int i_1, int i_2, int j_1, int j_2, int id) {
   YAKL_SCOPE( ncrms  , ::ncrms);
 
   real1d buffer("buffer", (nx+ny)*3*nz*ncrms);
@@ -321,7 +323,7 @@ void bound_exchange(real5d &f, int offL,int dimz, int i_1, int i_2, int j_1, int
     //   for (int j=ny-j1-1; j<ny; j++) {
     //     for (int i=0; i<nx; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j1p,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(dimz,j1p,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       int jStart = ny-j1-1;
       int jInd = ny-j1-1+j;
       int jEnd = ny-1;
@@ -334,7 +336,7 @@ void bound_exchange(real5d &f, int offL,int dimz, int i_1, int i_2, int j_1, int
     //   for (int j=-j1-1; j<0; j++) {
     //     for (int i=0; i<nx; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j1p,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(dimz,j1p,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       int jStart = -j1-1;
       int jInd = -j1-1+j;
       int jEnd = 0-1;
@@ -348,7 +350,7 @@ void bound_exchange(real5d &f, int offL,int dimz, int i_1, int i_2, int j_1, int
     //   for (int j=ny-j1-1; j<ny; j++) {
     //     for (int i=nx-i1-1; i<nx; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j1p,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(dimz,j1p,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       int jStart = ny-j1-1;
       int jInd = ny-j1-1+j;
       int jEnd = ny-1;
@@ -364,7 +366,7 @@ void bound_exchange(real5d &f, int offL,int dimz, int i_1, int i_2, int j_1, int
     //   for (int j=-j1-1; j<0; j++) {
     //     for (int i=-i1-1; i<0; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j1p,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(dimz,j1p,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       int jStart = -j1-1;
       int jInd = -j1-1+j;
       int jEnd = 0-1;
@@ -381,7 +383,7 @@ void bound_exchange(real5d &f, int offL,int dimz, int i_1, int i_2, int j_1, int
     //   for (int j=1-1; j<i+j2; j++) {
     //     for (int i=nx-i1-1; i<nx; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j2p,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(dimz,j2p,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       int jStart = 1-1;
       int jInd = 1-1+j;
       int jEnd = 1+j2-1;
@@ -397,7 +399,7 @@ void bound_exchange(real5d &f, int offL,int dimz, int i_1, int i_2, int j_1, int
     //   for (int j=nyp1-1; j<nyp1+j2; j++) {
     //     for (int i=-i1-1; i<0; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j2p,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(dimz,j2p,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       int jStart = nyp1-1;
       int jInd = nyp1-1+j;
       int jEnd = nyp1+j2-1;
@@ -414,7 +416,7 @@ void bound_exchange(real5d &f, int offL,int dimz, int i_1, int i_2, int j_1, int
     //   for (int j=0; j<1+j2; j++) {
     //     for (int i=0; i<nx; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j2p,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(dimz,j2p,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       int jStart = 1-1;
       int jInd = 1-1+j;
       int jEnd = 1+j2-1;
@@ -427,7 +429,7 @@ void bound_exchange(real5d &f, int offL,int dimz, int i_1, int i_2, int j_1, int
     //   for (int j=nyp1-1; j<nyp1+j2; j++) {
     //     for (int i=0; i<nx; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j2p,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(dimz,j2p,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       int jStart = nyp1-1;
       int jInd = nyp1-1+j;
       int jEnd = nyp1+j2-1;
@@ -441,7 +443,7 @@ void bound_exchange(real5d &f, int offL,int dimz, int i_1, int i_2, int j_1, int
     //   for (int j=0; j<1+j2; j++) {
     //     for (int i=0; i<1+i2; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j2p,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(dimz,j2p,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       int jStart = 1-1;
       int jInd = 1-1+j;
       int jEnd = 1+j2-1;
@@ -457,7 +459,7 @@ void bound_exchange(real5d &f, int offL,int dimz, int i_1, int i_2, int j_1, int
     //   for (int j=nyp1-1; j<nyp1+j2; j++) {
     //     for (int i=nxp1-1; i<nxp1+i2; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j2p,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(dimz,j2p,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       int jStart = nyp1-1;
       int jInd = nyp1-1+j;
       int jEnd = nyp1+j2-1;
@@ -474,7 +476,7 @@ void bound_exchange(real5d &f, int offL,int dimz, int i_1, int i_2, int j_1, int
     //   for (int j=ny-j1-1; j<ny; j++) {
     //     for (int i=0; i<1+i2; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j1p,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(dimz,j1p,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       int jStart = ny-j1-1;
       int jInd = ny-j1-1+j;
       int jEnd = ny-1;
@@ -490,7 +492,7 @@ void bound_exchange(real5d &f, int offL,int dimz, int i_1, int i_2, int j_1, int
     //   for (int j=-j1-1; j<0; j++) {
     //     for (int i=nxp1-1; i<nxp1+i2; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j1p,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(dimz,j1p,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       int jStart = -j1-1;
       int jInd = -j1-1+j;
       int jEnd = 0-1;
@@ -509,7 +511,7 @@ void bound_exchange(real5d &f, int offL,int dimz, int i_1, int i_2, int j_1, int
     //   for (int j=0; j<ny; j++) {
     //     for (int i=nx-i1-1; i<nx; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(dimz,ny,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  parallel_for( CrmBounds<4>(dimz,ny,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     int iStart = nx-i1-1;
     int iInd = nx-i1-1+i;
     int iEnd = nx-1;
@@ -522,7 +524,7 @@ void bound_exchange(real5d &f, int offL,int dimz, int i_1, int i_2, int j_1, int
     //   for (int j=0; j<ny; j++) {
     //     for (int i=-i1-1; i<0; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(dimz,ny,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  parallel_for( CrmBounds<4>(dimz,ny,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     int iStart = -i1-1;
     int iInd = -i1-1+i;
     int iEnd = 0-1;
@@ -536,7 +538,7 @@ void bound_exchange(real5d &f, int offL,int dimz, int i_1, int i_2, int j_1, int
     //   for (int j=0; j<ny; j++) {
     //     for (int i=0; i<1+i2; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(dimz,ny,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  parallel_for( CrmBounds<4>(dimz,ny,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     int iStart = 1-1;
     int iInd = 1-1+i;
     int iEnd = 1+i2-1;
@@ -549,7 +551,7 @@ void bound_exchange(real5d &f, int offL,int dimz, int i_1, int i_2, int j_1, int
     //   for (int j=0; j<ny; j++) {
     //     for (int i=nxp1-1; i<nxp1+i2; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(dimz,ny,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  parallel_for( CrmBounds<4>(dimz,ny,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     int iStart = nxp1-1;
     int iInd = nxp1-1+i;
     int iEnd = nxp1+i2-1;
@@ -559,3 +561,140 @@ void bound_exchange(real5d &f, int offL,int dimz, int i_1, int i_2, int j_1, int
   });
 
 }
+
+
+// The periodic halo of one exchange as a list of rectangular regions: region r
+// copies the nj x ni block of interior points starting at (src_j,src_i) into the
+// halo block starting at (dst_j,dst_i). Indices do not include the array offsets.
+// Points are numbered region by region, so a single kernel can walk all of them.
+struct BoundExchangeTable {
+  int nregions;
+  int npts;
+  SArray<int,1,9> start; // First point of each region; start(nregions) == npts
+  SArray<int,1,8> src_j, src_i, dst_j, dst_i, ni;
+
+  YAKL_INLINE void get(int n, int &sj, int &si, int &dj, int &di) const {
+    int r = 0;
+    while (n >= start(r+1)) { r++; }
+    int jj = (n-start(r)) / ni(r);
+    int ii = (n-start(r)) - jj*ni(r);
+    sj = src_j(r)+jj;
+    si = src_i(r)+ii;
+    dj = dst_j(r)+jj;
+    di = dst_i(r)+ii;
+  }
+};
+
+// Same regions, in the same order, as bound_exchange_unfused
+static BoundExchangeTable bound_exchange_table(int i_1, int i_2, int j_1, int j_2) {
+  BoundExchangeTable t;
+  t.nregions = 0;
+  t.npts = 0;
+  auto add = [&] (int sj, int si, int dj, int di, int nj, int ni) {
+    int r = t.nregions;
+    t.src_j(r) = sj;
+    t.src_i(r) = si;
+    t.dst_j(r) = dj;
+    t.dst_i(r) = di;
+    t.ni   (r) = ni;
+    t.start(r) = t.npts;
+    t.npts += nj*ni;
+    t.nregions++;
+  };
+  if (RUN3D) {
+    add( ny-j_1 , 0      , -j_1 , 0    , j_1 , nx  ); // "North"      -> "South"
+    add( ny-j_1 , nx-i_1 , -j_1 , -i_1 , j_1 , i_1 ); // "North-East" -> "South-West"
+    add( 0      , nx-i_1 , ny   , -i_1 , j_2 , i_1 ); // "South-East" -> "North-West"
+    add( 0      , 0      , ny   , 0    , j_2 , nx  ); // "South"      -> "North"
+    add( 0      , 0      , ny   , nx   , j_2 , i_2 ); // "South-West" -> "North-East"
+    add( ny-j_1 , 0      , -j_1 , nx   , j_1 , i_2 ); // "North-West" -> "South-East"
+  }
+  add( 0 , nx-i_1 , 0 , -i_1 , ny , i_1 );            // "East"       -> "West"
+  add( 0 , 0      , 0 , nx   , ny , i_2 );            // "West"       -> "East"
+  t.start(t.nregions) = t.npts;
+  return t;
+}
+
+static void bound_exchange_offsets(int id, int &offx, int &offy) {
+  if        (id==1) {
+    offx = offx_u;
+    offy = offy_u;
+  } else if (id==2) {
+    offx = offx_v;
+    offy = offy_v;
+  } else if (id==3) {
+    offx = offx_w;
+    offy = offy_w;
+  } else if (id==4) {
+    offx = offx_s;
+    offy = offy_s;
+  } else if (id==5) {
+    offx = offx_d;
+    offy = offy_d;
+  } else {
+    std::cout << "Id set in bound_exchange incorrectly:" << std::endl;
+    exit(-1);
+  }
+}
+
+void bound_exchange(real4d &f, int dimz, int i_1, int i_2, int j_1, int j_2, int id) {
+  YAKL_SCOPE( ncrms  , ::ncrms);
+
+  if (! fused_bound_exchange) {
+    bound_exchange_unfused(f, dimz, i_1, i_2, j_1, j_2, id);
+    return;
+  }
+
+  int offx, offy;
+  bound_exchange_offsets(id, offx, offy);
+  BoundExchangeTable table = bound_exchange_table(i_1, i_2, j_1, j_2);
+
+  // Sources are interior points and destinations are halo points, so all the
+  // copies are independent and need no buffer
+  // for (int k=0; k<dimz; k++) {
+  //   for (int n=0; n<table.npts; n++) {
+  //     for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( CrmBounds<3>(dimz,table.npts,ncrms) , YAKL_LAMBDA (int k, int n, int icrm) {
+    int sj, si, dj, di;
+    table.get(n, sj, si, dj, di);
+    f(k,dj+offy,di+offx,icrm) = f(k,sj+offy,si+offx,icrm);
+  });
+}
+
+void bound_exchange(real5d &f, int offL, int dimz, int i_1, int i_2, int j_1, int j_2, int id) {
+  bound_exchange(f, std::vector<int>(1,offL), dimz, i_1, i_2, j_1, j_2, id);
+}
+
+void bound_exchange(real5d &f, std::vector<int> const &fields, int dimz, int i_1, int i_2, int j_1, int j_2, int id) {
+  YAKL_SCOPE( ncrms  , ::ncrms);
+
+  if (! fused_bound_exchange) {
+    for (int l : fields) {
+      bound_exchange_unfused(f, l, dimz, i_1, i_2, j_1, j_2, id);
+    }
+    return;
+  }
+
+  int nfields = fields.size();
+  if (nfields == 0) { return; }
+  if (nfields > max_bound_exchange_fields) {
+    std::cout << "Too many fields in bound_exchange: " << nfields << std::endl;
+    exit(-1);
+  }
+  SArray<int,1,max_bound_exchange_fields> field;
+  for (int l=0; l<nfields; l++) { field(l) = fields[l]; }
+
+  int offx, offy;
+  bound_exchange_offsets(id, offx, offy);
+  BoundExchangeTable table = bound_exchange_table(i_1, i_2, j_1, j_2);
+
+  // for (int l=0; l<nfields; l++) {
+  //   for (int k=0; k<dimz; k++) {
+  //     for (int n=0; n<table.npts; n++) {
+  //       for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( CrmBounds<4>(nfields,dimz,table.npts,ncrms) , YAKL_LAMBDA (int l, int k, int n, int icrm) {
+    int sj, si, dj, di;
+    table.get(n, sj, si, dj, di);
+    f(field(l),k,dj+offy,di+offx,icrm) = f(field(l),k,sj+offy,si+offx,icrm);
+  });
+}
@@ -3,9 +3,12 @@
 
 #include "samxx_const.h"
 #include "vars.h"
+#include <vector>
 
 void bound_exchange(real4d &f, int dimz, int i_1, int i_2, int j_1, int j_2, int id);
 void bound_exchange(real5d &f, int offL, int dimz, int i_1, int i_2, int j_1, int j_2, int id);
+// Exchange several fields of f (first index) with a single kernel
+void bound_exchange(real5d &f, std::vector<int> const &fields, int dimz, int i_1, int i_2, int j_1, int j_2, int id);
 
 YAKL_INLINE int constexpr _IDX(int const l1, int const u1, int const i1, int const l2, int const u2, 
                                int const i2, int const l3, int const u3, int const i3, int const l4, 
@@ -17,12 +17,12 @@ void VT_filter(int filter_wn_max, real4d &f_in, real4d &f_out) {
   //----------------------------------------------------------------------------
   // Forward Fourier transform
 
-  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  parallel_for( CrmBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     fft_out(k,j,i,icrm) = f_in(k,j,i,icrm);
   });
 
-  vt_fftx.forward_real(fft_out, 2, nx);
-  if (RUN3D) { vt_ffty.forward_real(fft_out, 1, ny); }
+  vt_fftx.forward_real(fft_out, crm_storage_dim(2), nx);
+  if (RUN3D) { vt_ffty.forward_real(fft_out, crm_storage_dim(1), ny); }
 
   //----------------------------------------------------------------------------
   // Zero out the higher modes
@@ -32,7 +32,7 @@ void VT_filter(int filter_wn_max, real4d &f_in, real4d &f_out) {
     //   for (int j=0; j<nwy; j++) {
     //     for (int i=0; i<nwx+1; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(nzm,nwy,nwx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(nzm,nwy,nwx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       int ii = i + 2*(filter_wn_max+1) ;
       int jj = j + 2*(filter_wn_max+1) ;
       fft_out(k,jj,ii,icrm) = 0.0;
@@ -41,7 +41,7 @@ void VT_filter(int filter_wn_max, real4d &f_in, real4d &f_out) {
     // for (int k=0; k<nzm; k++) {
     //   for (int i=0; i<nwx+1; i++) {
     //     for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<3>(nzm,nwx,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+    parallel_for( CrmBounds<3>(nzm,nwx,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
       int ii = i + 2*(filter_wn_max+1) ;
       fft_out(k,0,ii,icrm) = 0.0;
     });
@@ -53,7 +53,7 @@ void VT_filter(int filter_wn_max, real4d &f_in, real4d &f_out) {
   if (RUN3D) { vt_ffty.inverse_real(fft_out); }
   vt_fftx.inverse_real(fft_out);
 
-  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  parallel_for( CrmBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     f_out(k,j,i,icrm) = fft_out(k,j,i,icrm);
   });
 
@@ -87,7 +87,7 @@ void VT_diagnose() {
   //----------------------------------------------------------------------------
   // do k = 1,nzm
   //   do icrm = 1,ncrms
-  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+  parallel_for( CrmBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
       t_mean(k,icrm) = 0.0;
       q_mean(k,icrm) = 0.0;
       u_mean(k,icrm) = 0.0;
@@ -100,7 +100,7 @@ void VT_diagnose() {
   //  do j = 1,ny
   //    do i = 1,nx
   //      do icrm = 1,ncrms
-  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  parallel_for( CrmBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     yakl::atomicAdd( t_mean(k,icrm) , t(k,j+offy_s,i+offx_s,icrm) );
     yakl::atomicAdd( q_mean(k,icrm) , micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) );
     yakl::atomicAdd( u_mean(k,icrm) , u(k,j+offy_u,i+offx_u,icrm) );
@@ -108,7 +108,7 @@ void VT_diagnose() {
 
   // do k = 1,nzm
   //   do icrm = 1,ncrms
-  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+  parallel_for( CrmBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
       t_mean(k,icrm) = t_mean(k,icrm) * factor_xy ;
       q_mean(k,icrm) = q_mean(k,icrm) * factor_xy ;
       u_mean(k,icrm) = u_mean(k,icrm) * factor_xy ;
@@ -128,7 +128,7 @@ void VT_diagnose() {
     //   do j = 1,ny
     //     do i = 1,nx
     //       do icrm = 1,ncrms
-    parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       tmp_t(k,j,i,icrm) = t(k,j+offy_s,i+offx_s,icrm);
       tmp_q(k,j,i,icrm) = micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm);
       tmp_t(k,j,i,icrm) = tmp_t(k,j,i,icrm) - t_mean(k,icrm);
@@ -147,7 +147,7 @@ void VT_diagnose() {
     //   do j = 1,ny
     //     do i = 1,nx
     //       do icrm = 1,ncrms
-    parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       t_vt_pert(k,j,i,icrm) = t(k,j+offy_s,i+offx_s,icrm) - t_mean(k,icrm);
       q_vt_pert(k,j,i,icrm) = micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) - q_mean(k,icrm);
       u_vt_pert(k,j,i,icrm) = u(k,j+offy_u,i+offx_u,icrm) - u_mean(k,icrm);
@@ -163,7 +163,7 @@ void VT_diagnose() {
   //   do j = 1,ny
   //     do i = 1,nx
   //       do icrm = 1,ncrms
-  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  parallel_for( CrmBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     yakl::atomicAdd( t_vt(k,icrm) , t_vt_pert(k,j,i,icrm) * t_vt_pert(k,j,i,icrm) );
     yakl::atomicAdd( q_vt(k,icrm) , q_vt_pert(k,j,i,icrm) * q_vt_pert(k,j,i,icrm) );
     yakl::atomicAdd( u_vt(k,icrm) , u_vt_pert(k,j,i,icrm) * u_vt_pert(k,j,i,icrm) );
@@ -172,7 +172,7 @@ void VT_diagnose() {
 
   // do k = 1,nzm
   //   do icrm = 1,ncrms
-  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+  parallel_for( CrmBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
     t_vt(k,icrm) = t_vt(k,icrm) * factor_xy ;
     q_vt(k,icrm) = q_vt(k,icrm) * factor_xy ;
     u_vt(k,icrm) = u_vt(k,icrm) * factor_xy ;
@@ -221,7 +221,7 @@ void VT_forcing() {
   //----------------------------------------------------------------------------
   // do k = 1,nzm
   //   do icrm = 1,ncrms
-  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+  parallel_for( CrmBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
     // initialize scaling factors to 1.0
     t_pert_scale(k,icrm) = 1.0;
     q_pert_scale(k,icrm) = 1.0;
@@ -253,7 +253,7 @@ void VT_forcing() {
   //   do j = 1,ny
   //     do i = 1,nx
   //       do icrm = 1,ncrms
-  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  parallel_for( CrmBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     real ttend_loc = ( t_pert_scale(k,icrm) * t_vt_pert(k,j,i,icrm) - t_vt_pert(k,j,i,icrm) ) / dtn;
     real qtend_loc = ( q_pert_scale(k,icrm) * q_vt_pert(k,j,i,icrm) - q_vt_pert(k,j,i,icrm) ) / dtn;
     t(k,j+offy_s,i+offx_s,icrm)                  = t(k,j+offy_s,i+offx_s,icrm)                  + ttend_loc * dtn;
@@ -9,7 +9,7 @@ void diffuse_scalar(real5d &tkh, int ind_tkh, real4d &f, real3d &fluxb, real3d &
   //   for (int j=0; j<dimy_s; j++) {
   //     for (int i=0; i<dimx_s; i++) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzm,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  parallel_for( CrmBounds<4>(nzm,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     df(k,j,i,icrm) = f(k,j,i,icrm);
   });
 
@@ -21,7 +21,7 @@ void diffuse_scalar(real5d &tkh, int ind_tkh, real4d &f, real3d &fluxb, real3d &
 
   // for (int k=0; k<nzm; k++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+  parallel_for( CrmBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
     fdiff(k,icrm) = 0.0;
   });
 
@@ -29,7 +29,7 @@ void diffuse_scalar(real5d &tkh, int ind_tkh, real4d &f, real3d &fluxb, real3d &
   //   for (int j=0; j<ny; j++) {
   //     for (int i=0; i<nx; i++) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  parallel_for( CrmBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     real tmp = f(k,j+offy_s,i+offx_s,icrm)-df(k,j+offy_s,i+offx_s,icrm);
     yakl::atomicAdd(fdiff(k,icrm),tmp);
   });
@@ -44,7 +44,7 @@ void diffuse_scalar(real5d &tkh, int ind_tkh, real5d &f, int ind_f, real3d &flux
   //   for (int j=0; j<dimy_s; j++) {
   //     for (int i=0; i<dimx_s; i++) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzm,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  parallel_for( CrmBounds<4>(nzm,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     df(k,j,i,icrm) = f(ind_f,k,j,i,icrm);
   });
 
@@ -56,7 +56,7 @@ void diffuse_scalar(real5d &tkh, int ind_tkh, real5d &f, int ind_f, real3d &flux
 
   // for (int k=0; k<nzm; k++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+  parallel_for( CrmBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
     fdiff(k,icrm) = 0.0;
   });
 
@@ -64,7 +64,7 @@ void diffuse_scalar(real5d &tkh, int ind_tkh, real5d &f, int ind_f, real3d &flux
   //   for (int j=0; j<ny; j++) {
   //     for (int i=0; i<nx; i++) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  parallel_for( CrmBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     real tmp = f(ind_f,k,j+offy_s,i+offx_s,icrm)-df(k,j+offy_s,i+offx_s,icrm);
     yakl::atomicAdd(fdiff(k,icrm),tmp);
   });
@@ -79,7 +79,7 @@ void diffuse_scalar(real5d &tkh, int ind_tkh, real5d &f, int ind_f, real4d &flux
   //   for (int j=0; j<dimy_s; j++) {
   //     for (int i=0; i<dimx_s; i++) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzm,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  parallel_for( CrmBounds<4>(nzm,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     df(k,j,i,icrm) = f(ind_f,k,j,i,icrm);
   });
 
@@ -91,7 +91,7 @@ void diffuse_scalar(real5d &tkh, int ind_tkh, real5d &f, int ind_f, real4d &flux
 
   // for (int k=0; k<nzm; k++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+  parallel_for( CrmBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
     fdiff(ind_fdiff,k,icrm) = 0.0;
   });
 
@@ -99,7 +99,7 @@ void diffuse_scalar(real5d &tkh, int ind_tkh, real5d &f, int ind_f, real4d &flux
   //   for (int j=0; j<ny; j++) {
   //     for (int i=0; i<nx; i++) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  parallel_for( CrmBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     real tmp = f(ind_f,k,j+offy_s,i+offx_s,icrm)-df(k,j+offy_s,i+offx_s,icrm);
     yakl::atomicAdd(fdiff(ind_fdiff,k,icrm),tmp);
   });
@@ -7,13 +7,24 @@ void periodic(int flag) {
   YAKL_SCOPE( ncrms   , :: ncrms );
   YAKL_SCOPE( use_ESMT, :: use_ESMT );
 
+  // Fields of sgs_field and micro_field that are exchanged by flags 2 and 3
+  std::vector<int> sgs_fields, micro_fields;
+  if (flag == 2 || flag == 3) {
+    for (int i=0; i<nsgs_fields; i++) { sgs_fields.push_back(i); }
+    for (int i=0; i<nmicro_fields; i++) {
+      if (i == index_water_vapor || (docloud && flag_precip(i)!=1) || (doprecip && flag_precip(i)==1)) {
+        micro_fields.push_back(i);
+      }
+    }
+  }
+
   if (flag == 0) {
     bound_exchange(u,nzm,1,1,1,1, 1);
     bound_exchange(v,nzm,1,1,1,1, 2);
     //   for (int j=0; j<ny; j++) {
     //     for (int i=0; i<nx; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<3>(ny,nx,ncrms) , YAKL_LAMBDA (int j, int i, int icrm) {
+    parallel_for( CrmBounds<3>(ny,nx,ncrms) , YAKL_LAMBDA (int j, int i, int icrm) {
       w(nz-1,j+offy_w,i+offx_w,icrm) = sstxy(j+offy_sstxy,i+offx_sstxy,icrm);
     });
 
@@ -21,7 +32,7 @@ void periodic(int flag) {
     //   for (int j=0; j<ny+2*YES3D; j++) {
     //     for (int i=0; i<nxp3; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<3>(ny+2*YES3D,nxp3,ncrms) , YAKL_LAMBDA (int j, int i, int icrm) {
+    parallel_for( CrmBounds<3>(ny+2*YES3D,nxp3,ncrms) , YAKL_LAMBDA (int j, int i, int icrm) {
       int jStart = 1-YES3D-1;
       int jInd = 1-YES3D-1 +j;
       int jEnd = ny+YES3D-1;
@@ -36,7 +47,7 @@ void periodic(int flag) {
     //   for (int j=0; j<ny+2*YES3D; j++) {
     //     for (int i=0; i<nxp3; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<3>(ny+2*YES3D,nxp3,ncrms) , YAKL_LAMBDA (int j, int i, int icrm) {
+    parallel_for( CrmBounds<3>(ny+2*YES3D,nxp3,ncrms) , YAKL_LAMBDA (int j, int i, int icrm) {
       int jStart = 1-YES3D-1;
       int jInd = 1-YES3D-1+j;
       int jEnd = ny+YES3D-1;
@@ -55,17 +66,10 @@ void periodic(int flag) {
     bound_exchange(w,nz,2,2,2,2, 3);
     bound_exchange(t,nzm,3,3,3,3, 4);
 
-    for (int i=0; i<nsgs_fields; i++) {
-      if (dosgs && advect_sgs) {
-        bound_exchange(sgs_field,i,nzm,3,3,3,3, 4);
-      }
-    }
-
-    for (int i=0; i<nmicro_fields; i++) {
-      if (i == index_water_vapor || (docloud && flag_precip(i)!=1) || (doprecip && flag_precip(i)==1)) {
-        bound_exchange(micro_field,i,nzm,3,3,3,3, 4);
-      }
+    if (dosgs && advect_sgs) {
+      bound_exchange(sgs_field,sgs_fields,nzm,3,3,3,3, 4);
     }
+    bound_exchange(micro_field,micro_fields,nzm,3,3,3,3, 4);
     if (use_ESMT) {
       bound_exchange(u_esmt, nzm, 3, 3, 3, 3, 4);
       bound_exchange(v_esmt, nzm, 3, 3, 3, 3, 4);
@@ -74,17 +78,10 @@ void periodic(int flag) {
 
   if (flag == 3) {
     bound_exchange(t,nzm,1,1,1,1, 4);
-    for (int i=0; i<nsgs_fields; i++) {
-      if (dosgs && advect_sgs) {
-        bound_exchange(sgs_field,i,nzm,1,1,1,1, 4);
-      }
-    }
-
-    for (int i=0; i<nmicro_fields; i++) {
-      if ( i==index_water_vapor || (docloud && flag_precip(i)!=1) || (doprecip && flag_precip(i)==1)) {
-          bound_exchange(micro_field,i,nzm,1,1,1,1, 4);
-      }
+    if (dosgs && advect_sgs) {
+      bound_exchange(sgs_field,sgs_fields,nzm,1,1,1,1, 4);
     }
+    bound_exchange(micro_field,micro_fields,nzm,1,1,1,1, 4);
     if (use_ESMT) {
       bound_exchange(u_esmt, nzm, 1, 1, 1, 1, 4);
       bound_exchange(v_esmt, nzm, 1, 1, 1, 1, 4);
@@ -92,10 +89,10 @@ void periodic(int flag) {
   }
 
   if (flag == 4) {
-    for (int i=0; i<nsgs_fields_diag; i++) {
-      if (dosgs && do_sgsdiag_bound) {
-        bound_exchange(sgs_field_diag,i,nzm,1,1,1,1, 5);
-      }
+    if (dosgs && do_sgsdiag_bound) {
+      std::vector<int> sgs_diag_fields;
+      for (int i=0; i<nsgs_fields_diag; i++) { sgs_diag_fields.push_back(i); }
+      bound_exchange(sgs_field_diag,sgs_diag_fields,nzm,1,1,1,1, 5);
     }
   }
 
@@ -27,7 +27,7 @@ void press_rhs() {
     // for (int k=0; k<nzm; k++) {
     //  for (int j=0; j<ny; j++) {
     //    for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<3>(nzm,ny,ncrms) , YAKL_LAMBDA (int k, int j, int icrm) {
+    parallel_for( CrmBounds<3>(nzm,ny,ncrms) , YAKL_LAMBDA (int k, int j, int icrm) {
       dudt(na-1,k,j,0,icrm) = 0.0;
     });
   }
@@ -36,7 +36,7 @@ void press_rhs() {
     // for (int k=0; k<nzm; k++) {
     //  for (int i=0; i<nx; i++) {
     //    for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<3>(nzm,nx,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+    parallel_for( CrmBounds<3>(nzm,nx,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
       dvdt(na-1,k,0,i,icrm) = 0.0;
     });
   }
@@ -54,7 +54,7 @@ void press_rhs() {
     //   for (int j=0; j<ny; j++) {
     //     for (int i=0; i<nx; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    parallel_for( CrmBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       int kc=k+1;
       real rdz=1.0/(adz(k,icrm)*dz(icrm));
       real rup = rhow(kc,icrm)/rho(k,icrm)*rdz;
@@ -83,7 +83,7 @@ void press_rhs() {
     // for (int k=0; k<nzm; k++) {
     //     for (int i=0; i<nx; i++) {
     //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<3>(nzm,nx,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+    parallel_for( CrmBounds<3>(nzm,nx,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
       int kc=k+1;
       real rdz=1.0/(adz(k,icrm)*dz(icrm));
       real rup = rhow(kc,icrm)/rho(k,icrm)*rdz;
@@ -43,14 +43,14 @@ void pressure() {
   //   for (int j=0; j<ny; j++) {
   //     for (int i=0; i<nx; i++) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzslab,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  parallel_for( CrmBounds<4>(nzslab,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     f(k,j,i,icrm) = p(k,j+offy_p,i+offx_p,icrm);
   });
 
   #ifndef USE_ORIG_FFT
 
-    pressure_fftx.forward_real(f, 2, nx);
-    if (RUN3D) { pressure_ffty.forward_real(f, 1, ny); }
+    pressure_fftx.forward_real(f, crm_storage_dim(2), nx);
+    if (RUN3D) { pressure_ffty.forward_real(f, crm_storage_dim(1), ny); }
 
   #else
 
@@ -61,7 +61,7 @@ void pressure() {
     realHost1d trigxj("trigxj",n3j);
     intHost1d  ifaxi ("ifaxi" ,100);
     intHost1d  ifaxj ("ifaxj" ,100);
-    realHost4d fHost = f.createHostCopy();
+    auto fHost = f.createHostCopy();
 
     yakl::fence();
 
@@ -97,13 +97,13 @@ void pressure() {
   //  for(int j=0; j<nypp; j++) {
   //    for(int i=0; i<nx+1; i++) {
   //      for(int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzslab,nypp,nx+1,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  parallel_for( CrmBounds<4>(nzslab,nypp,nx+1,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     ff(k,j,i,icrm) = f(k,j,i,icrm);
   });
 
   // for (int k=0; k<nzm; k++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+  parallel_for( CrmBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
     a(k,icrm)=rhow(k,icrm)/(adz(k,icrm)*adzw(k,icrm)*dz(icrm)*dz(icrm));
     c(k,icrm)=rhow(k+1,icrm)/(adz(k,icrm)*adzw(k+1,icrm)*dz(icrm)*dz(icrm));
   });
@@ -131,7 +131,7 @@ void pressure() {
   // for (int j=0; j<nypp; j++) {
   //  for (int i=0; i<nx+1; i++) {
   //    for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<3>(nypp,nx+1,ncrms) , YAKL_LAMBDA (int j, int i, int icrm) {
+  parallel_for( CrmBounds<3>(nypp,nx+1,ncrms) , YAKL_LAMBDA (int j, int i, int icrm) {
     SArray<real,1,nzm-1> alfa;
     SArray<real,1,nzm-1> beta;
 
@@ -168,7 +168,7 @@ void pressure() {
   //   for (int j=0; j<nypp; j++) {
   //     for (int i=0; i<nx+1; i++) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzslab,nypp,nx+1,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  parallel_for( CrmBounds<4>(nzslab,nypp,nx+1,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     f(k,j,i,icrm) = ff(k,j,i,icrm);
   });
 
@@ -208,7 +208,7 @@ void pressure() {
 
   #endif
 
-  parallel_for( SimpleBounds<4>(nzslab,dimy_p,nx+1,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  parallel_for( CrmBounds<4>(nzslab,dimy_p,nx+1,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     int jj, ii;
 
     if (YES3D) {
@@ -13,6 +13,8 @@ using yakl::c::parallel_for;
 using yakl::SArray;
 using yakl::ScalarLiveOut;
 
+#include "samxx_layout.h"
+
 template <class T>
 void DEBUG(T var) {
   std::cout << var.myname << ": " << std::setprecision(16) << std::scientific << yakl::intrinsics::sum(var) << std::endl;
@@ -203,6 +205,12 @@ int  constexpr nsgs_fields = 1;         // total number of prognostic sgs vars
 int  constexpr nsgs_fields_diag = 2;    // total number of diagnostic sgs vars
 bool constexpr do_sgsdiag_bound = true; // exchange boundaries for diagnostics fields
 int  constexpr nmicro_fields = 2;
+int  constexpr max_bound_exchange_fields = nmicro_fields > nsgs_fields_diag ? nmicro_fields : nsgs_fields_diag;
+#ifdef SAMXX_UNFUSED_BOUND_EXCHANGE
+bool constexpr fused_bound_exchange = false; // one pack/unpack kernel pair per halo face and corner
+#else
+bool constexpr fused_bound_exchange = true;  // one kernel per halo exchange
+#endif
 int  constexpr index_water_vapor = 0;
 int  constexpr index_cloud_ice = 0;
 
@@ -259,20 +267,37 @@ typedef yakl::Array<int,3,yakl::memDevice,yakl::styleC> umgInt3d;
 
 
 typedef yakl::Array<real,1,yakl::memDevice,yakl::styleC> real1d;
+#ifdef SAMXX_CRM_OUTERMOST
+typedef CrmArray<real,2> real2d;
+typedef CrmArray<real,3> real3d;
+typedef CrmArray<real,4> real4d;
+typedef CrmArray<real,5> real5d;
+#else
 typedef yakl::Array<real,2,yakl::memDevice,yakl::styleC> real2d;
 typedef yakl::Array<real,3,yakl::memDevice,yakl::styleC> real3d;
 typedef yakl::Array<real,4,yakl::memDevice,yakl::styleC> real4d;
 typedef yakl::Array<real,5,yakl::memDevice,yakl::styleC> real5d;
+#endif
 typedef yakl::Array<real,6,yakl::memDevice,yakl::styleC> real6d;
 typedef yakl::Array<real,7,yakl::memDevice,yakl::styleC> real7d;
 
 typedef yakl::Array<int,1,yakl::memDevice,yakl::styleC> int1d;
+#ifdef SAMXX_CRM_OUTERMOST
+typedef CrmArray<int,2> int2d;
+typedef CrmArray<int,3> int3d;
+#else
 typedef yakl::Array<int,2,yakl::memDevice,yakl::styleC> int2d;
 typedef yakl::Array<int,3,yakl::memDevice,yakl::styleC> int3d;
+#endif
 
 typedef yakl::Array<bool,1,yakl::memDevice,yakl::styleC> bool1d;
+#ifdef SAMXX_CRM_OUTERMOST
+typedef CrmArray<bool,2> bool2d;
+typedef CrmArray<bool,3> bool3d;
+#else
 typedef yakl::Array<bool,2,yakl::memDevice,yakl::styleC> bool2d;
 typedef yakl::Array<bool,3,yakl::memDevice,yakl::styleC> bool3d;
+#endif
 
 typedef yakl::Array<bool,1,yakl::memHost,yakl::styleC> boolHost1d;
 typedef yakl::Array<bool,2,yakl::memHost,yakl::styleC> boolHost2d;
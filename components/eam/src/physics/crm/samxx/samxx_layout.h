@@ -0,0 +1,177 @@
+
+#pragma once
+
+#include "YAKL.h"
+#include <initializer_list>
+
+//////////////////////////////////////////////////////////////////////////////////
+// Build-time array layout policy
+//
+// samxx indexes every multi-dimensional device array with the CRM (or column)
+// index last, e.g. t(k,j,i,icrm), and iterates over it with
+//   parallel_for( CrmBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {...});
+//
+// By default, arrays are stored in that order, so icrm varies fastest, which
+// gives coalesced accesses on GPUs, and CrmBounds is SimpleBounds.
+//
+// With SAMXX_CRM_OUTERMOST (CPU builds only), arrays of rank >= 2 are stored as
+// (icrm,k,j,i), and CrmBounds loops put icrm outermost, so each CRM's stencils
+// are contiguous in memory and the innermost loops vectorize. Kernels index
+// arrays exactly as in the default layout; only code that touches raw memory
+// must go through the helpers below:
+//   * crm_deep_copy(src,dst) for copies between host arrays wrapping Fortran
+//     data (always in the default layout) and samxx arrays;
+//   * crm_storage_dim(d) for the dimension argument of yakl::RealFFT1D.
+//////////////////////////////////////////////////////////////////////////////////
+
+#ifdef SAMXX_CRM_OUTERMOST
+
+#if defined(YAKL_ARCH_CUDA) || defined(YAKL_ARCH_HIP) || defined(YAKL_ARCH_SYCL) || defined(YAKL_ARCH_OPENMP45)
+#error "SAMXX_CRM_OUTERMOST is a CPU layout and cannot be used with a YAKL GPU backend"
+#endif
+
+// A yakl::Array indexed as (i0,...,icrm) but stored as (icrm,i0,...).
+template <class T, int rank, int myMem = yakl::memDevice>
+class CrmArray : public yakl::Array<T,rank,myMem,yakl::styleC> {
+  static_assert(rank >= 2 && rank <= 5, "CrmArray supports ranks 2 to 5");
+public:
+  typedef yakl::Array<T,rank,myMem,yakl::styleC> base_type;
+
+  int crm_dims[rank]; // Logical dimensions, CRM index last
+
+  CrmArray() {
+    for (int d=0; d<rank; d++) { crm_dims[d] = 0; }
+  }
+  CrmArray(char const *label, int d0, int dc)
+    : base_type(label,dc,d0) { set_dims({d0,dc}); }
+  CrmArray(char const *label, int d0, int d1, int dc)
+    : base_type(label,dc,d0,d1) { set_dims({d0,d1,dc}); }
+  CrmArray(char const *label, int d0, int d1, int d2, int dc)
+    : base_type(label,dc,d0,d1,d2) { set_dims({d0,d1,d2,dc}); }
+  CrmArray(char const *label, int d0, int d1, int d2, int d3, int dc)
+    : base_type(label,dc,d0,d1,d2,d3) { set_dims({d0,d1,d2,d3,dc}); }
+  // Wrap an array already stored in the permuted order
+  CrmArray(base_type const &permuted, int const *dims) : base_type(permuted) {
+    for (int d=0; d<rank; d++) { crm_dims[d] = dims[d]; }
+  }
+
+  YAKL_INLINE T &operator()(int i0, int ic) const {
+    return base_type::operator()(ic,i0);
+  }
+  YAKL_INLINE T &operator()(int i0, int i1, int ic) const {
+    return base_type::operator()(ic,i0,i1);
+  }
+  YAKL_INLINE T &operator()(int i0, int i1, int i2, int ic) const {
+    return base_type::operator()(ic,i0,i1,i2);
+  }
+  YAKL_INLINE T &operator()(int i0, int i1, int i2, int i3, int ic) const {
+    return base_type::operator()(ic,i0,i1,i2,i3);
+  }
+
+  CrmArray<T,rank,yakl::memHost> createHostCopy() const {
+    return CrmArray<T,rank,yakl::memHost>(base_type::createHostCopy(), crm_dims);
+  }
+  CrmArray<T,rank,yakl::memDevice> createDeviceCopy() const {
+    return CrmArray<T,rank,yakl::memDevice>(base_type::createDeviceCopy(), crm_dims);
+  }
+
+  // Extent of the CRM index
+  int crm_extent() const { return crm_dims[rank-1]; }
+
+private:
+  void set_dims(std::initializer_list<int> dims) {
+    int d = 0;
+    for (int n : dims) { crm_dims[d++] = n; }
+  }
+};
+
+template <int N>
+struct CrmBounds {
+  int dims[N];
+  CrmBounds(int d0, int dc) : dims{d0,dc} {}
+  CrmBounds(int d0, int d1, int dc) : dims{d0,d1,dc} {}
+  CrmBounds(int d0, int d1, int d2, int dc) : dims{d0,d1,d2,dc} {}
+  CrmBounds(int d0, int d1, int d2, int d3, int dc) : dims{d0,d1,d2,d3,dc} {}
+};
+
+// Same callback signature as the default layout, with icrm as the outermost loop
+template <class F>
+inline void parallel_for(CrmBounds<2> const &b, F const &f) {
+  yakl::c::parallel_for( yakl::c::SimpleBounds<2>(b.dims[1],b.dims[0]) , YAKL_LAMBDA (int icrm, int i0) {
+    f(i0,icrm);
+  });
+}
+template <class F>
+inline void parallel_for(CrmBounds<3> const &b, F const &f) {
+  yakl::c::parallel_for( yakl::c::SimpleBounds<3>(b.dims[2],b.dims[0],b.dims[1]) , YAKL_LAMBDA (int icrm, int i0, int i1) {
+    f(i0,i1,icrm);
+  });
+}
+template <class F>
+inline void parallel_for(CrmBounds<4> const &b, F const &f) {
+  yakl::c::parallel_for( yakl::c::SimpleBounds<4>(b.dims[3],b.dims[0],b.dims[1],b.dims[2]) , YAKL_LAMBDA (int icrm, int i0, int i1, int i2) {
+    f(i0,i1,i2,icrm);
+  });
+}
+template <class F>
+inline void parallel_for(CrmBounds<5> const &b, F const &f) {
+  yakl::c::parallel_for( yakl::c::SimpleBounds<5>(b.dims[4],b.dims[0],b.dims[1],b.dims[2],b.dims[3]) , YAKL_LAMBDA (int icrm, int i0, int i1, int i2, int i3) {
+    f(i0,i1,i2,i3,icrm);
+  });
+}
+
+// Storage dimension of logical dimension d of a rank >= 2 array
+inline constexpr int crm_storage_dim(int d) { return d+1; }
+
+// Copy between the default layout (e.g., host arrays wrapping Fortran data)
+// and the CRM-outermost layout. A row-major array is an (m,l) matrix, with l
+// the extent of the last index, and the permuted array is its transpose.
+template <class T, int rank, int srcMem, int dstMem>
+inline void crm_deep_copy(yakl::Array<T,rank,srcMem,yakl::styleC> const &src, CrmArray<T,rank,dstMem> &dst) {
+  auto src_host = src.createHostCopy();
+  auto dst_host = dst.createHostCopy();
+  int l = dst.crm_extent();
+  int m = dst.get_totElems() / l;
+  T const *s = src_host.data();
+  T       *p = dst_host.data();
+  for (int i=0; i<m; i++) {
+    for (int j=0; j<l; j++) {
+      p[j*m+i] = s[i*l+j];
+    }
+  }
+  dst_host.deep_copy_to(dst);
+}
+
+template <class T, int rank, int srcMem, int dstMem>
+inline void crm_deep_copy(CrmArray<T,rank,srcMem> const &src, yakl::Array<T,rank,dstMem,yakl::styleC> &dst) {
+  auto src_host = src.createHostCopy();
+  auto dst_host = dst.createHostCopy();
+  int l = src.crm_extent();
+  int m = src.get_totElems() / l;
+  T const *p = src_host.data();
+  T       *d = dst_host.data();
+  for (int i=0; i<m; i++) {
+    for (int j=0; j<l; j++) {
+      d[i*l+j] = p[j*m+i];
+    }
+  }
+  dst_host.deep_copy_to(dst);
+}
+
+template <class T, int rank, int srcMem, int dstMem>
+inline void crm_deep_copy(CrmArray<T,rank,srcMem> const &src, CrmArray<T,rank,dstMem> &dst) {
+  src.deep_copy_to(dst);
+}
+
+#else
+
+template <int N> using CrmBounds = yakl::c::SimpleBounds<N>;
+
+inline constexpr int crm_storage_dim(int d) { return d; }
+
+#endif
+
+template <class T, int rank, int srcMem, int dstMem>
+inline void crm_deep_copy(yakl::Array<T,rank,srcMem,yakl::styleC> const &src, yakl::Array<T,rank,dstMem,yakl::styleC> &dst) {
+  src.deep_copy_to(dst);
+}
@@ -51,7 +51,7 @@ void scalar_momentum_pgf( real4d& scalar_wind, real4d& tend ) {
    // Calculate layer thickness
    //do k = 1,nzm
    //  for (int icrm=0; icrm<ncrms; icrm++) {
-   parallel_for( SimpleBounds<2>(nzm+1,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+   parallel_for( CrmBounds<2>(nzm+1,ncrms) , YAKL_LAMBDA (int k, int icrm) {
       if (k < nzm) {
          dz_loc(k,icrm) = zi(k+1,icrm)-zi(k,icrm);
       } else{
@@ -65,7 +65,7 @@ void scalar_momentum_pgf( real4d& scalar_wind, real4d& tend ) {
    //-----------------------------------------
    //do k=1,nzm
    //  for (int icrm=0; icrm<ncrms; icrm++) {
-   parallel_for( SimpleBounds<3>(nzm,ny,ncrms) , YAKL_LAMBDA (int k, int j, int icrm) {
+   parallel_for( CrmBounds<3>(nzm,ny,ncrms) , YAKL_LAMBDA (int k, int j, int icrm) {
       scalar_wind_avg(k,j,icrm) = 0.0;
       shear(k,j,icrm) = 0.0;
    });
@@ -79,7 +79,7 @@ void scalar_momentum_pgf( real4d& scalar_wind, real4d& tend ) {
    //  for (int j=0; j<ny; j++) {
    //    for (int i=0; i<nx; i++) {
    //      for (int icrm=0; icrm<ncrms; icrm++) {
-   parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+   parallel_for( CrmBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       // real tmp = scalar_wind(k,j,i,icrm) / real(nx);
       yakl::atomicAdd( scalar_wind_avg(k,j,icrm) , scalar_wind(k,j,i,icrm) / real(nx) );
       // note that w is on interface levels - need to interpolate to mid-levels
@@ -88,7 +88,7 @@ void scalar_momentum_pgf( real4d& scalar_wind, real4d& tend ) {
 
    //do k = 1,nzm
    //  for (int icrm=0; icrm<ncrms; icrm++) {
-   parallel_for( SimpleBounds<3>(nzm-1,ny,ncrms) , YAKL_LAMBDA (int k, int j, int icrm) {
+   parallel_for( CrmBounds<3>(nzm-1,ny,ncrms) , YAKL_LAMBDA (int k, int j, int icrm) {
       if ( k>0) {
         shear(k,j,icrm) = ( scalar_wind_avg(k+1,j,icrm) - scalar_wind_avg(k-1,j,icrm) )/(z(k+1,icrm)-z(k-1,icrm));
       }
@@ -104,11 +104,11 @@ void scalar_momentum_pgf( real4d& scalar_wind, real4d& tend ) {
    //-----------------------------------------
    // compute forward fft of w
    //-----------------------------------------
-   parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+   parallel_for( CrmBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       w_hat(k,j,i,icrm) = w_i(k,j,i,icrm);
    });
 
-   esmt_fftx.forward_real(w_hat, 2, nx);
+   esmt_fftx.forward_real(w_hat, crm_storage_dim(2), nx);
 
    //-----------------------------------------
    //-----------------------------------------
@@ -138,7 +138,7 @@ void scalar_momentum_pgf( real4d& scalar_wind, real4d& tend ) {
    //  for (int j=0; j<ny; j++) {
    //    for (int i=0; i<nx; i++) {
    //      for (int icrm=0; icrm<ncrms; icrm++) {
-   parallel_for( SimpleBounds<4>(nzm,ny,nx2,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+   parallel_for( CrmBounds<4>(nzm,ny,nx2,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       pgf_hat(k,j,i,icrm) = 0.;
    });
 
@@ -149,7 +149,7 @@ void scalar_momentum_pgf( real4d& scalar_wind, real4d& tend ) {
    //  for (int j=0; j<ny; j++) {
    //    for (int i=0; i<nx; i++) {
    //      for (int icrm=0; icrm<ncrms; icrm++) {
-   parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+   parallel_for( CrmBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       if (i>0) {
          a(k,j,i,icrm) = dz_loc(k+1,icrm) / ( dz_loc(k+1,icrm) + dz_loc(k,icrm) );
          // the factor of 1.25 crudely accounts for difference between 2D and 3D updraft geometry
@@ -178,7 +178,7 @@ void scalar_momentum_pgf( real4d& scalar_wind, real4d& tend ) {
    //  for (int j=0; j<ny; j++) {
    //    for (int i=0; i<nx; i++) {
    //      for (int icrm=0; icrm<ncrms; icrm++) {
-   parallel_for( SimpleBounds<4>(nzm-1,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+   parallel_for( CrmBounds<4>(nzm-1,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       if (i>0) {
          b(k+1,j,i,icrm) = b(k+1,j,i,icrm) - a(k+1,j,i,icrm) / b(k,j,i,icrm) * c(k,j,i,icrm);
          pgf_hat(k+1,j,i,icrm) = pgf_hat(k+1,j,i,icrm) - a(k+1,j,i,icrm) / b(k,j,i,icrm) * pgf_hat(k,j,i,icrm);
@@ -192,7 +192,7 @@ void scalar_momentum_pgf( real4d& scalar_wind, real4d& tend ) {
    //  for (int j=0; j<ny; j++) {
    //    for (int i=0; i<nx; i++) {
    //      for (int icrm=0; icrm<ncrms; icrm++) {
-   parallel_for( SimpleBounds<4>(nzm-1,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+   parallel_for( CrmBounds<4>(nzm-1,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       if (i>0) {
          // f90: do k=nzm-1,1,-1
          // cpp: for (auto k = nzm-2; k > -1; --k) {
@@ -212,7 +212,7 @@ void scalar_momentum_pgf( real4d& scalar_wind, real4d& tend ) {
       //  for (int j=0; j<ny; j++) {
       //    for (int i=0; i<nx; i++) {
       //      for (int icrm=0; icrm<ncrms; icrm++) {
-      parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+      parallel_for( CrmBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
          pgf_hat(k,j,nx-1,icrm) = pgf_hat(k,j,nx-1,icrm) / 2.0;
       });
    }
@@ -221,7 +221,7 @@ void scalar_momentum_pgf( real4d& scalar_wind, real4d& tend ) {
    // invert fft of pgf_hat to get pgf
    //-----------------------------------------
    esmt_fftx.inverse_real(pgf_hat);
-   parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+   parallel_for( CrmBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       pgf(k,j,i,icrm) = pgf_hat(k,j,i,icrm);
    });
 
@@ -232,7 +232,7 @@ void scalar_momentum_pgf( real4d& scalar_wind, real4d& tend ) {
    //  for (int j=0; j<ny; j++) {
    //    for (int i=0; i<nx; i++) {t
    //      for (int icrm=0; icrm<ncrms; icrm++) {
-   parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+   parallel_for( CrmBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       if (k == 0) {
          tend(k,j,i,icrm) = 0.0;
       } else {
@@ -264,7 +264,7 @@ void scalar_momentum_tend() {
    //  for (int j=0; j<ny; j++) {
    //    for (int i=0; i<nx; i++) {
    //      for (int icrm=0; icrm<ncrms; icrm++) {
-   parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+   parallel_for( CrmBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
      u_esmt(k,j+offy_s,i+offx_s,icrm) = u_esmt(k,j+offy_s,i+offx_s,icrm) + u_esmt_pgf_3D(k,j,i,icrm)*dtn;
      v_esmt(k,j+offy_s,i+offx_s,icrm) = v_esmt(k,j+offy_s,i+offx_s,icrm) + v_esmt_pgf_3D(k,j,i,icrm)*dtn;
    });
@@ -103,7 +103,7 @@ printf "3D Defs: $DEFS3D\n\n"
 ############################################################################
 ## CLEAN UP THE PREVIOUS BUILD
 ############################################################################
-rm -rf CMakeCache.txt CMakeFiles cmake_install.cmake CTestTestfile.cmake Makefile fortran.exe cpp.exe cpp2d cpp3d fortran2d fortran3d
+rm -rf CMakeCache.txt CMakeFiles cmake_install.cmake CTestTestfile.cmake Makefile fortran.exe cpp.exe cpp2d cpp3d cpp2d_crm_outermost cpp3d_crm_outermost fortran2d fortran3d
 
 
 ############################################################################
@@ -113,10 +113,14 @@ mkdir fortran2d
 mkdir fortran3d
 mkdir cpp2d    
 mkdir cpp3d    
+mkdir cpp2d_crm_outermost
+mkdir cpp3d_crm_outermost
 cd fortran2d   ; ln -s ../$1 ./input.nc
 cd ../fortran3d; ln -s ../$2 ./input.nc
 cd ../cpp2d    ; ln -s ../$1 ./input.nc
 cd ../cpp3d    ; ln -s ../$2 ./input.nc
+cd ../cpp2d_crm_outermost; ln -s ../$1 ./input.nc
+cd ../cpp3d_crm_outermost; ln -s ../$2 ./input.nc
 cd ..
 
 ### link non-standard data file
@@ -10,19 +10,23 @@ import netCDF4, sys, numpy as np
 # conda create --name crm_test_env --channel conda-forge netcdf4 numpy
 #
 # Usage:
-# python nccmp.py file1.nc file2.nc
+# python nccmp.py file1.nc file2.nc [bfb]
+#
+# With bfb, exit with an error if any variable differs at all.
 #
 ################################################################################
 ################################################################################
 
 # Complain if there aren't two arguments
 if (len(sys.argv) < 3) :
-  print("Usage: python nccmp.py file1.nc file2.nc")
+  print("Usage: python nccmp.py file1.nc file2.nc [bfb]")
   sys.exit(1)
 
 # Open the two files
 nc1 = netCDF4.Dataset(sys.argv[1])
 nc2 = netCDF4.Dataset(sys.argv[2])
+bfb = len(sys.argv) > 3 and sys.argv[3] == 'bfb'
+num_diff = 0
 
 # Print column header
 print(f"{'Var Name':<20}:  {'rel 2-norm':<20}  {'rel inf-norm':<20}  {'avg abs':<20}  {'max abs':<20}")
@@ -61,8 +65,11 @@ for v in nc1.variables.keys() :
 
     # skip lines that are all zeros
     if norm2==0 and normi==0 and avg_abs_err==0 and max_abs_err==0: continue
+    num_diff = num_diff + 1
 
     # Print to terminal
     print(f'{v:<20}:  {norm2:20.10e}  {normi:20.10e}  {avg_abs_err:20.10e}  {max_abs_err:20.10e}')
 
-
+if bfb and num_diff > 0 :
+  print(f'{num_diff} variables are not bit-for-bit')
+  sys.exit(1)
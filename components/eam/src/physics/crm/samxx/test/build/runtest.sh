@@ -29,6 +29,17 @@ cd ..
 printf "\nComparing results\n\n"
 python nccmp.py fortran2d/fortran_output_000001.nc cpp2d/cpp_output_000001.nc || exit -1
 
+if [[ -x cpp2d_crm_outermost/cpp2d_crm_outermost ]]; then
+  printf "\nRunning C++ code with the CRM-outermost layout\n\n"
+  cd cpp2d_crm_outermost
+  rm -f cpp_output_000001.nc
+  mpirun -n $ntasks ./cpp2d_crm_outermost || exit -1
+  cd ..
+
+  printf "\nComparing layouts (must be bit-for-bit)\n\n"
+  python nccmp.py cpp2d/cpp_output_000001.nc cpp2d_crm_outermost/cpp_output_000001.nc bfb || exit -1
+fi
+
 ################################################################################
 ################################################################################
 
@@ -49,5 +60,16 @@ cd ..
 printf "\nComparing results\n\n"
 python nccmp.py fortran3d/fortran_output_000001.nc cpp3d/cpp_output_000001.nc || exit -1
 
+if [[ -x cpp3d_crm_outermost/cpp3d_crm_outermost ]]; then
+  printf "\nRunning C++ code with the CRM-outermost layout\n\n"
+  cd cpp3d_crm_outermost
+  rm -f cpp_output_000001.nc
+  mpirun -n $ntasks ./cpp3d_crm_outermost || exit -1
+  cd ..
+
+  printf "\nComparing layouts (must be bit-for-bit)\n\n"
+  python nccmp.py cpp3d/cpp_output_000001.nc cpp3d_crm_outermost/cpp_output_000001.nc bfb || exit -1
+fi
+
 ################################################################################
 ################################################################################
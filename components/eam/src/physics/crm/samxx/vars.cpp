@@ -419,7 +419,7 @@ void init_values() {
   nb=2;
   nc=3;
 
-  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  parallel_for( CrmBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     CF3D(k,j,i,icrm) = 1.;
   });
 
@@ -838,41 +838,41 @@ void create_and_copy_inputs(real *crm_input_bflxls_p, real *crm_input_wndls_p, r
   ::gcolp                     = int1d ( "gcolp                   "                                , ncrms); 
 
   // Copy inputs from host Array to device Array
-  crm_input_bflxls        .deep_copy_to(::crm_input_bflxls        );
-  crm_input_wndls         .deep_copy_to(::crm_input_wndls         );
-  crm_input_zmid          .deep_copy_to(::crm_input_zmid          );
-  crm_input_zint          .deep_copy_to(::crm_input_zint          );
-  crm_input_pmid          .deep_copy_to(::crm_input_pmid          );
-  crm_input_pint          .deep_copy_to(::crm_input_pint          );
-  crm_input_pdel          .deep_copy_to(::crm_input_pdel          );
-  crm_input_ul            .deep_copy_to(::crm_input_ul            );
-  crm_input_vl            .deep_copy_to(::crm_input_vl            );
-  crm_input_tl            .deep_copy_to(::crm_input_tl            );
-  crm_input_qccl          .deep_copy_to(::crm_input_qccl          );
-  crm_input_qiil          .deep_copy_to(::crm_input_qiil          );
-  crm_input_ql            .deep_copy_to(::crm_input_ql            );
-  crm_input_tau00         .deep_copy_to(::crm_input_tau00         );
-  crm_input_ul_esmt       .deep_copy_to(::crm_input_ul_esmt       );
-  crm_input_vl_esmt       .deep_copy_to(::crm_input_vl_esmt       );
-  crm_input_t_vt         .deep_copy_to(::crm_input_t_vt         );
-  crm_input_q_vt         .deep_copy_to(::crm_input_q_vt         );
-  crm_input_u_vt         .deep_copy_to(::crm_input_u_vt         );
-  crm_state_u_wind        .deep_copy_to(::crm_state_u_wind        );
-  crm_state_v_wind        .deep_copy_to(::crm_state_v_wind        );
-  crm_state_w_wind        .deep_copy_to(::crm_state_w_wind        );
-  crm_state_temperature   .deep_copy_to(::crm_state_temperature   );
-  crm_state_qv            .deep_copy_to(::crm_state_qv            );
-  crm_state_qp            .deep_copy_to(::crm_state_qp            );
-  crm_state_qn            .deep_copy_to(::crm_state_qn            );
-  crm_rad_qrad            .deep_copy_to(::crm_rad_qrad            );
-  crm_output_subcycle_factor.deep_copy_to(::crm_output_subcycle_factor);
-  lat0                    .deep_copy_to(::lat0                    );
-  long0                   .deep_copy_to(::long0                   );
-  gcolp                   .deep_copy_to(::gcolp                   );
-  crm_output_cltot        .deep_copy_to(::crm_output_cltot        );
-  crm_output_clhgh        .deep_copy_to(::crm_output_clhgh        );
-  crm_output_clmed        .deep_copy_to(::crm_output_clmed        );
-  crm_output_cllow        .deep_copy_to(::crm_output_cllow        );
+  crm_deep_copy(crm_input_bflxls        , ::crm_input_bflxls        );
+  crm_deep_copy(crm_input_wndls         , ::crm_input_wndls         );
+  crm_deep_copy(crm_input_zmid          , ::crm_input_zmid          );
+  crm_deep_copy(crm_input_zint          , ::crm_input_zint          );
+  crm_deep_copy(crm_input_pmid          , ::crm_input_pmid          );
+  crm_deep_copy(crm_input_pint          , ::crm_input_pint          );
+  crm_deep_copy(crm_input_pdel          , ::crm_input_pdel          );
+  crm_deep_copy(crm_input_ul            , ::crm_input_ul            );
+  crm_deep_copy(crm_input_vl            , ::crm_input_vl            );
+  crm_deep_copy(crm_input_tl            , ::crm_input_tl            );
+  crm_deep_copy(crm_input_qccl          , ::crm_input_qccl          );
+  crm_deep_copy(crm_input_qiil          , ::crm_input_qiil          );
+  crm_deep_copy(crm_input_ql            , ::crm_input_ql            );
+  crm_deep_copy(crm_input_tau00         , ::crm_input_tau00         );
+  crm_deep_copy(crm_input_ul_esmt       , ::crm_input_ul_esmt       );
+  crm_deep_copy(crm_input_vl_esmt       , ::crm_input_vl_esmt       );
+  crm_deep_copy(crm_input_t_vt         , ::crm_input_t_vt         );
+  crm_deep_copy(crm_input_q_vt         , ::crm_input_q_vt         );
+  crm_deep_copy(crm_input_u_vt         , ::crm_input_u_vt         );
+  crm_deep_copy(crm_state_u_wind        , ::crm_state_u_wind        );
+  crm_deep_copy(crm_state_v_wind        , ::crm_state_v_wind        );
+  crm_deep_copy(crm_state_w_wind        , ::crm_state_w_wind        );
+  crm_deep_copy(crm_state_temperature   , ::crm_state_temperature   );
+  crm_deep_copy(crm_state_qv            , ::crm_state_qv            );
+  crm_deep_copy(crm_state_qp            , ::crm_state_qp            );
+  crm_deep_copy(crm_state_qn            , ::crm_state_qn            );
+  crm_deep_copy(crm_rad_qrad            , ::crm_rad_qrad            );
+  crm_deep_copy(crm_output_subcycle_factor, ::crm_output_subcycle_factor);
+  crm_deep_copy(lat0                    , ::lat0                    );
+  crm_deep_copy(long0                   , ::long0                   );
+  crm_deep_copy(gcolp                   , ::gcolp                   );
+  crm_deep_copy(crm_output_cltot        , ::crm_output_cltot        );
+  crm_deep_copy(crm_output_clhgh        , ::crm_output_clhgh        );
+  crm_deep_copy(crm_output_clmed        , ::crm_output_clmed        );
+  crm_deep_copy(crm_output_cllow        , ::crm_output_cllow        );
 }
 
 
@@ -983,90 +983,90 @@ void copy_outputs(real *crm_state_u_wind_p, real *crm_state_v_wind_p, real *crm_
   realHost3d crm_output_prec_crm       = realHost3d( "crm_output_prec_crm     ",crm_output_prec_crm_p                , crm_ny    , crm_nx  , pcols);  
   realHost2d crm_clear_rh              = realHost2d( "crm_clear_rh            ",crm_clear_rh_p                                   , crm_nz  , ncrms);
 
-  crm_state_u_wind          .deep_copy_to( ::crm_state_u_wind           );
-  crm_state_v_wind          .deep_copy_to( ::crm_state_v_wind           );
-  crm_state_w_wind          .deep_copy_to( ::crm_state_w_wind           );
-  crm_state_temperature     .deep_copy_to( ::crm_state_temperature      );
-  crm_state_qv              .deep_copy_to( ::crm_state_qv               );
-  crm_state_qp              .deep_copy_to( ::crm_state_qp               );
-  crm_state_qn              .deep_copy_to( ::crm_state_qn               );
-  crm_rad_temperature       .deep_copy_to( ::crm_rad_temperature        );
-  crm_rad_qv                .deep_copy_to( ::crm_rad_qv                 );
-  crm_rad_qc                .deep_copy_to( ::crm_rad_qc                 );
-  crm_rad_qi                .deep_copy_to( ::crm_rad_qi                 );
-  crm_rad_cld               .deep_copy_to( ::crm_rad_cld                );
-  crm_output_subcycle_factor  .deep_copy_to( ::crm_output_subcycle_factor   ); 
-  crm_output_prectend       .deep_copy_to( ::crm_output_prectend        ); 
-  crm_output_precstend      .deep_copy_to( ::crm_output_precstend       ); 
-  crm_output_cld            .deep_copy_to( ::crm_output_cld             ); 
-  crm_output_cldtop         .deep_copy_to( ::crm_output_cldtop          ); 
-  crm_output_gicewp         .deep_copy_to( ::crm_output_gicewp          ); 
-  crm_output_gliqwp         .deep_copy_to( ::crm_output_gliqwp          ); 
-  crm_output_mctot          .deep_copy_to( ::crm_output_mctot           ); 
-  crm_output_mcup           .deep_copy_to( ::crm_output_mcup            ); 
-  crm_output_mcdn           .deep_copy_to( ::crm_output_mcdn            ); 
-  crm_output_mcuup          .deep_copy_to( ::crm_output_mcuup           ); 
-  crm_output_mcudn          .deep_copy_to( ::crm_output_mcudn           ); 
-  crm_output_qc_mean        .deep_copy_to( ::crm_output_qc_mean         ); 
-  crm_output_qi_mean        .deep_copy_to( ::crm_output_qi_mean         ); 
-  crm_output_qs_mean        .deep_copy_to( ::crm_output_qs_mean         ); 
-  crm_output_qg_mean        .deep_copy_to( ::crm_output_qg_mean         ); 
-  crm_output_qr_mean        .deep_copy_to( ::crm_output_qr_mean         ); 
-  crm_output_mu_crm         .deep_copy_to( ::crm_output_mu_crm          ); 
-  crm_output_md_crm         .deep_copy_to( ::crm_output_md_crm          ); 
-  crm_output_eu_crm         .deep_copy_to( ::crm_output_eu_crm          ); 
-  crm_output_du_crm         .deep_copy_to( ::crm_output_du_crm          ); 
-  crm_output_ed_crm         .deep_copy_to( ::crm_output_ed_crm          ); 
-  crm_output_flux_qt        .deep_copy_to( ::crm_output_flux_qt         ); 
-  crm_output_flux_u         .deep_copy_to( ::crm_output_flux_u          ); 
-  crm_output_flux_v         .deep_copy_to( ::crm_output_flux_v          ); 
-  crm_output_fluxsgs_qt     .deep_copy_to( ::crm_output_fluxsgs_qt      ); 
-  crm_output_tkez           .deep_copy_to( ::crm_output_tkez            ); 
-  crm_output_tkew           .deep_copy_to( ::crm_output_tkew            ); 
-  crm_output_tkesgsz        .deep_copy_to( ::crm_output_tkesgsz         ); 
-  crm_output_tkz            .deep_copy_to( ::crm_output_tkz             ); 
-  crm_output_flux_qp        .deep_copy_to( ::crm_output_flux_qp         ); 
-  crm_output_precflux       .deep_copy_to( ::crm_output_precflux        ); 
-  crm_output_qt_trans       .deep_copy_to( ::crm_output_qt_trans        ); 
-  crm_output_qp_trans       .deep_copy_to( ::crm_output_qp_trans        ); 
-  crm_output_qp_fall        .deep_copy_to( ::crm_output_qp_fall         ); 
-  crm_output_qp_evp         .deep_copy_to( ::crm_output_qp_evp          ); 
-  crm_output_qp_src         .deep_copy_to( ::crm_output_qp_src          ); 
-  crm_output_qt_ls          .deep_copy_to( ::crm_output_qt_ls           ); 
-  crm_output_t_ls           .deep_copy_to( ::crm_output_t_ls            ); 
-  crm_output_jt_crm         .deep_copy_to( ::crm_output_jt_crm          ); 
-  crm_output_mx_crm         .deep_copy_to( ::crm_output_mx_crm          ); 
-  crm_output_cltot          .deep_copy_to( ::crm_output_cltot           ); 
-  crm_output_clhgh          .deep_copy_to( ::crm_output_clhgh           ); 
-  crm_output_clmed          .deep_copy_to( ::crm_output_clmed           ); 
-  crm_output_cllow          .deep_copy_to( ::crm_output_cllow           ); 
-  crm_output_sltend         .deep_copy_to( ::crm_output_sltend          ); 
-  crm_output_qltend         .deep_copy_to( ::crm_output_qltend          ); 
-  crm_output_qcltend        .deep_copy_to( ::crm_output_qcltend         ); 
-  crm_output_qiltend        .deep_copy_to( ::crm_output_qiltend         ); 
-  crm_output_t_vt_tend      .deep_copy_to( ::crm_output_t_vt_tend       ); 
-  crm_output_q_vt_tend      .deep_copy_to( ::crm_output_q_vt_tend       ); 
-  crm_output_u_vt_tend      .deep_copy_to( ::crm_output_u_vt_tend       ); 
-  crm_output_t_vt_ls        .deep_copy_to( ::crm_output_t_vt_ls         ); 
-  crm_output_q_vt_ls        .deep_copy_to( ::crm_output_q_vt_ls         ); 
-  crm_output_u_vt_ls        .deep_copy_to( ::crm_output_u_vt_ls         ); 
-  crm_output_ultend         .deep_copy_to( ::crm_output_ultend          ); 
-  crm_output_vltend         .deep_copy_to( ::crm_output_vltend          ); 
-  crm_output_tk             .deep_copy_to( ::crm_output_tk              ); 
-  crm_output_tkh            .deep_copy_to( ::crm_output_tkh             );
-  crm_output_qcl            .deep_copy_to( ::crm_output_qcl             );
-  crm_output_qci            .deep_copy_to( ::crm_output_qci             );
-  crm_output_qpl            .deep_copy_to( ::crm_output_qpl             );
-  crm_output_qpi            .deep_copy_to( ::crm_output_qpi             );
-  crm_output_z0m            .deep_copy_to( ::crm_output_z0m             ); 
-  crm_output_taux           .deep_copy_to( ::crm_output_taux            ); 
-  crm_output_tauy           .deep_copy_to( ::crm_output_tauy            ); 
-  crm_output_precc          .deep_copy_to( ::crm_output_precc           ); 
-  crm_output_precl          .deep_copy_to( ::crm_output_precl           ); 
-  crm_output_precsc         .deep_copy_to( ::crm_output_precsc          ); 
-  crm_output_precsl         .deep_copy_to( ::crm_output_precsl          ); 
-  crm_output_prec_crm       .deep_copy_to( ::crm_output_prec_crm        );  
-  crm_clear_rh              .deep_copy_to( ::crm_clear_rh               );  
+  crm_deep_copy(crm_state_u_wind          ,  ::crm_state_u_wind           );
+  crm_deep_copy(crm_state_v_wind          ,  ::crm_state_v_wind           );
+  crm_deep_copy(crm_state_w_wind          ,  ::crm_state_w_wind           );
+  crm_deep_copy(crm_state_temperature     ,  ::crm_state_temperature      );
+  crm_deep_copy(crm_state_qv              ,  ::crm_state_qv               );
+  crm_deep_copy(crm_state_qp              ,  ::crm_state_qp               );
+  crm_deep_copy(crm_state_qn              ,  ::crm_state_qn               );
+  crm_deep_copy(crm_rad_temperature       ,  ::crm_rad_temperature        );
+  crm_deep_copy(crm_rad_qv                ,  ::crm_rad_qv                 );
+  crm_deep_copy(crm_rad_qc                ,  ::crm_rad_qc                 );
+  crm_deep_copy(crm_rad_qi                ,  ::crm_rad_qi                 );
+  crm_deep_copy(crm_rad_cld               ,  ::crm_rad_cld                );
+  crm_deep_copy(crm_output_subcycle_factor  ,  ::crm_output_subcycle_factor   ); 
+  crm_deep_copy(crm_output_prectend       ,  ::crm_output_prectend        ); 
+  crm_deep_copy(crm_output_precstend      ,  ::crm_output_precstend       ); 
+  crm_deep_copy(crm_output_cld            ,  ::crm_output_cld             ); 
+  crm_deep_copy(crm_output_cldtop         ,  ::crm_output_cldtop          ); 
+  crm_deep_copy(crm_output_gicewp         ,  ::crm_output_gicewp          ); 
+  crm_deep_copy(crm_output_gliqwp         ,  ::crm_output_gliqwp          ); 
+  crm_deep_copy(crm_output_mctot          ,  ::crm_output_mctot           ); 
+  crm_deep_copy(crm_output_mcup           ,  ::crm_output_mcup            ); 
+  crm_deep_copy(crm_output_mcdn           ,  ::crm_output_mcdn            ); 
+  crm_deep_copy(crm_output_mcuup          ,  ::crm_output_mcuup           ); 
+  crm_deep_copy(crm_output_mcudn          ,  ::crm_output_mcudn           ); 
+  crm_deep_copy(crm_output_qc_mean        ,  ::crm_output_qc_mean         ); 
+  crm_deep_copy(crm_output_qi_mean        ,  ::crm_output_qi_mean         ); 
+  crm_deep_copy(crm_output_qs_mean        ,  ::crm_output_qs_mean         ); 
+  crm_deep_copy(crm_output_qg_mean        ,  ::crm_output_qg_mean         ); 
+  crm_deep_copy(crm_output_qr_mean        ,  ::crm_output_qr_mean         ); 
+  crm_deep_copy(crm_output_mu_crm         ,  ::crm_output_mu_crm          ); 
+  crm_deep_copy(crm_output_md_crm         ,  ::crm_output_md_crm          ); 
+  crm_deep_copy(crm_output_eu_crm         ,  ::crm_output_eu_crm          ); 
+  crm_deep_copy(crm_output_du_crm         ,  ::crm_output_du_crm          ); 
+  crm_deep_copy(crm_output_ed_crm         ,  ::crm_output_ed_crm          ); 
+  crm_deep_copy(crm_output_flux_qt        ,  ::crm_output_flux_qt         ); 
+  crm_deep_copy(crm_output_flux_u         ,  ::crm_output_flux_u          ); 
+  crm_deep_copy(crm_output_flux_v         ,  ::crm_output_flux_v          ); 
+  crm_deep_copy(crm_output_fluxsgs_qt     ,  ::crm_output_fluxsgs_qt      ); 
+  crm_deep_copy(crm_output_tkez           ,  ::crm_output_tkez            ); 
+  crm_deep_copy(crm_output_tkew           ,  ::crm_output_tkew            ); 
+  crm_deep_copy(crm_output_tkesgsz        ,  ::crm_output_tkesgsz         ); 
+  crm_deep_copy(crm_output_tkz            ,  ::crm_output_tkz             ); 
+  crm_deep_copy(crm_output_flux_qp        ,  ::crm_output_flux_qp         ); 
+  crm_deep_copy(crm_output_precflux       ,  ::crm_output_precflux        ); 
+  crm_deep_copy(crm_output_qt_trans       ,  ::crm_output_qt_trans        ); 
+  crm_deep_copy(crm_output_qp_trans       ,  ::crm_output_qp_trans        ); 
+  crm_deep_copy(crm_output_qp_fall        ,  ::crm_output_qp_fall         ); 
+  crm_deep_copy(crm_output_qp_evp         ,  ::crm_output_qp_evp          ); 
+  crm_deep_copy(crm_output_qp_src         ,  ::crm_output_qp_src          ); 
+  crm_deep_copy(crm_output_qt_ls          ,  ::crm_output_qt_ls           ); 
+  crm_deep_copy(crm_output_t_ls           ,  ::crm_output_t_ls            ); 
+  crm_deep_copy(crm_output_jt_crm         ,  ::crm_output_jt_crm          ); 
+  crm_deep_copy(crm_output_mx_crm         ,  ::crm_output_mx_crm          ); 
+  crm_deep_copy(crm_output_cltot          ,  ::crm_output_cltot           ); 
+  crm_deep_copy(crm_output_clhgh          ,  ::crm_output_clhgh           ); 
+  crm_deep_copy(crm_output_clmed          ,  ::crm_output_clmed           ); 
+  crm_deep_copy(crm_output_cllow          ,  ::crm_output_cllow           ); 
+  crm_deep_copy(crm_output_sltend         ,  ::crm_output_sltend          ); 
+  crm_deep_copy(crm_output_qltend         ,  ::crm_output_qltend          ); 
+  crm_deep_copy(crm_output_qcltend        ,  ::crm_output_qcltend         ); 
+  crm_deep_copy(crm_output_qiltend        ,  ::crm_output_qiltend         ); 
+  crm_deep_copy(crm_output_t_vt_tend      ,  ::crm_output_t_vt_tend       ); 
+  crm_deep_copy(crm_output_q_vt_tend      ,  ::crm_output_q_vt_tend       ); 
+  crm_deep_copy(crm_output_u_vt_tend      ,  ::crm_output_u_vt_tend       ); 
+  crm_deep_copy(crm_output_t_vt_ls        ,  ::crm_output_t_vt_ls         ); 
+  crm_deep_copy(crm_output_q_vt_ls        ,  ::crm_output_q_vt_ls         ); 
+  crm_deep_copy(crm_output_u_vt_ls        ,  ::crm_output_u_vt_ls         ); 
+  crm_deep_copy(crm_output_ultend         ,  ::crm_output_ultend          ); 
+  crm_deep_copy(crm_output_vltend         ,  ::crm_output_vltend          ); 
+  crm_deep_copy(crm_output_tk             ,  ::crm_output_tk              ); 
+  crm_deep_copy(crm_output_tkh            ,  ::crm_output_tkh             );
+  crm_deep_copy(crm_output_qcl            ,  ::crm_output_qcl             );
+  crm_deep_copy(crm_output_qci            ,  ::crm_output_qci             );
+  crm_deep_copy(crm_output_qpl            ,  ::crm_output_qpl             );
+  crm_deep_copy(crm_output_qpi            ,  ::crm_output_qpi             );
+  crm_deep_copy(crm_output_z0m            ,  ::crm_output_z0m             ); 
+  crm_deep_copy(crm_output_taux           ,  ::crm_output_taux            ); 
+  crm_deep_copy(crm_output_tauy           ,  ::crm_output_tauy            ); 
+  crm_deep_copy(crm_output_precc          ,  ::crm_output_precc           ); 
+  crm_deep_copy(crm_output_precl          ,  ::crm_output_precl           ); 
+  crm_deep_copy(crm_output_precsc         ,  ::crm_output_precsc          ); 
+  crm_deep_copy(crm_output_precsl         ,  ::crm_output_precsl          ); 
+  crm_deep_copy(crm_output_prec_crm       ,  ::crm_output_prec_crm        );  
+  crm_deep_copy(crm_clear_rh              ,  ::crm_clear_rh               );  
 }
 
 
@@ -1179,90 +1179,90 @@ void copy_outputs_and_destroy(real *crm_state_u_wind_p, real *crm_state_v_wind_p
   realHost2d crm_clear_rh              = realHost2d( "crm_clear_rh            ",crm_clear_rh_p                                   , crm_nz  , ncrms); 
 
   // Copy to outputs
-  ::crm_state_u_wind        .deep_copy_to(crm_state_u_wind        );
-  ::crm_state_v_wind        .deep_copy_to(crm_state_v_wind        );
-  ::crm_state_w_wind        .deep_copy_to(crm_state_w_wind        );
-  ::crm_state_temperature   .deep_copy_to(crm_state_temperature   );
-  ::crm_state_qv            .deep_copy_to(crm_state_qv            );
-  ::crm_state_qp            .deep_copy_to(crm_state_qp            );
-  ::crm_state_qn            .deep_copy_to(crm_state_qn            );
-  ::crm_rad_temperature     .deep_copy_to(crm_rad_temperature     );
-  ::crm_rad_qv              .deep_copy_to(crm_rad_qv              );
-  ::crm_rad_qc              .deep_copy_to(crm_rad_qc              );
-  ::crm_rad_qi              .deep_copy_to(crm_rad_qi              );
-  ::crm_rad_cld             .deep_copy_to(crm_rad_cld             );
-  ::crm_output_subcycle_factor.deep_copy_to(crm_output_subcycle_factor);
-  ::crm_output_prectend     .deep_copy_to(crm_output_prectend     );
-  ::crm_output_precstend    .deep_copy_to(crm_output_precstend    );
-  ::crm_output_cld          .deep_copy_to(crm_output_cld          );
-  ::crm_output_cldtop       .deep_copy_to(crm_output_cldtop       );
-  ::crm_output_gicewp       .deep_copy_to(crm_output_gicewp       );
-  ::crm_output_gliqwp       .deep_copy_to(crm_output_gliqwp       );
-  ::crm_output_mctot        .deep_copy_to(crm_output_mctot        );
-  ::crm_output_mcup         .deep_copy_to(crm_output_mcup         );
-  ::crm_output_mcdn         .deep_copy_to(crm_output_mcdn         );
-  ::crm_output_mcuup        .deep_copy_to(crm_output_mcuup        );
-  ::crm_output_mcudn        .deep_copy_to(crm_output_mcudn        );
-  ::crm_output_qc_mean      .deep_copy_to(crm_output_qc_mean      );
-  ::crm_output_qi_mean      .deep_copy_to(crm_output_qi_mean      );
-  ::crm_output_qs_mean      .deep_copy_to(crm_output_qs_mean      );
-  ::crm_output_qg_mean      .deep_copy_to(crm_output_qg_mean      );
-  ::crm_output_qr_mean      .deep_copy_to(crm_output_qr_mean      );
-  ::crm_output_mu_crm       .deep_copy_to(crm_output_mu_crm       );
-  ::crm_output_md_crm       .deep_copy_to(crm_output_md_crm       );
-  ::crm_output_eu_crm       .deep_copy_to(crm_output_eu_crm       );
-  ::crm_output_du_crm       .deep_copy_to(crm_output_du_crm       );
-  ::crm_output_ed_crm       .deep_copy_to(crm_output_ed_crm       );
-  ::crm_output_flux_qt      .deep_copy_to(crm_output_flux_qt      );
-  ::crm_output_flux_u       .deep_copy_to(crm_output_flux_u       );
-  ::crm_output_flux_v       .deep_copy_to(crm_output_flux_v       );
-  ::crm_output_fluxsgs_qt   .deep_copy_to(crm_output_fluxsgs_qt   );
-  ::crm_output_tkez         .deep_copy_to(crm_output_tkez         );
-  ::crm_output_tkew         .deep_copy_to(crm_output_tkew         );
-  ::crm_output_tkesgsz      .deep_copy_to(crm_output_tkesgsz      );
-  ::crm_output_tkz          .deep_copy_to(crm_output_tkz          );
-  ::crm_output_flux_qp      .deep_copy_to(crm_output_flux_qp      );
-  ::crm_output_precflux     .deep_copy_to(crm_output_precflux     );
-  ::crm_output_qt_trans     .deep_copy_to(crm_output_qt_trans     );
-  ::crm_output_qp_trans     .deep_copy_to(crm_output_qp_trans     );
-  ::crm_output_qp_fall      .deep_copy_to(crm_output_qp_fall      );
-  ::crm_output_qp_evp       .deep_copy_to(crm_output_qp_evp       );
-  ::crm_output_qp_src       .deep_copy_to(crm_output_qp_src       );
-  ::crm_output_qt_ls        .deep_copy_to(crm_output_qt_ls        );
-  ::crm_output_t_ls         .deep_copy_to(crm_output_t_ls         );
-  ::crm_output_jt_crm       .deep_copy_to(crm_output_jt_crm       );
-  ::crm_output_mx_crm       .deep_copy_to(crm_output_mx_crm       );
-  ::crm_output_cltot        .deep_copy_to(crm_output_cltot        );
-  ::crm_output_clhgh        .deep_copy_to(crm_output_clhgh        );
-  ::crm_output_clmed        .deep_copy_to(crm_output_clmed        );
-  ::crm_output_cllow        .deep_copy_to(crm_output_cllow        );
-  ::crm_output_sltend       .deep_copy_to(crm_output_sltend       );
-  ::crm_output_qltend       .deep_copy_to(crm_output_qltend       );
-  ::crm_output_qcltend      .deep_copy_to(crm_output_qcltend      );
-  ::crm_output_qiltend      .deep_copy_to(crm_output_qiltend      );
-  ::crm_output_t_vt_tend    .deep_copy_to(crm_output_t_vt_tend    );
-  ::crm_output_q_vt_tend    .deep_copy_to(crm_output_q_vt_tend    );
-  ::crm_output_u_vt_tend    .deep_copy_to(crm_output_u_vt_tend    );
-  ::crm_output_t_vt_ls      .deep_copy_to(crm_output_t_vt_ls      );
-  ::crm_output_q_vt_ls      .deep_copy_to(crm_output_q_vt_ls      );
-  ::crm_output_u_vt_ls      .deep_copy_to(crm_output_u_vt_ls      );
-  ::crm_output_ultend       .deep_copy_to(crm_output_ultend       );
-  ::crm_output_vltend       .deep_copy_to(crm_output_vltend       );
-  ::crm_output_tk           .deep_copy_to(crm_output_tk           );
-  ::crm_output_tkh          .deep_copy_to(crm_output_tkh          );
-  ::crm_output_qcl          .deep_copy_to(crm_output_qcl          );
-  ::crm_output_qci          .deep_copy_to(crm_output_qci          );
-  ::crm_output_qpl          .deep_copy_to(crm_output_qpl          );
-  ::crm_output_qpi          .deep_copy_to(crm_output_qpi          );
-  ::crm_output_z0m          .deep_copy_to(crm_output_z0m          );
-  ::crm_output_taux         .deep_copy_to(crm_output_taux         );
-  ::crm_output_tauy         .deep_copy_to(crm_output_tauy         );
-  ::crm_output_precc        .deep_copy_to(crm_output_precc        );
-  ::crm_output_precl        .deep_copy_to(crm_output_precl        );
-  ::crm_output_precsc       .deep_copy_to(crm_output_precsc       );
-  ::crm_output_precsl       .deep_copy_to(crm_output_precsl       );
-  ::crm_output_prec_crm     .deep_copy_to(crm_output_prec_crm     );
-  ::crm_clear_rh            .deep_copy_to(crm_clear_rh            );
+  crm_deep_copy(::crm_state_u_wind        , crm_state_u_wind        );
+  crm_deep_copy(::crm_state_v_wind        , crm_state_v_wind        );
+  crm_deep_copy(::crm_state_w_wind        , crm_state_w_wind        );
+  crm_deep_copy(::crm_state_temperature   , crm_state_temperature   );
+  crm_deep_copy(::crm_state_qv            , crm_state_qv            );
+  crm_deep_copy(::crm_state_qp            , crm_state_qp            );
+  crm_deep_copy(::crm_state_qn            , crm_state_qn            );
+  crm_deep_copy(::crm_rad_temperature     , crm_rad_temperature     );
+  crm_deep_copy(::crm_rad_qv              , crm_rad_qv              );
+  crm_deep_copy(::crm_rad_qc              , crm_rad_qc              );
+  crm_deep_copy(::crm_rad_qi              , crm_rad_qi              );
+  crm_deep_copy(::crm_rad_cld             , crm_rad_cld             );
+  crm_deep_copy(::crm_output_subcycle_factor, crm_output_subcycle_factor);
+  crm_deep_copy(::crm_output_prectend     , crm_output_prectend     );
+  crm_deep_copy(::crm_output_precstend    , crm_output_precstend    );
+  crm_deep_copy(::crm_output_cld          , crm_output_cld          );
+  crm_deep_copy(::crm_output_cldtop       , crm_output_cldtop       );
+  crm_deep_copy(::crm_output_gicewp       , crm_output_gicewp       );
+  crm_deep_copy(::crm_output_gliqwp       , crm_output_gliqwp       );
+  crm_deep_copy(::crm_output_mctot        , crm_output_mctot        );
+  crm_deep_copy(::crm_output_mcup         , crm_output_mcup         );
+  crm_deep_copy(::crm_output_mcdn         , crm_output_mcdn         );
+  crm_deep_copy(::crm_output_mcuup        , crm_output_mcuup        );
+  crm_deep_copy(::crm_output_mcudn        , crm_output_mcudn        );
+  crm_deep_copy(::crm_output_qc_mean      , crm_output_qc_mean      );
+  crm_deep_copy(::crm_output_qi_mean      , crm_output_qi_mean      );
+  crm_deep_copy(::crm_output_qs_mean      , crm_output_qs_mean      );
+  crm_deep_copy(::crm_output_qg_mean      , crm_output_qg_mean      );
+  crm_deep_copy(::crm_output_qr_mean      , crm_output_qr_mean      );
+  crm_deep_copy(::crm_output_mu_crm       , crm_output_mu_crm       );
+  crm_deep_copy(::crm_output_md_crm       , crm_output_md_crm       );
+  crm_deep_copy(::crm_output_eu_crm       , crm_output_eu_crm       );
+  crm_deep_copy(::crm_output_du_crm       , crm_output_du_crm       );
+  crm_deep_copy(::crm_output_ed_crm       , crm_output_ed_crm       );
+  crm_deep_copy(::crm_output_flux_qt      , crm_output_flux_qt      );
+  crm_deep_copy(::crm_output_flux_u       , crm_output_flux_u       );
+  crm_deep_copy(::crm_output_flux_v       , crm_output_flux_v       );
+  crm_deep_copy(::crm_output_fluxsgs_qt   , crm_output_fluxsgs_qt   );
+  crm_deep_copy(::crm_output_tkez         , crm_output_tkez         );
+  crm_deep_copy(::crm_output_tkew         , crm_output_tkew         );
+  crm_deep_copy(::crm_output_tkesgsz      , crm_output_tkesgsz      );
+  crm_deep_copy(::crm_output_tkz          , crm_output_tkz          );
+  crm_deep_copy(::crm_output_flux_qp      , crm_output_flux_qp      );
+  crm_deep_copy(::crm_output_precflux     , crm_output_precflux     );
+  crm_deep_copy(::crm_output_qt_trans     , crm_output_qt_trans     );
+  crm_deep_copy(::crm_output_qp_trans     , crm_output_qp_trans     );
+  crm_deep_copy(::crm_output_qp_fall      , crm_output_qp_fall      );
+  crm_deep_copy(::crm_output_qp_evp       , crm_output_qp_evp       );
+  crm_deep_copy(::crm_output_qp_src       , crm_output_qp_src       );
+  crm_deep_copy(::crm_output_qt_ls        , crm_output_qt_ls        );
+  crm_deep_copy(::crm_output_t_ls         , crm_output_t_ls         );
+  crm_deep_copy(::crm_output_jt_crm       , crm_output_jt_crm       );
+  crm_deep_copy(::crm_output_mx_crm       , crm_output_mx_crm       );
+  crm_deep_copy(::crm_output_cltot        , crm_output_cltot        );
+  crm_deep_copy(::crm_output_clhgh        , crm_output_clhgh        );
+  crm_deep_copy(::crm_output_clmed        , crm_output_clmed        );
+  crm_deep_copy(::crm_output_cllow        , crm_output_cllow        );
+  crm_deep_copy(::crm_output_sltend       , crm_output_sltend       );
+  crm_deep_copy(::crm_output_qltend       , crm_output_qltend       );
+  crm_deep_copy(::crm_output_qcltend      , crm_output_qcltend      );
+  crm_deep_copy(::crm_output_qiltend      , crm_output_qiltend      );
+  crm_deep_copy(::crm_output_t_vt_tend    , crm_output_t_vt_tend    );
+  crm_deep_copy(::crm_output_q_vt_tend    , crm_output_q_vt_tend    );
+  crm_deep_copy(::crm_output_u_vt_tend    , crm_output_u_vt_tend    );
+  crm_deep_copy(::crm_output_t_vt_ls      , crm_output_t_vt_ls      );
+  crm_deep_copy(::crm_output_q_vt_ls      , crm_output_q_vt_ls      );
+  crm_deep_copy(::crm_output_u_vt_ls      , crm_output_u_vt_ls      );
+  crm_deep_copy(::crm_output_ultend       , crm_output_ultend       );
+  crm_deep_copy(::crm_output_vltend       , crm_output_vltend       );
+  crm_deep_copy(::crm_output_tk           , crm_output_tk           );
+  crm_deep_copy(::crm_output_tkh          , crm_output_tkh          );
+  crm_deep_copy(::crm_output_qcl          , crm_output_qcl          );
+  crm_deep_copy(::crm_output_qci          , crm_output_qci          );
+  crm_deep_copy(::crm_output_qpl          , crm_output_qpl          );
+  crm_deep_copy(::crm_output_qpi          , crm_output_qpi          );
+  crm_deep_copy(::crm_output_z0m          , crm_output_z0m          );
+  crm_deep_copy(::crm_output_taux         , crm_output_taux         );
+  crm_deep_copy(::crm_output_tauy         , crm_output_tauy         );
+  crm_deep_copy(::crm_output_precc        , crm_output_precc        );
+  crm_deep_copy(::crm_output_precl        , crm_output_precl        );
+  crm_deep_copy(::crm_output_precsc       , crm_output_precsc       );
+  crm_deep_copy(::crm_output_precsl       , crm_output_precsl       );
+  crm_deep_copy(::crm_output_prec_crm     , crm_output_prec_crm     );
+  crm_deep_copy(::crm_clear_rh            , crm_clear_rh            );
 
   // Deallocate data
   ::crm_input_bflxls          = real1d();
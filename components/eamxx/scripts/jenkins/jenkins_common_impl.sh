@@ -44,6 +44,7 @@ if [ $skip_testing -eq 0 ]; then
   v1_fail=0
   sa_fail=0
   cov_fail=0
+  geosp_fail=0
   scripts_fail=0
   memcheck_fail=0
   cd $JENKINS_SCRIPT_DIR/../..
@@ -105,6 +106,15 @@ if [ $skip_testing -eq 0 ]; then
         fi
       fi
 
+      # Add a test with single precision dycore metric terms for mappy for nightlies
+      if [[ "$SCREAM_MACHINE" == "mappy" ]]; then
+        ./scripts/gather-all-data "./scripts/test-all-scream -t geosp ${TAS_ARGS} -c SCREAM_TEST_SIZE=SHORT" -l -m $SCREAM_MACHINE
+        if [[ $? != 0 ]]; then
+          fails=$fails+1;
+          geosp_fail=1
+        fi
+      fi
+
       # Add a memcheck test for mappy/weaver for nightlies
       if [[ "$SCREAM_MACHINE" == "mappy" || "$SCREAM_MACHINE" == "weaver" ]]; then
         ./scripts/gather-all-data "./scripts/test-all-scream -t dbg --mem-check ${TAS_ARGS} -c SCREAM_TEST_SIZE=SHORT" -l -m $SCREAM_MACHINE
@@ -201,6 +211,9 @@ if [ $skip_testing -eq 0 ]; then
     if [[ $cov_fail == 1 ]]; then
       echo "SCREAM COVERAGE BUILD FAILED!"
     fi
+    if [[ $geosp_fail == 1 ]]; then
+      echo "SCREAM SINGLE PRECISION GEOMETRY TESTING FAILED!"
+    fi
     if [[ $scripts_fail == 1 ]]; then
       echo "SCREAM SCRIPTS TESTING FAILED!"
     fi
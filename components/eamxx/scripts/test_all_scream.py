@@ -125,6 +125,20 @@ class OPT(TestProperty):
             [("CMAKE_BUILD_TYPE", "Release")],
         )
 
+###############################################################################
+class GEOSP(TestProperty):
+###############################################################################
+
+    def __init__(self):
+        TestProperty.__init__(
+            self,
+            "full_debug_geo_sp",
+            "debug with single precision dycore metric terms",
+            DBG.CMAKE_ARGS + [("HOMMEXX_GEOMETRY_SINGLE_PRECISION", "True")],
+            uses_baselines=False,
+            on_by_default=False
+        )
+
 ###############################################################################
 class COV(TestProperty):
 ###############################################################################
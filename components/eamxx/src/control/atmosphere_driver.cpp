@@ -31,6 +31,26 @@ namespace scream {
 
 namespace control {
 
+namespace {
+
+// If model restart files are staged (see OutputManager), this is the
+// staging directory, where a copy of the last restart file may still live.
+std::string get_restart_staging_dir (const ekat::ParameterList& atm_params)
+{
+  if (atm_params.isSublist("Scorpio")) {
+    const auto& io_params = atm_params.sublist("Scorpio");
+    if (io_params.isSublist("model_restart")) {
+      const auto& restart_pl = io_params.sublist("model_restart");
+      if (restart_pl.isParameter("Staging Directory")) {
+        return restart_pl.get<std::string>("Staging Directory");
+      }
+    }
+  }
+  return "";
+}
+
+} // anonymous namespace
+
 /*
  * IMPORTANT: read carefully this banner before attempting any change to the initialize method!
  *
@@ -208,6 +228,7 @@ void AtmosphereDriver::create_grids()
     // Restarted run -> read geo data from restart file
     const auto& casename = ic_pl.get<std::string>("restart_casename");
     auto filename = find_filename_in_rpointer (casename,true,m_atm_comm,m_run_t0);
+    filename = find_valid_staged_copy(filename,get_restart_staging_dir(m_atm_params),m_atm_comm);
     gm_params.set("ic_filename", filename);
   } else if (ic_pl.isParameter("Filename")) {
     // Initial run, if an IC file is present, pass it.
@@ -497,6 +518,9 @@ void AtmosphereDriver::create_fields()
   // Set all the fields/groups in the processes. Input fields/groups will be handed
   // to the processes with const scalar type (const Real), to prevent them from
   // overwriting them (though, they can always cast away const...).
+  // NOTE: we retrieve fields by name, since the stored field may have a different
+  //       precision than the one requested (see FieldManager::register_field).
+  //       The atm procs take care of converting at their boundaries.
   // IMPORTANT: set all computed fields/groups first, since the AtmProcGroup class
   // needs to inspect those before deciding whether a required group is indeed
   // required or not. E.g., in AtmProcGroup [A, B], if A computes group "blah" (or all
@@ -505,7 +529,7 @@ void AtmosphereDriver::create_fields()
   for (const auto& req : m_atm_process_group->get_computed_field_requests()) {
     const auto& fid = req.fid;
     auto fm = get_field_mgr(fid.get_grid_name());
-    m_atm_process_group->set_computed_field(fm->get_field(fid));
+    m_atm_process_group->set_computed_field(fm->get_field(fid.name()));
   }
   for (const auto& it : m_atm_process_group->get_computed_group_requests()) {
     auto fm = get_field_mgr(it.grid);
@@ -520,7 +544,7 @@ void AtmosphereDriver::create_fields()
   for (const auto& req : m_atm_process_group->get_required_field_requests()) {
     const auto& fid = req.fid;
     auto fm = get_field_mgr(fid.get_grid_name());
-    m_atm_process_group->set_required_field(fm->get_field(fid).get_const());
+    m_atm_process_group->set_required_field(fm->get_field(fid.name()).get_const());
   }
 
   // Now that all processes have all the required/computed fields/groups, they
@@ -692,6 +716,7 @@ void AtmosphereDriver::restart_model ()
   // First, figure out the name of the netcdf file containing the restart data
   const auto& casename = m_atm_params.sublist("initial_conditions").get<std::string>("restart_casename");
   auto filename = find_filename_in_rpointer (casename,true,m_atm_comm,m_run_t0);
+  filename = find_valid_staged_copy(filename,get_restart_staging_dir(m_atm_params),m_atm_comm);
 
   // Restart the num steps counter in the atm time stamp
   ekat::ParameterList rest_pl;
@@ -1188,6 +1213,17 @@ void AtmosphereDriver::initialize_atm_procs ()
     m_field_mgrs.erase(gn);
   }
 
+  // If user requests it, take periodic snapshots of the timers during the run
+  auto& driver_options_pl = m_atm_params.sublist("driver_options");
+  m_timer_snapshots_freq = driver_options_pl.get<int>("timer_snapshots_frequency",0);
+  EKAT_REQUIRE_MSG (m_timer_snapshots_freq>=0,
+      "Error! Invalid value for 'timer_snapshots_frequency': " + std::to_string(m_timer_snapshots_freq) + "\n");
+  if (m_timer_snapshots_freq>0) {
+    const auto fname = driver_options_pl.get<std::string>("timer_snapshots_file","scream_timing_snapshots.csv");
+    const auto per_rank = driver_options_pl.get<bool>("timer_snapshots_per_rank",false);
+    m_timer_snapshots = std::make_shared<TimerSnapshots>(m_atm_comm,fname,per_rank);
+  }
+
   m_ad_status |= s_procs_inited;
 
   stop_timer("EAMxx::initialize_atm_procs");
@@ -1265,6 +1301,13 @@ void AtmosphereDriver::run (const int dt) {
   m_atm_logger->flush();
 
   stop_timer("EAMxx::run");
+
+  // Take a snapshot of the timers, if requested. Do it after stopping the run timer,
+  // so that the EAMxx::run time is up to date.
+  const int nsteps = m_current_ts.get_num_steps();
+  if (m_timer_snapshots && nsteps%m_timer_snapshots_freq==0) {
+    m_timer_snapshots->snapshot(nsteps);
+  }
 }
 
 void AtmosphereDriver::finalize ( /* inputs? */ ) {
@@ -1297,6 +1340,8 @@ void AtmosphereDriver::finalize ( /* inputs? */ ) {
     it.second->clean_up();
   }
 
+  m_timer_snapshots = nullptr;
+
   // Write all timers to file, and possibly finalize gptl
   if (not m_gptl_externally_handled) {
     write_timers_to_file (m_atm_comm,"scream_timing.txt");
@@ -5,6 +5,7 @@
 #include "share/field/field_manager.hpp"
 #include "share/grid/grids_manager.hpp"
 #include "share/util/scream_time_stamp.hpp"
+#include "share/util/scream_timing.hpp"
 #include "share/scream_types.hpp"
 #include "share/io/scream_output_manager.hpp"
 #include "share/io/scorpio_input.hpp"
@@ -16,6 +17,7 @@
 #include "ekat/ekat_parameter_list.hpp"
 
 #include <memory>
+#include <list>
 
 namespace scream {
 
@@ -227,6 +229,10 @@ protected:
   // Whether GPTL must be finalized by the AD (in certain standalone runs)
   bool m_gptl_externally_handled;
 
+  // Periodic timer snapshots (if requested), taken every m_timer_snapshots_freq steps
+  std::shared_ptr<TimerSnapshots>           m_timer_snapshots;
+  int                                       m_timer_snapshots_freq = 0;
+
   // Current ad initialization status
   int m_ad_status = 0;
 
@@ -5,7 +5,7 @@ namespace scream
 
 // =========================================================================================
 MeridionalVapFluxDiagnostic::MeridionalVapFluxDiagnostic (const ekat::Comm& comm, const ekat::ParameterList& params)
-  : AtmosphereDiagnostic(comm,params)
+  : ColumnIntegralDiagnostic(comm,params)
 {
   // Nothing to do here
 }
@@ -45,36 +45,9 @@ void MeridionalVapFluxDiagnostic::set_grids(const std::shared_ptr<const GridsMan
   auto& C_ap = m_diagnostic_output.get_header().get_alloc_properties();
   C_ap.request_allocation();
   m_diagnostic_output.allocate_view();
-}
-// =========================================================================================
-void MeridionalVapFluxDiagnostic::compute_diagnostic_impl()
-{
-
-  using PC         = scream::physics::Constants<Real>;
-  constexpr Real gravit = PC::gravit;
-  const auto npacks                     = ekat::npack<Pack>(m_num_levs);
-  const auto default_policy             = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, npacks);
-  const auto& qv_vert_integrated_flux_v = m_diagnostic_output.get_view<Real*>();
-  const auto& qv_mid                    = get_field_in("qv").get_view<const Pack**>();
-  const auto& pseudo_density_mid        = get_field_in("pseudo_density").get_view<const Pack**>();
-  const auto& horiz_winds               = get_field_in("horiz_winds").get_view<const Pack***>();
-
-  const auto num_levs = m_num_levs;
-  Kokkos::parallel_for("MeridionalVapFluxDiagnostic",
-                       default_policy,
-                       KOKKOS_LAMBDA(const MemberType& team) {
-    const int icol = team.league_rank();
-    Kokkos::parallel_reduce(Kokkos::TeamVectorRange(team, num_levs), [&] (const Int& idx, Real& lsum) {
-      const int jpack = idx / Pack::n;
-      const int klev  = idx % Pack::n;
-      // Note, horiz_winds contains u (index 0) and v (index 1).  Here we want v
-      lsum += horiz_winds(icol,1,jpack)[klev] * qv_mid(icol,jpack)[klev] * pseudo_density_mid(icol,jpack)[klev]/gravit;
-    },qv_vert_integrated_flux_v(icol));
-    team.team_barrier();
-  });
 
-  const auto ts = get_field_in("qv").get_header().get_tracking().get_time_stamp();
-  m_diagnostic_output.get_header().get_tracking().update_time_stamp(ts);
+  // Note, horiz_winds contains u (index 0) and v (index 1).
+  set_integrand({{"horiz_winds",1},{"qv"}});
 }
 // =========================================================================================
 } //namespace scream
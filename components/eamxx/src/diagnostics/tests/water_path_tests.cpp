@@ -457,6 +457,30 @@ void run(std::mt19937_64& engine)
         REQUIRE(rwp_h(icol) == (icol+1)*num_levs*(num_levs+1)/2);
       }
     }
+    // Test 6: Computing all the water paths in one group (as done in output streams)
+    //         gives the same results as computing them one at a time.
+    {
+      ekat::genRandArray(dview_as_real(pseudo_density), engine, pdf_pseudodens);
+      Kokkos::deep_copy(ekat::subview(pseudo_dens_v,0),pseudo_density);
+
+      std::vector<std::shared_ptr<ColumnIntegralDiagnostic>> group;
+      for (const auto& dd : diags) {
+        auto col_int = std::dynamic_pointer_cast<ColumnIntegralDiagnostic>(dd.second);
+        REQUIRE (col_int!=nullptr);
+        group.push_back(col_int);
+      }
+      ColumnIntegralDiagnostic::compute_grouped(group);
+      std::map<std::string,Field> grouped;
+      for (const auto& dd : diags) {
+        dd.second->compute_diagnostic();
+        grouped.emplace(dd.first,dd.second->get_diagnostic().clone());
+      }
+
+      for (const auto& dd : diags) {
+        dd.second->compute_diagnostic();
+        REQUIRE (views_are_equal(dd.second->get_diagnostic(),grouped.at(dd.first)));
+      }
+    }
 
   }
  
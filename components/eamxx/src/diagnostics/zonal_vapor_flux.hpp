@@ -1,7 +1,7 @@
 #ifndef EAMXX_ZONAL_VAPOR_FLUX_DIAGNOSTIC_HPP
 #define EAMXX_ZONAL_VAPOR_FLUX_DIAGNOSTIC_HPP
 
-#include "share/atm_process/atmosphere_diagnostic.hpp"
+#include "share/atm_process/column_integral_diagnostic.hpp"
 #include "share/util/scream_common_physics_functions.hpp"
 #include "ekat/kokkos/ekat_subview_utils.hpp"
 
@@ -12,7 +12,7 @@ namespace scream
  * This diagnostic will produce the zonal water vapor flux.
  */
 
-class ZonalVapFluxDiagnostic : public AtmosphereDiagnostic
+class ZonalVapFluxDiagnostic : public ColumnIntegralDiagnostic
 {
 public:
   using Pack          = ekat::Pack<Real,SCREAM_PACK_SIZE>;
@@ -33,17 +33,6 @@ public:
   // Set the grid
   void set_grids (const std::shared_ptr<const GridsManager> grids_manager);
 
-protected:
-#ifdef KOKKOS_ENABLE_CUDA
-public:
-#endif
-  void compute_diagnostic_impl ();
-protected:
-
-  // Keep track of field dimensions
-  Int m_num_cols;
-  Int m_num_levs;
-
 }; // class VapWaterPathDiagnostic
 
 } //namespace scream
@@ -0,0 +1,117 @@
+#include "share/scream_types.hpp"
+#include "share/scream_session.hpp"
+
+#include "physics/share/tests/physics_bench_common.hpp"
+
+#include "p3_main_wrap.hpp"
+#include "p3_functions_f90.hpp"
+#include "p3_ic_cases.hpp"
+
+#include <vector>
+
+namespace {
+using namespace scream;
+using namespace scream::p3;
+namespace phys_bench = scream::physics::bench;
+
+/*
+ * p3_bench is a throughput benchmark for p3_main. For each requested number
+ * of columns, it synthesizes a column state with the same initial condition
+ * generator used by p3_run_and_cmp (ic::Factory::mixed), runs p3_main for
+ * a number of steps, and repeats the whole thing a number of times (after one
+ * "cold" run, which is not timed). Only the p3_main call is timed (as returned
+ * by p3_main_wrap), so host-device copies and transposes are excluded.
+ *
+ * See physics_bench_common.hpp for the report.
+ */
+
+struct Bench {
+  phys_bench::Options opts;
+  bool predict_nc, prescribed_ccn;
+
+  void print_config () const {
+    std::cout << "P3 benchmark on " << DefaultDevice::execution_space::name()
+              << ": nk=" << opts.nlev << ", dt=" << opts.dt << ", ts=" << opts.nsteps
+              << ", repeat=" << opts.repeat
+              << ", predict_nc=" << predict_nc
+              << ", prescribed_CCN=" << prescribed_ccn
+              << ", packn=" << SCREAM_PACK_SIZE
+              << ", small_packn=" << SCREAM_SMALL_PACK_SIZE
+              << ", sizeof(Real)=" << sizeof(Real) << "\n";
+  }
+
+  void run (const Int ncol) const {
+    Int duration = 0;
+    Real bytes_per_step = 0;
+    for (Int r = -1; r < opts.repeat; ++r) {
+      const auto d = ic::Factory::create(ic::Factory::mixed, ncol, opts.nlev);
+      d->dt                = opts.dt;
+      d->it                = opts.nsteps;
+      d->do_predict_nc     = predict_nc;
+      d->do_prescribed_CCN = prescribed_ccn;
+
+      if (r == -1) {
+        bytes_per_step = phys_bench::compulsory_bytes<FortranDataIterator>(d);
+      }
+
+      for (Int it = 0; it < opts.nsteps; ++it) {
+        const Int current_microsec = p3_main_wrap(*d);
+        if (r != -1) { // do not count the "cold" run
+          duration += current_microsec;
+        }
+      }
+    }
+
+    const double time_per_step = 1e-6*duration / (opts.repeat*opts.nsteps);
+    phys_bench::print_row(ncol, time_per_step, bytes_per_step);
+  }
+};
+
+} // namespace anon
+
+int main (int argc, char** argv) {
+  Bench bench;
+  bench.opts.nsteps = 6;
+  bench.opts.dt = 300;
+  bench.predict_nc = true;
+  bench.prescribed_ccn = false;
+
+  if (argc > 1 && ekat::argv_matches(argv[1], "-h", "--help")) {
+    std::cout <<
+      argv[0] << " [options]\n"
+      "Options:\n" <<
+      phys_bench::common_help(bench.opts) <<
+      "  -p <predict_nc>     yes|no. Default=yes.\n"
+      "  -c <prescribed_ccn> yes|no. Default=no.\n";
+    return 0;
+  }
+
+  for (int i = 1; i < argc; ++i) {
+    if (phys_bench::parse_common_arg(i, argc, argv, bench.opts)) {
+      continue;
+    }
+    if (ekat::argv_matches(argv[i], "-p", "--predict-nc")) {
+      phys_bench::expect_another_arg(i, argc);
+      ++i;
+      bench.predict_nc = phys_bench::parse_yes_no(argv[i], "Predict");
+    }
+    if (ekat::argv_matches(argv[i], "-c", "--prescribed-ccn")) {
+      phys_bench::expect_another_arg(i, argc);
+      ++i;
+      bench.prescribed_ccn = phys_bench::parse_yes_no(argv[i], "Prescribed CCN");
+    }
+  }
+  phys_bench::check_options(bench.opts);
+
+  scream::initialize_scream_session(argc, argv); {
+    p3_init();
+    bench.print_config();
+    phys_bench::print_header();
+    for (const auto ncol : bench.opts.ncols) {
+      bench.run(ncol);
+    }
+    P3GlobalForFortran::deinit();
+  } scream::finalize_scream_session();
+
+  return 0;
+}
@@ -6,6 +6,9 @@
 #include "YAKL.h"
 #include "YAKL_Bounds_fortran.h"
 
+#include <cstdint>
+#include <limits>
+
 namespace scream {
     namespace rrtmgp {
 
@@ -53,6 +56,33 @@ namespace scream {
         }
 
 
+        // Counter-based pseudo-random number in [0,1), using the Philox-2x32-10
+        // bijection (Salmon et al. 2011, "Parallel random numbers: as easy as 1, 2, 3").
+        // The result depends only on (key, ctr0, ctr1), and not on any generator state,
+        // so random numbers can be produced on the fly inside a kernel, in any order,
+        // and are the same regardless of how columns are distributed across ranks/chunks.
+        YAKL_INLINE Real philox_uniform(const uint32_t key, const uint32_t ctr0, const uint32_t ctr1) {
+            constexpr uint32_t mult  = 0xD256D347u;
+            constexpr uint32_t bump  = 0x9E3779B9u;
+            uint32_t x0 = ctr0;
+            uint32_t x1 = ctr1;
+            uint32_t k  = key;
+            for (int round = 0; round < 10; ++round) {
+                const uint64_t prod = static_cast<uint64_t>(mult) * x0;
+                const uint32_t hi = static_cast<uint32_t>(prod >> 32);
+                const uint32_t lo = static_cast<uint32_t>(prod);
+                x0 = hi ^ k ^ x1;
+                x1 = lo;
+                k += bump;
+            }
+            // Keep only as many of the 64 generated bits as Real has mantissa bits (24 in
+            // single, 53 in double precision), so that the conversion is exact, and the
+            // result is strictly less than 1 (rounding could otherwise give exactly 1).
+            constexpr int nbits = std::numeric_limits<Real>::digits;
+            const uint64_t bits = ((static_cast<uint64_t>(x0) << 32) | x1) >> (64 - nbits);
+            return static_cast<Real>(bits) * (Real(1) / static_cast<Real>(uint64_t(1) << nbits));
+        }
+
         // Verify that array only contains values within valid range, and if not
         // report min and max of array
         template <class T> bool check_range(T x, Real xmin, Real xmax, std::string msg, std::ostream& out=std::cout) {
@@ -360,11 +360,12 @@ namespace scream {
             //     c(i,j,k) = 0 for x(i,j,k) <= 1 - cldf(i,j)
             //
             // I am going to call this "cldx" to be just slightly less ambiguous
-            auto cldx = real3d("cldx", ncol, nlay, ngpt);
 
             // Apply overlap assumption to set cldx
             if (overlap_option == 0) {  // Dummy mask, always cloudy
-                memset(cldx, 1);
+                parallel_for(SimpleBounds<3>(ngpt,nlay,ncol), YAKL_LAMBDA(int igpt, int ilay, int icol) {
+                    subcolumn_mask(icol,ilay,igpt) = cldf(icol,ilay) > 0 ? 1 : 0;
+                });
             } else {  // Default case, maximum-random overlap
                 // Maximum-random overlap:
                 // Uses essentially the algorithm described in eq (14) in Raisanen et al. 2004,
@@ -372,43 +373,33 @@ namespace scream {
                 // algorithm used in RRTMG implementation of maximum-random overlap (see
                 // https://github.com/AER-RC/RRTMG_SW/blob/master/src/mcica_subcol_gen_sw.f90)
                 //
-                // First, fill cldx with random numbers. Need to use a unique seed for each column!
-                parallel_for(SimpleBounds<1>(ncol), YAKL_LAMBDA(int icol) {
-                    yakl::Random rand(seeds(icol));
-                    for (int igpt = 1; igpt <= ngpt; igpt++) {
-                        for (int ilay = 1; ilay <= nlay; ilay++) {
-                            cldx(icol,ilay,igpt) = rand.genFP<Real>();
-                        }
-                    }
-                });
-                // Step down columns and apply algorithm from eq (14)
+                // Random numbers are generated on the fly with a counter-based generator, keyed
+                // on the column seed and with (layer,gpoint) as counter, so we never store the
+                // full (ncol,nlay,ngpt) random field. Need to use a unique seed for each column!
                 parallel_for(SimpleBounds<2>(ngpt,ncol), YAKL_LAMBDA(int igpt, int icol) {
+                    const uint32_t key = seeds(icol);
+                    // Step down columns and apply algorithm from eq (14)
+                    Real cldx = philox_uniform(key, 1, igpt);
+                    subcolumn_mask(icol,1,igpt) = cldx > 1.0 - cldf(icol,1) ? 1 : 0;
                     for (int ilay = 2; ilay <= nlay; ilay++) {
                         // Check cldx in level above and see if it satisfies conditions to create a cloudy subcolumn
-                        if (cldx(icol,ilay-1,igpt) > 1.0 - cldf(icol,ilay-1)) {
-                            // Cloudy subcolumn above, use same random number here so that clouds in these two adjacent
-                            // layers are maximimally overlapped
-                            cldx(icol,ilay,igpt) = cldx(icol,ilay-1,igpt);
-                        } else {
+                        if (cldx <= 1.0 - cldf(icol,ilay-1)) {
                             // Cloud-less above, use new random number so that clouds are distributed
                             // randomly in this layer. Need to scale new random number to range
                             // [0, 1.0 - cldf(ilay-1)] because we have artifically changed the distribution
-                            // of random numbers in this layer with the above branch of the conditional,
+                            // of random numbers in this layer with the branch below,
                             // which would otherwise inflate cloud fraction in this layer.
-                            cldx(icol,ilay,igpt) = cldx(icol,ilay  ,igpt) * (1.0 - cldf(icol,ilay-1));
+                            cldx = philox_uniform(key, ilay, igpt) * (1.0 - cldf(icol,ilay-1));
                         }
+                        // Otherwise, cloudy subcolumn above: keep the same random number here so that
+                        // clouds in these two adjacent layers are maximimally overlapped
+
+                        // Use cldx to set the subcolumn mask
+                        subcolumn_mask(icol,ilay,igpt) = cldx > 1.0 - cldf(icol,ilay) ? 1 : 0;
                     }
                 });
             }
 
-            // Use cldx array to create subcolumn mask
-            parallel_for(SimpleBounds<3>(ngpt,nlay,ncol), YAKL_LAMBDA(int igpt, int ilay, int icol) {
-                if (cldx(icol,ilay,igpt) > 1.0 - cldf(icol,ilay)) {
-                    subcolumn_mask(icol,ilay,igpt) = 1;
-                } else {
-                    subcolumn_mask(icol,ilay,igpt) = 0;
-                }
-            });
             return subcolumn_mask;
         }
 
@@ -514,6 +514,41 @@ TEST_CASE("rrtmgp_test_subcol_gen") {
             }
         }
     }
+
+    // Random numbers only depend on the column seed (not on the column index or on
+    // the number of columns), so columns with the same seed and cloud fraction must
+    // get the same mask, regardless of how columns are chunked
+    {
+        const int ncol3 = 3;
+        auto cldfrac3 = real2d("cldfrac3", ncol3, nlay);
+        auto seeds3 = int1d("seeds3", ncol3);
+        auto seeds1 = int1d("seeds1", 1);
+        yakl::fortran::parallel_for(yakl::fortran::SimpleBounds<2>(nlay,ncol3), YAKL_LAMBDA(int ilay, int icol) {
+            cldfrac3(icol,ilay) = 0.2*ilay;
+        });
+        yakl::fortran::parallel_for(1, YAKL_LAMBDA(int /* dummy */) {
+            seeds3(1) = 7;
+            seeds3(2) = 11;
+            seeds3(3) = 7;
+            seeds1(1) = 11;
+        });
+        auto cldmask3 = scream::rrtmgp::get_subcolumn_mask(ncol3, nlay, ngpt, cldfrac3, 1, seeds3).createHostCopy();
+        auto cldmask1 = scream::rrtmgp::get_subcolumn_mask(1, nlay, ngpt, cldfrac3, 1, seeds1).createHostCopy();
+        for (int ilay = 1; ilay <= nlay; ilay++) {
+            for (int igpt = 1; igpt <= ngpt; igpt++) {
+                REQUIRE(cldmask3(1,ilay,igpt) == cldmask3(3,ilay,igpt));
+                REQUIRE(cldmask3(2,ilay,igpt) == cldmask1(1,ilay,igpt));
+            }
+        }
+        cldfrac3.deallocate();
+    }
+
+    // Random numbers must be in [0,1), also when Real is single precision
+    for (uint32_t ctr = 0; ctr < 100000; ctr++) {
+        const auto r = scream::rrtmgp::philox_uniform(7, ctr, ctr % 112);
+        REQUIRE(r >= 0);
+        REQUIRE(r < 1);
+    }
     // Clean up after test
     cldfrac.deallocate();
     cldmask.deallocate();
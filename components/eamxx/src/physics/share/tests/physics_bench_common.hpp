@@ -0,0 +1,127 @@
+#ifndef PHYSICS_BENCH_COMMON_HPP
+#define PHYSICS_BENCH_COMMON_HPP
+
+#include "share/scream_types.hpp"
+
+#include "ekat/util/ekat_test_utils.hpp"
+#include "ekat/util/ekat_string_utils.hpp"
+#include "ekat/ekat_assert.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace scream {
+namespace physics {
+namespace bench {
+
+/*
+ * Harness shared by the physics throughput benchmarks (p3_bench, shoc_bench).
+ *
+ * A benchmark times its parametrization's main function on synthetic column
+ * states, for a list of column counts, and reports
+ *  - columns/s: number of columns advanced by one step per second;
+ *  - GB/s: the compulsory state traffic per step over the time per step.
+ *
+ * The compulsory traffic assumes each input/output array is read and written
+ * once per step. No flop rates are reported: the kernels' flop counts are not
+ * known (they depend on which processes are active), and would need to be
+ * measured with hardware counters (e.g., with a profiler) rather than guessed.
+ */
+
+struct Options {
+  std::vector<Int> ncols = {1, 8, 64, 512};
+  Int  nlev   = 72;
+  Int  nsteps = 1;
+  Int  repeat = 10;
+  Real dt     = 300;
+};
+
+inline void expect_another_arg (int i, int argc) {
+  EKAT_REQUIRE_MSG(i != argc-1, "Expected another cmd-line arg.");
+}
+
+inline bool parse_yes_no (const std::string& v, const std::string& opt_name) {
+  EKAT_REQUIRE_MSG(v == "yes" || v == "no", opt_name + " option value must be one of yes|no");
+  return v == "yes";
+}
+
+// Help lines for the options handled by parse_common_arg
+inline std::string common_help (const Options& defaults) {
+  std::string ncols;
+  for (const auto n : defaults.ncols) {
+    ncols += (ncols.empty() ? "" : ",") + std::to_string(n);
+  }
+  return
+    "  -i <cols>           Comma-separated list of number of columns. Default=" + ncols + ".\n"
+    "  -k <nlev>           Number of vertical levels. Default=" + std::to_string(defaults.nlev) + ".\n"
+    "  -s <steps>          Number of timesteps. Default=" + std::to_string(defaults.nsteps) + ".\n"
+    "  -dt <seconds>       Length of timestep. Default=" + std::to_string(static_cast<int>(defaults.dt)) + ".\n"
+    "  -r <repeat>         Number of timed repetitions. Default=" + std::to_string(defaults.repeat) + ".\n";
+}
+
+// If argv[i] is one of the common options, store its value in opts, advance i
+// past the value, and return true. Otherwise, return false.
+inline bool parse_common_arg (int& i, int argc, char** argv, Options& opts) {
+  if (ekat::argv_matches(argv[i], "-i", "--ncol")) {
+    expect_another_arg(i, argc);
+    ++i;
+    opts.ncols.clear();
+    for (const auto& s : ekat::split(std::string(argv[i]),',')) {
+      opts.ncols.push_back(std::stoi(s));
+    }
+  } else if (ekat::argv_matches(argv[i], "-k", "--nlev")) {
+    expect_another_arg(i, argc);
+    ++i;
+    opts.nlev = std::atoi(argv[i]);
+  } else if (ekat::argv_matches(argv[i], "-s", "--steps")) {
+    expect_another_arg(i, argc);
+    ++i;
+    opts.nsteps = std::atoi(argv[i]);
+  } else if (ekat::argv_matches(argv[i], "-dt", "--dt")) {
+    expect_another_arg(i, argc);
+    ++i;
+    opts.dt = std::atof(argv[i]);
+  } else if (ekat::argv_matches(argv[i], "-r", "--repeat")) {
+    expect_another_arg(i, argc);
+    ++i;
+    opts.repeat = std::atoi(argv[i]);
+  } else {
+    return false;
+  }
+  return true;
+}
+
+inline void check_options (const Options& opts) {
+  EKAT_REQUIRE_MSG(opts.repeat > 0 && opts.nsteps > 0,
+                   "Error! Number of repetitions and of steps must be positive.\n");
+}
+
+// Bytes read and written once per step for all the arrays of a test data struct d
+// (p3::FortranData, shoc::FortranData), as listed by the matching FortranDataIterator.
+template <typename FortranDataIterator, typename FortranDataPtr>
+Real compulsory_bytes (const FortranDataPtr& d) {
+  Real bytes = 0;
+  FortranDataIterator fdi(d);
+  for (Int i = 0, n = fdi.nfield(); i < n; ++i) {
+    bytes += 2*fdi.getfield(i).size*sizeof(Real);
+  }
+  return bytes;
+}
+
+inline void print_header () {
+  printf("%8s %12s %12s %10s\n", "ncol", "s/step", "columns/s", "GB/s");
+}
+
+inline void print_row (const Int ncol, const double time_per_step, const double bytes_per_step) {
+  const double gbs = 1e-9*bytes_per_step / time_per_step;
+  printf("%8d %12.3e %12.3e %10.3f\n", ncol, time_per_step, ncol/time_per_step, gbs);
+}
+
+} // namespace bench
+} // namespace physics
+} // namespace scream
+
+#endif // PHYSICS_BENCH_COMMON_HPP
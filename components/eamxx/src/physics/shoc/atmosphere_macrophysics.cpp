@@ -6,6 +6,8 @@
 
 #include "scream_config.h" // for SCREAM_CIME_BUILD
 
+#include <limits>
+
 namespace scream
 {
 
@@ -16,6 +18,16 @@ SHOCMacrophysics::SHOCMacrophysics (const ekat::Comm& comm,const ekat::Parameter
   /* Anything that can be initialized without grid information can be initialized here.
    * Like universal constants, shoc options.
    */
+
+  // Kernel mode for shoc_main: small or big (monolithic) kernels, the default
+  // one for this build (see SCREAM_SMALL_KERNELS), or the fastest one (auto)
+  const auto kernel_mode = m_params.get<std::string>("kernel_mode","default");
+  EKAT_REQUIRE_MSG (kernel_mode=="default" || kernel_mode=="small" ||
+                    kernel_mode=="big" || kernel_mode=="auto",
+      "Error! Invalid kernel_mode for SHOC. Valid values: default, small, big, auto.\n"
+      "   - kernel_mode: " + kernel_mode + "\n");
+  m_small_kernels = kernel_mode=="small" || (kernel_mode!="big" && SHF::default_small_kernels);
+  m_select_kernel_mode = kernel_mode=="auto";
 }
 
 // =========================================================================================
@@ -155,11 +167,9 @@ void SHOCMacrophysics::init_buffers(const ATMBufferManager &buffer_manager)
   using scalar_view_t = decltype(m_buffer.cell_length);
   scalar_view_t* _1d_scalar_view_ptrs[Buffer::num_1d_scalar_ncol] =
     {&m_buffer.cell_length, &m_buffer.wpthlp_sfc, &m_buffer.wprtp_sfc, &m_buffer.upwp_sfc, &m_buffer.vpwp_sfc
-#ifdef SCREAM_SMALL_KERNELS
      , &m_buffer.se_b, &m_buffer.ke_b, &m_buffer.wv_b, &m_buffer.wl_b
      , &m_buffer.se_a, &m_buffer.ke_a, &m_buffer.wv_a, &m_buffer.wl_a
      , &m_buffer.ustar, &m_buffer.kbfs, &m_buffer.obklen, &m_buffer.ustar2, &m_buffer.wstar
-#endif
     };
   for (int i = 0; i < Buffer::num_1d_scalar_ncol; ++i) {
     *_1d_scalar_view_ptrs[i] = scalar_view_t(mem, m_num_cols);
@@ -180,19 +190,14 @@ void SHOCMacrophysics::init_buffers(const ATMBufferManager &buffer_manager)
   spack_2d_view_t* _2d_spack_mid_view_ptrs[Buffer::num_2d_vector_mid] = {
     &m_buffer.z_mid, &m_buffer.rrho, &m_buffer.thv, &m_buffer.dz, &m_buffer.zt_grid, &m_buffer.wm_zt,
     &m_buffer.inv_exner, &m_buffer.thlm, &m_buffer.qw, &m_buffer.dse, &m_buffer.tke_copy, &m_buffer.qc_copy,
-    &m_buffer.shoc_ql2, &m_buffer.shoc_mix, &m_buffer.isotropy, &m_buffer.w_sec, &m_buffer.wqls_sec, &m_buffer.brunt
-#ifdef SCREAM_SMALL_KERNELS
-    , &m_buffer.rho_zt, &m_buffer.shoc_qv, &m_buffer.dz_zt, &m_buffer.tkh
-#endif
+    &m_buffer.shoc_ql2, &m_buffer.shoc_mix, &m_buffer.isotropy, &m_buffer.w_sec, &m_buffer.wqls_sec, &m_buffer.brunt,
+    &m_buffer.rho_zt, &m_buffer.shoc_qv, &m_buffer.dz_zt, &m_buffer.tkh
   };
 
   spack_2d_view_t* _2d_spack_int_view_ptrs[Buffer::num_2d_vector_int] = {
     &m_buffer.z_int, &m_buffer.rrho_i, &m_buffer.zi_grid, &m_buffer.thl_sec, &m_buffer.qw_sec,
     &m_buffer.qwthl_sec, &m_buffer.wthl_sec, &m_buffer.wqw_sec, &m_buffer.wtke_sec, &m_buffer.uw_sec,
-    &m_buffer.vw_sec, &m_buffer.w3
-#ifdef SCREAM_SMALL_KERNELS
-    , &m_buffer.dz_zi
-#endif
+    &m_buffer.vw_sec, &m_buffer.w3, &m_buffer.dz_zi
   };
 
   for (int i = 0; i < Buffer::num_2d_vector_mid; ++i) {
@@ -363,7 +368,6 @@ void SHOCMacrophysics::initialize_impl (const RunType run_type)
   history_output.wqls_sec  = m_buffer.wqls_sec;
   history_output.brunt     = m_buffer.brunt;
 
-#ifdef SCREAM_SMALL_KERNELS
   temporaries.se_b = m_buffer.se_b;
   temporaries.ke_b = m_buffer.ke_b;
   temporaries.wv_b = m_buffer.wv_b;
@@ -383,7 +387,6 @@ void SHOCMacrophysics::initialize_impl (const RunType run_type)
   temporaries.dz_zt = m_buffer.dz_zt;
   temporaries.dz_zi = m_buffer.dz_zi;
   temporaries.tkh = m_buffer.tkh;
-#endif
 
   shoc_postprocess.set_variables(m_num_cols,m_num_levs,m_num_tracers,convert_wet_dry_idx_d,
                                  rrho,qv,qw,qc,qc_copy,tke,tke_copy,qtracers,shoc_ql2,
@@ -437,6 +440,12 @@ void SHOCMacrophysics::initialize_impl (const RunType run_type)
   const int ntop_shoc = 0;
   const int nbot_shoc = m_num_levs;
   m_npbl = SHF::shoc_init(nbot_shoc,ntop_shoc,pref_mid);
+
+  if (m_select_kernel_mode) {
+    m_atm_logger->info("[SHOC] kernel mode: auto (selected during the first run)");
+  } else {
+    m_atm_logger->info("[SHOC] kernel mode: " + std::string(m_small_kernels ? "small" : "big") + " kernels");
+  }
 }
 
 // =========================================================================================
@@ -467,12 +476,13 @@ void SHOCMacrophysics::run_impl (const double dt)
   workspace_mgr.reset_internals();
 
   // Run shoc main
-  SHF::shoc_main(m_num_cols, m_num_levs, m_num_levs+1, m_npbl, m_nadv, m_num_tracers, dt,
-                 workspace_mgr,input,input_output,output,history_output
-#ifdef SCREAM_SMALL_KERNELS
-                 , temporaries
-#endif
-                 );
+  if (m_select_kernel_mode) {
+    select_kernel_mode(dt);
+  } else {
+    SHF::shoc_main(m_num_cols, m_num_levs, m_num_levs+1, m_npbl, m_nadv, m_num_tracers, dt,
+                   workspace_mgr,input,input_output,output,history_output,temporaries,
+                   m_small_kernels);
+  }
 
   // Postprocessing of SHOC outputs
   Kokkos::parallel_for("shoc_postprocess",
@@ -480,6 +490,74 @@ void SHOCMacrophysics::run_impl (const double dt)
                        shoc_postprocess);
   Kokkos::fence();
 }
+// =========================================================================================
+void SHOCMacrophysics::select_kernel_mode (const double dt)
+{
+  // shoc_main updates the input_output views, so save them, and restore them
+  // before each run. The final state is the one of a run with the chosen mode,
+  // so results do not depend on the selection process.
+  auto save = [](const auto& v) {
+    auto copy = Kokkos::create_mirror(typename KT::MemSpace(),v);
+    Kokkos::deep_copy(copy,v);
+    return copy;
+  };
+  const auto host_dse     = save(input_output.host_dse);
+  const auto tke          = save(input_output.tke);
+  const auto thetal       = save(input_output.thetal);
+  const auto qw           = save(input_output.qw);
+  const auto horiz_wind   = save(input_output.horiz_wind);
+  const auto wthv_sec     = save(input_output.wthv_sec);
+  const auto qtracers     = save(input_output.qtracers);
+  const auto tk           = save(input_output.tk);
+  const auto shoc_cldfrac = save(input_output.shoc_cldfrac);
+  const auto shoc_ql      = save(input_output.shoc_ql);
+  auto restore = [&]() {
+    Kokkos::deep_copy(input_output.host_dse,    host_dse);
+    Kokkos::deep_copy(input_output.tke,         tke);
+    Kokkos::deep_copy(input_output.thetal,      thetal);
+    Kokkos::deep_copy(input_output.qw,          qw);
+    Kokkos::deep_copy(input_output.horiz_wind,  horiz_wind);
+    Kokkos::deep_copy(input_output.wthv_sec,    wthv_sec);
+    Kokkos::deep_copy(input_output.qtracers,    qtracers);
+    Kokkos::deep_copy(input_output.tk,          tk);
+    Kokkos::deep_copy(input_output.shoc_cldfrac,shoc_cldfrac);
+    Kokkos::deep_copy(input_output.shoc_ql,     shoc_ql);
+    workspace_mgr.reset_internals();
+  };
+  auto run = [&](const bool small_kernels) {
+    return SHF::shoc_main(m_num_cols, m_num_levs, m_num_levs+1, m_npbl, m_nadv, m_num_tracers, dt,
+                          workspace_mgr,input,input_output,output,history_output,temporaries,
+                          small_kernels);
+  };
+
+  // Time each mode twice, and keep the best time, so that one-time costs
+  // (e.g., the first launch of a kernel) do not affect the choice.
+  // Times are maxed over ranks, so that all ranks pick the same mode.
+  double my_times[2] = {std::numeric_limits<double>::max(),std::numeric_limits<double>::max()};
+  for (int trial=0; trial<2; ++trial) {
+    for (int sk : {0,1}) {
+      if (trial>0 || sk>0) {
+        restore();
+      }
+      my_times[sk] = std::min(my_times[sk],1e-6*run(sk==1));
+    }
+  }
+  double times[2];
+  m_comm.all_reduce(my_times,times,2,MPI_MAX);
+
+  m_small_kernels = times[1]<times[0];
+  m_select_kernel_mode = false;
+  if (not m_small_kernels) {
+    // The last run used small kernels
+    restore();
+    run(false);
+  }
+
+  m_atm_logger->info("[SHOC] kernel mode: " + std::string(m_small_kernels ? "small" : "big")
+                     + " kernels (shoc_main time on " + std::to_string(m_num_cols) + " columns: big="
+                     + std::to_string(times[0]) + "s, small=" + std::to_string(times[1]) + "s)");
+}
+
 // =========================================================================================
 void SHOCMacrophysics::finalize_impl()
 {
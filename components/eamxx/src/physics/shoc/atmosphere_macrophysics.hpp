@@ -437,19 +437,12 @@ public:
 
   // Structure for storing local variables initialized using the ATMBufferManager
   struct Buffer {
-#ifndef SCREAM_SMALL_KERNELS
-    static constexpr int num_1d_scalar_ncol = 5;
-#else
+    // Note: the temporaries for SHOC small kernels are always included,
+    //       since the kernel mode can be chosen at runtime.
     static constexpr int num_1d_scalar_ncol = 18;
-#endif
     static constexpr int num_1d_scalar_nlev = 1;
-#ifndef SCREAM_SMALL_KERNELS
-    static constexpr int num_2d_vector_mid  = 18;
-    static constexpr int num_2d_vector_int  = 12;
-#else
     static constexpr int num_2d_vector_mid  = 22;
     static constexpr int num_2d_vector_int  = 13;
-#endif
     static constexpr int num_2d_vector_tr   = 1;
 
     uview_1d<Real> cell_length;
@@ -457,7 +450,6 @@ public:
     uview_1d<Real> wprtp_sfc;
     uview_1d<Real> upwp_sfc;
     uview_1d<Real> vpwp_sfc;
-#ifdef SCREAM_SMALL_KERNELS
     uview_1d<Real> se_b;
     uview_1d<Real> ke_b;
     uview_1d<Real> wv_b;
@@ -471,7 +463,6 @@ public:
     uview_1d<Real> obklen;
     uview_1d<Real> ustar2;
     uview_1d<Real> wstar;
-#endif
 
     uview_1d<Spack> pref_mid;
 
@@ -506,13 +497,11 @@ public:
     uview_2d<Spack> w3;
     uview_2d<Spack> wqls_sec;
     uview_2d<Spack> brunt;
-#ifdef SCREAM_SMALL_KERNELS
     uview_2d<Spack> rho_zt;
     uview_2d<Spack> shoc_qv;
     uview_2d<Spack> dz_zt;
     uview_2d<Spack> dz_zi;
     uview_2d<Spack> tkh;
-#endif
 
     Spack* wsm_data;
   };
@@ -539,6 +528,9 @@ protected:
   // the ATMBufferManager
   void init_buffers(const ATMBufferManager &buffer_manager);
 
+  // Run shoc_main with both kernel modes on the current state, and keep the fastest
+  void select_kernel_mode (const double dt);
+
   // Keep track of field dimensions and other scalar values
   // needed in shoc_main
   Int m_num_cols;
@@ -559,9 +551,12 @@ protected:
   SHF::SHOCInputOutput input_output;
   SHF::SHOCOutput output;
   SHF::SHOCHistoryOutput history_output;
-#ifdef SCREAM_SMALL_KERNELS
   SHF::SHOCTemporaries temporaries;
-#endif
+
+  // Whether shoc_main uses small kernels. If m_select_kernel_mode is true,
+  // the first call to run_impl times both modes and picks the fastest.
+  bool m_small_kernels;
+  bool m_select_kernel_mode;
 
   // Structures which compute pre/post process
   SHOCPreprocess shoc_preprocess;
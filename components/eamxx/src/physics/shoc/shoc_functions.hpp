@@ -179,7 +179,6 @@ struct Functions
     view_2d<Spack>  isotropy;
   };
 
-#ifdef SCREAM_SMALL_KERNELS
   struct SHOCTemporaries {
     SHOCTemporaries() = default;
 
@@ -203,7 +202,6 @@ struct Functions
     view_2d<Spack> dz_zi;
     view_2d<Spack> tkh;
   };
-#endif
 
   //
   // --------- Functions ---------
@@ -249,7 +247,6 @@ struct Functions
     const uview_1d<const Spack>& zt_grid,
     const Scalar& phis,
     const uview_1d<Spack>& host_dse);
-#ifdef SCREAM_SMALL_KERNELS
   static void update_host_dse_disp(
     const Int& shcol,
     const Int& nlev,
@@ -259,7 +256,6 @@ struct Functions
     const view_2d<const Spack>& zt_grid,
     const view_1d<const Scalar>& phis,
     const view_2d<Spack>& host_dse);
-#endif
 
   KOKKOS_FUNCTION
   static void compute_diag_third_shoc_moment(
@@ -299,12 +295,10 @@ struct Functions
     const MemberType& team,
     const Int& nlev,
     const uview_1d<Spack>& tke);
-#ifdef SCREAM_SMALL_KERNELS
   static void check_tke_disp(
     const Int& schol,
     const Int& nlev,
     const view_2d<Spack>& tke);
-#endif
 
   KOKKOS_FUNCTION
   static void clipping_diag_third_shoc_moments(
@@ -338,7 +332,6 @@ struct Functions
     Scalar&                      ke_int,
     Scalar&                      wv_int,
     Scalar&                      wl_int);
-#ifdef SCREAM_SMALL_KERNELS
   static void shoc_energy_integrals_disp(
     const Int&                   shcol,
     const Int&                   nlev,
@@ -352,7 +345,6 @@ struct Functions
     const view_1d<Scalar>& ke_b_slot,
     const view_1d<Scalar>& wv_b_slot,
     const view_1d<Scalar>& wl_b_slot);
-#endif
 
   KOKKOS_FUNCTION
   static void shoc_diag_second_moments_lbycond(
@@ -382,7 +374,6 @@ struct Functions
      const Workspace& workspace, const uview_1d<Spack>& thl_sec,
      const uview_1d<Spack>& qw_sec, const uview_1d<Spack>& wthl_sec, const uview_1d<Spack>& wqw_sec, const uview_1d<Spack>& qwthl_sec,
      const uview_1d<Spack>& uw_sec, const uview_1d<Spack>& vw_sec, const uview_1d<Spack>& wtke_sec, const uview_1d<Spack>& w_sec);
-#ifdef SCREAM_SMALL_KERNELS
   static void diag_second_shoc_moments_disp(
     const Int& shcol, const Int& nlev, const Int& nlevi,
     const view_2d<const Spack>& thetal,
@@ -413,7 +404,6 @@ struct Functions
     const view_2d<Spack>& vw_sec,
     const view_2d<Spack>& wtke_sec,
     const view_2d<Spack>& w_sec);
-#endif
 
   KOKKOS_FUNCTION
   static void compute_brunt_shoc_length(
@@ -454,7 +444,6 @@ struct Functions
     Scalar&       ustar,
     Scalar&       kbfs,
     Scalar&       obklen);
-#ifdef SCREAM_SMALL_KERNELS
   static void shoc_diag_obklen_disp(
     const Int&                   shcol,
     const Int&                   nlev,
@@ -468,7 +457,6 @@ struct Functions
     const view_1d<Scalar>&       ustar,
     const view_1d<Scalar>&       kbfs,
     const view_1d<Scalar>&       obklen);
-#endif
 
   KOKKOS_FUNCTION
   static void shoc_pblintd_cldcheck(
@@ -490,7 +478,6 @@ struct Functions
     const Workspace&             workspace,
     const uview_1d<Spack>&       brunt,
     const uview_1d<Spack>&       shoc_mix);
-#ifdef SCREAM_SMALL_KERNELS
   static void shoc_length_disp(
     const Int&                   shcol,
     const Int&                   nlev,
@@ -505,7 +492,6 @@ struct Functions
     const WorkspaceMgr&          workspace_mgr,
     const view_2d<Spack>&        brunt,
     const view_2d<Spack>&        shoc_mix);
-#endif
 
   KOKKOS_FUNCTION
   static void shoc_energy_fixer(
@@ -531,7 +517,6 @@ struct Functions
     const uview_1d<const Spack>& pint,
     const Workspace&             workspace,
     const uview_1d<Spack>&       host_dse);
-#ifdef SCREAM_SMALL_KERNELS
   static void shoc_energy_fixer_disp(
     const Int&                   shcol,
     const Int&                   nlev,
@@ -555,7 +540,6 @@ struct Functions
     const view_2d<const Spack>&  pint,
     const WorkspaceMgr&          workspace_mgr,
     const view_2d<Spack>&        host_dse);
-#endif
 
   KOKKOS_FUNCTION
   static void compute_shoc_vapor(
@@ -564,14 +548,12 @@ struct Functions
     const uview_1d<const Spack>& qw,
     const uview_1d<const Spack>& ql,
     const uview_1d<Spack>&       qv);
-#ifdef SCREAM_SMALL_KERNELS
   static void compute_shoc_vapor_disp(
     const Int&                  shcol,
     const Int&                  nlev,
     const view_2d<const Spack>& qw,
     const view_2d<const Spack>& ql,
     const view_2d<Spack>&       qv);
-#endif
 
   KOKKOS_FUNCTION
   static void update_prognostics_implicit(
@@ -599,7 +581,6 @@ struct Functions
     const uview_1d<Spack>&       tke,
     const uview_1d<Spack>&       u_wind,
     const uview_1d<Spack>&       v_wind);
-#ifdef SCREAM_SMALL_KERNELS
   static void update_prognostics_implicit_disp(
     const Int&                   shcol,
     const Int&                   nlev,
@@ -625,7 +606,6 @@ struct Functions
     const view_2d<Spack>&        tke,
     const view_2d<Spack>&        u_wind,
     const view_2d<Spack>&        v_wind);
-#endif
 
   KOKKOS_FUNCTION
   static void diag_third_shoc_moments(
@@ -645,7 +625,6 @@ struct Functions
     const uview_1d<const Spack>& zi_grid,
     const Workspace&             workspace,
     const uview_1d<Spack>&       w3);
-#ifdef SCREAM_SMALL_KERNELS
   static void diag_third_shoc_moments_disp(
     const Int&                  shcol,
     const Int&                  nlev,
@@ -663,7 +642,6 @@ struct Functions
     const view_2d<const Spack>& zi_grid,
     const WorkspaceMgr&         workspace_mgr,
     const view_2d<Spack>&       w3);
-#endif
 
   KOKKOS_FUNCTION
   static void adv_sgs_tke(
@@ -701,7 +679,6 @@ struct Functions
     const uview_1d<Spack>&       wqls,
     const uview_1d<Spack>&       wthv_sec,
     const uview_1d<Spack>&       shoc_ql2);
-#ifdef SCREAM_SMALL_KERNELS
   static void shoc_assumed_pdf_disp(
     const Int&                  shcol,
     const Int&                  nlev,
@@ -725,7 +702,6 @@ struct Functions
     const view_2d<Spack>&       wqls,
     const view_2d<Spack>&       wthv_sec,
     const view_2d<Spack>&       shoc_ql2);
-#endif
 
   KOKKOS_FUNCTION
   static void compute_shr_prod(
@@ -778,7 +754,6 @@ struct Functions
     const Int&                  ntop_shoc,
     const view_1d<const Spack>& pref_mid);
 
-#ifndef SCREAM_SMALL_KERNELS
   KOKKOS_FUNCTION
   static void shoc_main_internal(
     const MemberType&            team,
@@ -837,7 +812,7 @@ struct Functions
     const uview_1d<Spack>&       wqls_sec,
     const uview_1d<Spack>&       brunt,
     const uview_1d<Spack>&       isotropy);
-#else
+
   static void shoc_main_internal(
     const Int&                   shcol,        // Number of columns
     const Int&                   nlev,         // Number of levels
@@ -914,6 +889,15 @@ struct Functions
     const view_2d<Spack>& dz_zt,
     const view_2d<Spack>& dz_zi,
     const view_2d<Spack>& tkh);
+
+  // SHOC can run as one monolithic kernel, with a team per column, or as a
+  // sequence of smaller kernels (the *_disp functions), one per SHOC routine.
+  // Which one is faster depends on architecture, pack size, and number of
+  // columns, so both are always available. SCREAM_SMALL_KERNELS sets the default.
+#ifdef SCREAM_SMALL_KERNELS
+  static constexpr bool default_small_kernels = true;
+#else
+  static constexpr bool default_small_kernels = false;
 #endif
 
   // Return microseconds elapsed
@@ -929,11 +913,9 @@ struct Functions
     const SHOCInput&         shoc_input,           // Input
     const SHOCInputOutput&   shoc_input_output,    // Input/Output
     const SHOCOutput&        shoc_output,          // Output
-    const SHOCHistoryOutput& shoc_history_output   // Output (diagnostic)
-#ifdef SCREAM_SMALL_KERNELS
-    , const SHOCTemporaries& shoc_temporaries      // Temporaries for small kernels
-#endif
-                       );
+    const SHOCHistoryOutput& shoc_history_output,  // Output (diagnostic)
+    const SHOCTemporaries&   shoc_temporaries,     // Temporaries for small kernels
+    const bool               small_kernels = default_small_kernels);
 
   KOKKOS_FUNCTION
   static void pblintd_height(
@@ -1001,7 +983,6 @@ struct Functions
     const uview_1d<const Spack>& cldn,
     const Workspace&             workspace,
     Scalar&                      pblh);
-#ifdef SCREAM_SMALL_KERNELS
   static void pblintd_disp(
     const Int&                   shcol,
     const Int&                   nlev,
@@ -1020,7 +1001,6 @@ struct Functions
     const view_2d<const Spack>&  cldn,
     const WorkspaceMgr&          workspace_mgr,
     const view_1d<Scalar>&       pblh);
-#endif
 
   KOKKOS_FUNCTION
   static void shoc_grid(
@@ -1033,7 +1013,6 @@ struct Functions
     const uview_1d<Spack>&       dz_zt,
     const uview_1d<Spack>&       dz_zi,
     const uview_1d<Spack>&       rho_zt);
-#ifdef SCREAM_SMALL_KERNELS
   static void shoc_grid_disp(
     const Int&                  shcol,
     const Int&                  nlev,
@@ -1044,7 +1023,6 @@ struct Functions
     const view_2d<Spack>&       dz_zt,
     const view_2d<Spack>&       dz_zi,
     const view_2d<Spack>&       rho_zt);
-#endif
 
   KOKKOS_FUNCTION
   static void eddy_diffusivities(
@@ -1083,7 +1061,6 @@ struct Functions
     const uview_1d<Spack>&       tk,
     const uview_1d<Spack>&       tkh,
     const uview_1d<Spack>&       isotropy);
-#ifdef SCREAM_SMALL_KERNELS
   static void shoc_tke_disp(
     const Int&                   shcol,
     const Int&                   nlev,
@@ -1106,7 +1083,6 @@ struct Functions
     const view_2d<Spack>&        tk,
     const view_2d<Spack>&        tkh,
     const view_2d<Spack>&        isotropy);
-#endif
 }; // struct Functions
 
 } // namespace shoc
@@ -2702,7 +2702,7 @@ Int shoc_main_f(Int shcol, Int nlev, Int nlevi, Real dtime, Int nadv, Int npbl,
                 Real* thetal, Real* qw, Real* u_wind, Real* v_wind, Real* qtracers, Real* wthv_sec, Real* tkh, Real* tk,
                 Real* shoc_ql, Real* shoc_cldfrac, Real* pblh, Real* shoc_mix, Real* isotropy, Real* w_sec, Real* thl_sec,
                 Real* qw_sec, Real* qwthl_sec, Real* wthl_sec, Real* wqw_sec, Real* wtke_sec, Real* uw_sec, Real* vw_sec,
-                Real* w3, Real* wqls_sec, Real* brunt, Real* shoc_ql2)
+                Real* w3, Real* wqls_sec, Real* brunt, Real* shoc_ql2, bool small_kernels)
 {
   // tkh is a local variable in C++ impl
   (void)tkh;
@@ -2848,7 +2848,6 @@ Int shoc_main_f(Int shcol, Int nlev, Int nlevi, Real dtime, Int nadv, Int npbl,
 
   const auto nlevi_packs = ekat::npack<Spack>(nlevi);
 
-#ifdef SCREAM_SMALL_KERNELS
   view_1d
     se_b   ("se_b", shcol),
     ke_b   ("ke_b", shcol),
@@ -2874,7 +2873,6 @@ Int shoc_main_f(Int shcol, Int nlev, Int nlevi, Real dtime, Int nadv, Int npbl,
   SHF::SHOCTemporaries shoc_temporaries{
     se_b, ke_b, wv_b, wl_b, se_a, ke_a, wv_a, wl_a, ustar, kbfs, obklen, ustar2, wstar,
     rho_zt, shoc_qv, dz_zt, dz_zi, tkhv};
-#endif
 
   // Create local workspace
   const int n_wind_slots = ekat::npack<Spack>(2)*Spack::n;
@@ -2883,11 +2881,8 @@ Int shoc_main_f(Int shcol, Int nlev, Int nlevi, Real dtime, Int nadv, Int npbl,
 
   const auto elapsed_microsec = SHF::shoc_main(shcol, nlev, nlevi, npbl, nadv, num_qtracers, dtime,
                                                workspace_mgr,
-                                               shoc_input, shoc_input_output, shoc_output, shoc_history_output
-#ifdef SCREAM_SMALL_KERNELS
-                                               , shoc_temporaries
-#endif
-                                               );
+                                               shoc_input, shoc_input_output, shoc_output, shoc_history_output,
+                                               shoc_temporaries, small_kernels);
 
   // Copy wind back into separate views and
   // Transpose tracers
@@ -12,6 +12,8 @@ namespace shoc {
 struct FortranData;
 
 // Run SHOC subroutines, populating inout and out fields of d.
+// small_kernels selects the C++ kernel mode, and is ignored if use_fortran=true.
+ekat::Int shoc_main(FortranData& d, bool use_fortran, bool small_kernels);
 ekat::Int shoc_main(FortranData& d, bool use_fortran);
 
 
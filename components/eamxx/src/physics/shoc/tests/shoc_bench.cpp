@@ -0,0 +1,127 @@
+#include "shoc_main_wrap.hpp"
+#include "shoc_functions_f90.hpp"
+#include "shoc_ic_cases.hpp"
+
+#include "share/scream_types.hpp"
+#include "share/scream_session.hpp"
+
+#include "physics/share/tests/physics_bench_common.hpp"
+
+#include <vector>
+
+namespace {
+using namespace scream;
+using namespace scream::shoc;
+namespace phys_bench = scream::physics::bench;
+
+/*
+ * shoc_bench is a throughput benchmark for shoc_main. For each requested
+ * number of columns, it synthesizes a column state with the same initial
+ * condition generator used by shoc_run_and_cmp (ic::Factory::standard), runs
+ * shoc_main for a number of steps (each doing nadv SHOC loops), and repeats
+ * the whole thing a number of times (after one "cold" run, which is not timed).
+ * Only the shoc_main call is timed, so host-device copies are excluded.
+ * The kernel mode (small kernels or one monolithic kernel) is chosen with -m.
+ *
+ * See physics_bench_common.hpp for the report.
+ */
+
+using SHF = Functions<Real,DefaultDevice>;
+
+struct Bench {
+  phys_bench::Options opts;
+  Int num_qtracers, nadv;
+  bool small_kernels;
+
+  void print_config () const {
+    std::cout << "SHOC benchmark on " << DefaultDevice::execution_space::name()
+              << ": nk=" << opts.nlev << ", dt=" << opts.dt << ", ts=" << opts.nsteps
+              << ", nadv=" << nadv << ", num_qtracers=" << num_qtracers
+              << ", repeat=" << opts.repeat
+              << ", kernel_mode=" << (small_kernels ? "small" : "big")
+              << ", packn=" << SCREAM_PACK_SIZE
+              << ", small_packn=" << SCREAM_SMALL_PACK_SIZE
+              << ", sizeof(Real)=" << sizeof(Real) << "\n";
+  }
+
+  void run (const Int ncol) const {
+    Int duration = 0;
+    Real bytes_per_step = 0;
+    for (Int r = -1; r < opts.repeat; ++r) {
+      const auto d = ic::Factory::create(ic::Factory::standard, ncol, opts.nlev, num_qtracers);
+      d->nadv  = nadv;
+      d->dtime = opts.dt;
+      shoc_init(opts.nlev);
+
+      if (r == -1) {
+        bytes_per_step = phys_bench::compulsory_bytes<FortranDataIterator>(d);
+      }
+
+      for (Int it = 0; it < opts.nsteps; ++it) {
+        const Int current_microsec = shoc_main(*d, false, small_kernels);
+        if (r != -1) { // do not count the "cold" run
+          duration += current_microsec;
+        }
+      }
+    }
+
+    const double time_per_step = 1e-6*duration / (opts.repeat*opts.nsteps);
+    phys_bench::print_row(ncol, time_per_step, bytes_per_step);
+  }
+};
+
+} // namespace anon
+
+int main (int argc, char** argv) {
+  Bench bench;
+  bench.opts.nsteps = 10;
+  bench.opts.dt = 150;
+  bench.num_qtracers = 3;
+  bench.nadv = 15;
+  bench.small_kernels = SHF::default_small_kernels;
+
+  if (argc > 1 && ekat::argv_matches(argv[1], "-h", "--help")) {
+    std::cout <<
+      argv[0] << " [options]\n"
+      "Options:\n" <<
+      phys_bench::common_help(bench.opts) <<
+      "  -q <num_qtracers>   Number of q tracers. Default=3.\n"
+      "  -n <nadv>           Number of SHOC loops per timestep. Default=15.\n"
+      "  -m <kernel_mode>    small|big. Default=" << (SHF::default_small_kernels ? "small" : "big") << ".\n";
+    return 0;
+  }
+
+  for (int i = 1; i < argc; ++i) {
+    if (phys_bench::parse_common_arg(i, argc, argv, bench.opts)) {
+      continue;
+    }
+    if (ekat::argv_matches(argv[i], "-q", "--num-qtracers")) {
+      phys_bench::expect_another_arg(i, argc);
+      ++i;
+      bench.num_qtracers = std::atoi(argv[i]);
+    }
+    if (ekat::argv_matches(argv[i], "-n", "--nadv")) {
+      phys_bench::expect_another_arg(i, argc);
+      ++i;
+      bench.nadv = std::atoi(argv[i]);
+    }
+    if (ekat::argv_matches(argv[i], "-m", "--kernel-mode")) {
+      phys_bench::expect_another_arg(i, argc);
+      ++i;
+      const std::string v = argv[i];
+      EKAT_REQUIRE_MSG(v == "small" || v == "big", "Kernel mode option value must be one of small|big");
+      bench.small_kernels = v == "small";
+    }
+  }
+  phys_bench::check_options(bench.opts);
+
+  scream::initialize_scream_session(argc, argv); {
+    bench.print_config();
+    phys_bench::print_header();
+    for (const auto ncol : bench.opts.ncols) {
+      bench.run(ncol);
+    }
+  } scream::finalize_scream_session();
+
+  return 0;
+}
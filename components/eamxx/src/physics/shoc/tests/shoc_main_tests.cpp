@@ -9,6 +9,10 @@
 
 #include "shoc_unit_tests_common.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 namespace scream {
 namespace shoc {
 namespace unit_test {
@@ -365,7 +369,7 @@ struct UnitWrap::UnitTest<D>::TestShocMain {
 
     // Create copies of data for use by cxx. Needs to happen before fortran calls so that
     // inout data is in original state
-    ShocMainData cxx_data[] = {
+    const ShocMainData init_data[] = {
       ShocMainData(f90_data[0]),
       ShocMainData(f90_data[1]),
       ShocMainData(f90_data[2]),
@@ -380,8 +384,140 @@ struct UnitWrap::UnitTest<D>::TestShocMain {
       shoc_main_with_init(d);
     }
 
-    // Get data from cxx
-    for (auto& d : cxx_data) {
+    // Both kernel modes are always built: each must match fortran
+    for (const bool small_kernels : {false, true}) {
+      ShocMainData cxx_data[] = {
+        ShocMainData(init_data[0]),
+        ShocMainData(init_data[1]),
+        ShocMainData(init_data[2]),
+        ShocMainData(init_data[3])
+      };
+
+      // Get data from cxx
+      for (auto& d : cxx_data) {
+        d.transpose<ekat::TransposeDirection::c2f>(); // _f expects data in fortran layout
+        const int npbl = shoc_init_f(d.nlev, d.pref_mid, d.nbot_shoc, d.ntop_shoc);
+
+        shoc_main_f(d.shcol, d.nlev, d.nlevi, d.dtime, d.nadv, npbl, d.host_dx, d.host_dy,
+                    d.thv, d.zt_grid, d.zi_grid, d.pres, d.presi, d.pdel, d.wthl_sfc,
+                    d.wqw_sfc, d.uw_sfc, d.vw_sfc, d.wtracer_sfc, d.num_qtracers,
+                    d.w_field, d.inv_exner, d.phis, d.host_dse, d.tke, d.thetal, d.qw,
+                    d.u_wind, d.v_wind, d.qtracers, d.wthv_sec, d.tkh, d.tk, d.shoc_ql,
+                    d.shoc_cldfrac, d.pblh, d.shoc_mix, d.isotropy, d.w_sec, d.thl_sec,
+                    d.qw_sec, d.qwthl_sec, d.wthl_sec, d.wqw_sec, d.wtke_sec, d.uw_sec,
+                    d.vw_sec, d.w3, d.wqls_sec, d.brunt, d.shoc_ql2, small_kernels);
+        d.transpose<ekat::TransposeDirection::f2c>(); // go back to C layout
+      }
+
+      // Verify BFB results, all data should be in C layout
+      if (SCREAM_BFB_TESTING) {
+        static constexpr Int num_runs = sizeof(f90_data) / sizeof(ShocMainData);
+
+        for (Int i = 0; i < num_runs; ++i) {
+          ShocMainData& d_f90 = f90_data[i];
+          ShocMainData& d_cxx = cxx_data[i];
+          REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.host_dse));
+          REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.tke));
+          REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.thetal));
+          REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.qw));
+          REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.u_wind));
+          REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.v_wind));
+          REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.wthv_sec));
+          REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.tkh));
+          REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.tk));
+          REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.shoc_ql));
+          REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.shoc_cldfrac));
+          REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.shoc_mix));
+          REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.isotropy));
+          REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.w_sec));
+          REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.wqls_sec));
+          REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.brunt));
+          REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.shoc_ql2));
+          for (Int k = 0; k < d_f90.total(d_f90.host_dse); ++k) {
+            REQUIRE(d_f90.host_dse[k] == d_cxx.host_dse[k]);
+            REQUIRE(d_f90.tke[k] == d_cxx.tke[k]);
+            REQUIRE(d_f90.thetal[k] == d_cxx.thetal[k]);
+            REQUIRE(d_f90.qw[k] == d_cxx.qw[k]);
+            REQUIRE(d_f90.u_wind[k] == d_cxx.u_wind[k]);
+            REQUIRE(d_f90.v_wind[k] == d_cxx.v_wind[k]);
+            REQUIRE(d_f90.wthv_sec[k] == d_cxx.wthv_sec[k]);
+            REQUIRE(d_f90.tk[k] == d_cxx.tk[k]);
+            REQUIRE(d_f90.shoc_ql[k] == d_cxx.shoc_ql[k]);
+            REQUIRE(d_f90.shoc_cldfrac[k] == d_cxx.shoc_cldfrac[k]);
+            REQUIRE(d_f90.shoc_mix[k] == d_cxx.shoc_mix[k]);
+            REQUIRE(d_f90.isotropy[k] == d_cxx.isotropy[k]);
+            REQUIRE(d_f90.w_sec[k] == d_cxx.w_sec[k]);
+            REQUIRE(d_f90.wqls_sec[k] == d_cxx.wqls_sec[k]);
+            REQUIRE(d_f90.brunt[k] == d_cxx.brunt[k]);
+            REQUIRE(d_f90.shoc_ql2[k] == d_cxx.shoc_ql2[k]);
+          }
+
+          REQUIRE(d_f90.total(d_f90.qtracers) == d_cxx.total(d_cxx.qtracers));
+          for (Int k = 0; k < d_f90.total(d_f90.qtracers); ++k) {
+            REQUIRE(d_f90.qtracers[k] == d_cxx.qtracers[k]);
+          }
+
+          REQUIRE(d_f90.total(d_f90.pblh) == d_cxx.total(d_cxx.pblh));
+          for (Int k = 0; k < d_f90.total(d_f90.pblh); ++k) {
+            REQUIRE(d_f90.pblh[k] == d_cxx.pblh[k]);
+          }
+
+          REQUIRE(d_f90.total(d_f90.thl_sec) == d_cxx.total(d_cxx.thl_sec));
+          REQUIRE(d_f90.total(d_f90.thl_sec) == d_cxx.total(d_cxx.qw_sec));
+          REQUIRE(d_f90.total(d_f90.thl_sec) == d_cxx.total(d_cxx.qwthl_sec));
+          REQUIRE(d_f90.total(d_f90.thl_sec) == d_cxx.total(d_cxx.wthl_sec));
+          REQUIRE(d_f90.total(d_f90.thl_sec) == d_cxx.total(d_cxx.wqw_sec));
+          REQUIRE(d_f90.total(d_f90.thl_sec) == d_cxx.total(d_cxx.wtke_sec));
+          REQUIRE(d_f90.total(d_f90.thl_sec) == d_cxx.total(d_cxx.uw_sec));
+          REQUIRE(d_f90.total(d_f90.thl_sec) == d_cxx.total(d_cxx.vw_sec));
+          REQUIRE(d_f90.total(d_f90.thl_sec) == d_cxx.total(d_cxx.w3));
+          for (Int k = 0; k < d_f90.total(d_f90.thl_sec); ++k) {
+            REQUIRE(d_f90.thl_sec[k] == d_cxx.thl_sec[k]);
+            REQUIRE(d_f90.qw_sec[k] == d_cxx.qw_sec[k]);
+            REQUIRE(d_f90.qwthl_sec[k] == d_cxx.qwthl_sec[k]);
+            REQUIRE(d_f90.wthl_sec[k] == d_cxx.wthl_sec[k]);
+            REQUIRE(d_f90.wqw_sec[k] == d_cxx.wqw_sec[k]);
+            REQUIRE(d_f90.wtke_sec[k] == d_cxx.wtke_sec[k]);
+            REQUIRE(d_f90.uw_sec[k] == d_cxx.uw_sec[k]);
+            REQUIRE(d_f90.vw_sec[k] == d_cxx.vw_sec[k]);
+            REQUIRE(d_f90.w3[k] == d_cxx.w3[k]);
+          }
+        }
+      }
+    }
+  } // run_bfb
+
+  // Run the C++ shoc_main with both kernel modes from the same input, and compare them.
+  // The modes share the (build-time) workspace setting, so they must agree up to roundoff,
+  // and exactly in BFB builds.
+  static void run_kernel_modes()
+  {
+    auto engine = setup_random_test();
+
+    ShocMainData init_data(12, 72, 73, 5, 300, 15, 72, 0);
+    init_data.randomize(engine,
+                        {
+                          {init_data.presi, {700e2,1000e2}},
+                          {init_data.tkh, {3,50}},
+                          {init_data.tke, {0.1,0.3}},
+                          {init_data.zi_grid, {0, 3000}},
+                          {init_data.wthl_sfc, {0,1e-4}},
+                          {init_data.wqw_sfc, {0,1e-6}},
+                          {init_data.uw_sfc, {0,1e-2}},
+                          {init_data.vw_sfc, {0,1e-4}},
+                          {init_data.host_dx, {3000, 3000}},
+                          {init_data.host_dy, {3000, 3000}},
+                          {init_data.phis, {0, 500}},
+                          {init_data.wthv_sec, {-0.02, 0.03}},
+                          {init_data.qw, {1e-4, 5e-2}},
+                          {init_data.u_wind, {-10, 0}},
+                          {init_data.v_wind, {-10, 0}},
+                          {init_data.shoc_ql, {0, 1e-3}},
+                        });
+
+    ShocMainData big(init_data), small(init_data);
+    for (auto* dp : {&big, &small}) {
+      auto& d = *dp;
       d.transpose<ekat::TransposeDirection::c2f>(); // _f expects data in fortran layout
       const int npbl = shoc_init_f(d.nlev, d.pref_mid, d.nbot_shoc, d.ntop_shoc);
 
@@ -392,86 +528,32 @@ struct UnitWrap::UnitTest<D>::TestShocMain {
                   d.u_wind, d.v_wind, d.qtracers, d.wthv_sec, d.tkh, d.tk, d.shoc_ql,
                   d.shoc_cldfrac, d.pblh, d.shoc_mix, d.isotropy, d.w_sec, d.thl_sec,
                   d.qw_sec, d.qwthl_sec, d.wthl_sec, d.wqw_sec, d.wtke_sec, d.uw_sec,
-                  d.vw_sec, d.w3, d.wqls_sec, d.brunt, d.shoc_ql2);
+                  d.vw_sec, d.w3, d.wqls_sec, d.brunt, d.shoc_ql2, dp==&small);
       d.transpose<ekat::TransposeDirection::f2c>(); // go back to C layout
     }
 
-    // Verify BFB results, all data should be in C layout
-    if (SCREAM_BFB_TESTING) {
-      static constexpr Int num_runs = sizeof(f90_data) / sizeof(ShocMainData);
-
-      for (Int i = 0; i < num_runs; ++i) {
-        ShocMainData& d_f90 = f90_data[i];
-        ShocMainData& d_cxx = cxx_data[i];
-        REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.host_dse));
-        REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.tke));
-        REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.thetal));
-        REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.qw));
-        REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.u_wind));
-        REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.v_wind));
-        REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.wthv_sec));
-        REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.tkh));
-        REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.tk));
-        REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.shoc_ql));
-        REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.shoc_cldfrac));
-        REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.shoc_mix));
-        REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.isotropy));
-        REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.w_sec));
-        REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.wqls_sec));
-        REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.brunt));
-        REQUIRE(d_f90.total(d_f90.host_dse) == d_cxx.total(d_cxx.shoc_ql2));
-        for (Int k = 0; k < d_f90.total(d_f90.host_dse); ++k) {
-          REQUIRE(d_f90.host_dse[k] == d_cxx.host_dse[k]);
-          REQUIRE(d_f90.tke[k] == d_cxx.tke[k]);
-          REQUIRE(d_f90.thetal[k] == d_cxx.thetal[k]);
-          REQUIRE(d_f90.qw[k] == d_cxx.qw[k]);
-          REQUIRE(d_f90.u_wind[k] == d_cxx.u_wind[k]);
-          REQUIRE(d_f90.v_wind[k] == d_cxx.v_wind[k]);
-          REQUIRE(d_f90.wthv_sec[k] == d_cxx.wthv_sec[k]);
-          REQUIRE(d_f90.tk[k] == d_cxx.tk[k]);
-          REQUIRE(d_f90.shoc_ql[k] == d_cxx.shoc_ql[k]);
-          REQUIRE(d_f90.shoc_cldfrac[k] == d_cxx.shoc_cldfrac[k]);
-          REQUIRE(d_f90.shoc_mix[k] == d_cxx.shoc_mix[k]);
-          REQUIRE(d_f90.isotropy[k] == d_cxx.isotropy[k]);
-          REQUIRE(d_f90.w_sec[k] == d_cxx.w_sec[k]);
-          REQUIRE(d_f90.wqls_sec[k] == d_cxx.wqls_sec[k]);
-          REQUIRE(d_f90.brunt[k] == d_cxx.brunt[k]);
-          REQUIRE(d_f90.shoc_ql2[k] == d_cxx.shoc_ql2[k]);
-        }
-
-        REQUIRE(d_f90.total(d_f90.qtracers) == d_cxx.total(d_cxx.qtracers));
-        for (Int k = 0; k < d_f90.total(d_f90.qtracers); ++k) {
-          REQUIRE(d_f90.qtracers[k] == d_cxx.qtracers[k]);
-        }
-
-        REQUIRE(d_f90.total(d_f90.pblh) == d_cxx.total(d_cxx.pblh));
-        for (Int k = 0; k < d_f90.total(d_f90.pblh); ++k) {
-          REQUIRE(d_f90.pblh[k] == d_cxx.pblh[k]);
-        }
-
-        REQUIRE(d_f90.total(d_f90.thl_sec) == d_cxx.total(d_cxx.thl_sec));
-        REQUIRE(d_f90.total(d_f90.thl_sec) == d_cxx.total(d_cxx.qw_sec));
-        REQUIRE(d_f90.total(d_f90.thl_sec) == d_cxx.total(d_cxx.qwthl_sec));
-        REQUIRE(d_f90.total(d_f90.thl_sec) == d_cxx.total(d_cxx.wthl_sec));
-        REQUIRE(d_f90.total(d_f90.thl_sec) == d_cxx.total(d_cxx.wqw_sec));
-        REQUIRE(d_f90.total(d_f90.thl_sec) == d_cxx.total(d_cxx.wtke_sec));
-        REQUIRE(d_f90.total(d_f90.thl_sec) == d_cxx.total(d_cxx.uw_sec));
-        REQUIRE(d_f90.total(d_f90.thl_sec) == d_cxx.total(d_cxx.vw_sec));
-        REQUIRE(d_f90.total(d_f90.thl_sec) == d_cxx.total(d_cxx.w3));
-        for (Int k = 0; k < d_f90.total(d_f90.thl_sec); ++k) {
-          REQUIRE(d_f90.thl_sec[k] == d_cxx.thl_sec[k]);
-          REQUIRE(d_f90.qw_sec[k] == d_cxx.qw_sec[k]);
-          REQUIRE(d_f90.qwthl_sec[k] == d_cxx.qwthl_sec[k]);
-          REQUIRE(d_f90.wthl_sec[k] == d_cxx.wthl_sec[k]);
-          REQUIRE(d_f90.wqw_sec[k] == d_cxx.wqw_sec[k]);
-          REQUIRE(d_f90.wtke_sec[k] == d_cxx.wtke_sec[k]);
-          REQUIRE(d_f90.uw_sec[k] == d_cxx.uw_sec[k]);
-          REQUIRE(d_f90.vw_sec[k] == d_cxx.vw_sec[k]);
-          REQUIRE(d_f90.w3[k] == d_cxx.w3[k]);
-        }
+    const Real tol = SCREAM_BFB_TESTING ? 0 : std::sqrt(std::numeric_limits<Real>::epsilon());
+    const auto check = [&](const Real* b, const Real* s, const Int n) {
+      for (Int k = 0; k < n; ++k) {
+        REQUIRE(std::abs(b[k] - s[k]) <= tol*std::max(std::abs(b[k]), Real(1)));
       }
+    };
+    const Int nmid = big.total(big.host_dse);
+    const Int nint = big.total(big.thl_sec);
+    for (auto v : {&ShocMainData::host_dse, &ShocMainData::tke, &ShocMainData::thetal,
+                   &ShocMainData::qw, &ShocMainData::u_wind, &ShocMainData::v_wind,
+                   &ShocMainData::tk, &ShocMainData::tkh, &ShocMainData::shoc_ql,
+                   &ShocMainData::shoc_cldfrac, &ShocMainData::shoc_mix, &ShocMainData::w_sec}) {
+      check(big.*v, small.*v, nmid);
     }
-  } // run_bfb
+    for (auto v : {&ShocMainData::thl_sec, &ShocMainData::qw_sec, &ShocMainData::wthl_sec,
+                   &ShocMainData::wqw_sec, &ShocMainData::uw_sec, &ShocMainData::vw_sec,
+                   &ShocMainData::w3}) {
+      check(big.*v, small.*v, nint);
+    }
+    check(big.qtracers, small.qtracers, big.total(big.qtracers));
+    check(big.pblh, small.pblh, big.total(big.pblh));
+  } // run_kernel_modes
 };
 
 } // namespace unit_test
@@ -494,4 +576,11 @@ TEST_CASE("shoc_main_bfb", "shoc")
   TestStruct::run_bfb();
 }
 
+TEST_CASE("shoc_main_kernel_modes", "shoc")
+{
+  using TestStruct = scream::shoc::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestShocMain;
+
+  TestStruct::run_kernel_modes();
+}
+
 } // empty namespace
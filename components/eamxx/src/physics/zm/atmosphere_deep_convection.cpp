@@ -3,252 +3,455 @@
 
 #include "ekat/ekat_assert.hpp"
 
-namespace {
-// A helper struct and fcn;
-struct GridOpts {
-  GridOpts(const std::string& n, bool out, const ekat::units::Units& u, int idx)
-    : name(n), isOut(out), unit(u), field_idx(idx) {}
-  std::string name;
-  bool isOut;
-  const ekat::units::Units& unit;
-  int field_idx;
-};
-
-void set_grid_opts(std::map<std::string, GridOpts>& opt_map);
-}
+#include <set>
 
 namespace scream
 {
 
+// =========================================================================================
 ZMDeepConvection::ZMDeepConvection (const ekat::Comm& comm,const ekat::ParameterList& params )
   : AtmosphereProcess(comm, params)
 {
-  // Nothing to do here
+  // Top level (1-based, like in EAM) where convection is allowed
+  m_limcnv      = m_params.get<int>("limcnv",1);
+  m_no_deep_pbl = m_params.get<bool>("no_deep_pbl",false);
+  m_use_fortran = m_params.get<bool>("use_fortran",false);
+  EKAT_REQUIRE_MSG (m_limcnv>=1,
+      "Error! Invalid limcnv for ZM (must be >= 1).\n"
+      "   - limcnv: " + std::to_string(m_limcnv) + "\n");
 }
 
+// =========================================================================================
 void ZMDeepConvection::set_grids(const std::shared_ptr<const GridsManager> grids_manager)
 {
-  using namespace std;
-  using namespace ekat;
-  using namespace units;
+  using namespace ekat::units;
 
+  // The units of mixing ratio Q are technically non-dimensional.
+  // Nevertheless, for output reasons, we like to see 'kg/kg'.
   auto Q = kg/kg;
-  auto nondim = m/m;
   Q.set_string("kg/kg");
+  auto nondim = Units::nondimensional();
+  auto mb = 100*Pa;
+  mb.set_string("mb");
 
-  constexpr int NVL = 72;  /* TODO THIS NEEDS TO BE CHANGED TO A CONFIGURABLE */
-  constexpr int QSZ =  35;  /* TODO THIS NEEDS TO BE CHANGED TO A CONFIGURABLE */
   auto grid = grids_manager->get_grid("Physics");
-  const int num_dofs = grid->get_num_local_dofs();
-  const int nc = num_dofs;
+  const auto& grid_name = grid->name();
+  m_num_cols = grid->get_num_local_dofs();
+  m_num_levs = grid->get_num_vertical_levels();
+  const int nc   = m_num_cols;
+  const int nlev = m_num_levs;
+
+  EKAT_REQUIRE_MSG (m_limcnv<=nlev,
+      "Error! Invalid limcnv for ZM (must be <= number of levels).\n"
+      "   - limcnv: " + std::to_string(m_limcnv) + "\n"
+      "   - nlev  : " + std::to_string(nlev) + "\n");
 
   using namespace ShortFieldTagsNames;
 
-  FieldLayout scalar3d_layout_mid { {COL,LEV}, {nc,NVL} }; // Note that C++ and Fortran read array dimensions in reverse
-  FieldLayout scalar3d_layout_int { {COL,ILEV}, {nc,NVL+1} }; // Note that C++ and Fortran read array dimensions in reverse
-  FieldLayout vector3d_layout_mid{ {COL,CMP,LEV}, {nc,QSZ,NVL} };
-  FieldLayout tracers_layout { {COL,CMP,LEV}, {nc,QSZ,NVL} };
-  FieldLayout scalar2d_layout{ {COL}, {nc} };
+  FieldLayout scalar2d_layout     { {COL},         {nc}         };
+  FieldLayout scalar3d_layout_mid { {COL,LEV},     {nc,nlev}    };
+  FieldLayout scalar3d_layout_int { {COL,ILEV},    {nc,nlev+1}  };
+  FieldLayout vector3d_layout_mid { {COL,CMP,LEV}, {nc,2,nlev}  };
 
-  std::vector<FieldLayout> layout_opts = {scalar3d_layout_mid, scalar3d_layout_int,
-					vector3d_layout_mid, tracers_layout, scalar2d_layout};
+  constexpr int ps = Spack::n;
 
-  std::map<std::string, GridOpts> opt_map;
-  set_grid_opts(opt_map);
+  const auto m2 = m*m;
+  const auto s2 = s*s;
 
-  for ( auto i = opt_map.begin(); i != opt_map.end(); ++i) {
-    add_required_field((i->second).name, layout_opts[((i->second).field_idx)], Q, grid->name());
-    if ( (i->second).isOut == true ) {
-      add_computed_field((i->second).name, layout_opts[((i->second).field_idx)], Q, grid->name());
-    }
-  }
+  // Input variables
+  add_field<Required>("T_mid",          scalar3d_layout_mid, K,      grid_name, ps);
+  add_field<Required>("p_mid",          scalar3d_layout_mid, Pa,     grid_name, ps);
+  add_field<Required>("p_int",          scalar3d_layout_int, Pa,     grid_name, ps);
+  add_field<Required>("pseudo_density", scalar3d_layout_mid, Pa,     grid_name, ps);
+  add_field<Required>("phis",           scalar2d_layout,     m2/s2,  grid_name);
+  add_field<Required>("pbl_height",     scalar2d_layout,     m,      grid_name);
+  add_field<Required>("cldfrac_tot",    scalar3d_layout_mid, nondim, grid_name, ps);
+
+  // Input/Output variables. ZM does not transport water vapor, which is only
+  // registered here as an input of the convective core.
+  add_field<Updated>("qv",          scalar3d_layout_mid, Q,   grid_name, "tracers", ps);
+  add_field<Updated>("horiz_winds", vector3d_layout_mid, m/s, grid_name, ps);
 
+  // Tracer group
+  add_group<Updated>("tracers",grid_name,ps,Bundling::Required);
+
+  // Output variables
+  add_field<Computed>("prec",    scalar2d_layout,     m/s,      grid_name);
+  add_field<Computed>("snow",    scalar2d_layout,     m/s,      grid_name);
+  add_field<Computed>("jctop",   scalar2d_layout,     nondim,   grid_name);
+  add_field<Computed>("jcbot",   scalar2d_layout,     nondim,   grid_name);
+  add_field<Computed>("cape",    scalar2d_layout,     m2/s2,    grid_name);
+  add_field<Computed>("dsubcld", scalar2d_layout,     mb,       grid_name);
+  add_field<Computed>("jt",      scalar2d_layout,     nondim,   grid_name);
+  add_field<Computed>("maxg",    scalar2d_layout,     nondim,   grid_name);
+  add_field<Computed>("rliq",    scalar2d_layout,     m/s,      grid_name);
+  add_field<Computed>("qtnd",    scalar3d_layout_mid, Q/s,      grid_name, ps);
+  add_field<Computed>("heat",    scalar3d_layout_mid, W/kg,     grid_name, ps);
+  add_field<Computed>("cme",     scalar3d_layout_mid, Q/s,      grid_name, ps);
+  add_field<Computed>("dlf",     scalar3d_layout_mid, Q/s,      grid_name, ps);
+  add_field<Computed>("zdu",     scalar3d_layout_mid, 1/s,      grid_name, ps);
+  add_field<Computed>("rprd",    scalar3d_layout_mid, Q/s,      grid_name, ps);
+  add_field<Computed>("mu",      scalar3d_layout_mid, mb/s,     grid_name, ps);
+  add_field<Computed>("md",      scalar3d_layout_mid, mb/s,     grid_name, ps);
+  add_field<Computed>("du",      scalar3d_layout_mid, 1/s,      grid_name, ps);
+  add_field<Computed>("eu",      scalar3d_layout_mid, 1/s,      grid_name, ps);
+  add_field<Computed>("ed",      scalar3d_layout_mid, 1/s,      grid_name, ps);
+  add_field<Computed>("dp",      scalar3d_layout_mid, mb,       grid_name, ps);
+  add_field<Computed>("ql",      scalar3d_layout_mid, Q,        grid_name, ps);
+  add_field<Computed>("tend_s",  scalar3d_layout_mid, W/kg,     grid_name, ps);
+  add_field<Computed>("tend_q",  scalar3d_layout_mid, Q/s,      grid_name, ps);
+  add_field<Computed>("ntprprd", scalar3d_layout_mid, Q/s,      grid_name, ps);
+  add_field<Computed>("ntsnprd", scalar3d_layout_mid, Q/s,      grid_name, ps);
+  add_field<Computed>("mcon",    scalar3d_layout_int, mb/s,     grid_name, ps);
+  add_field<Computed>("pflx",    scalar3d_layout_int, kg/m2/s,  grid_name, ps);
+  add_field<Computed>("flxprec", scalar3d_layout_int, kg/m2/s,  grid_name, ps);
+  add_field<Computed>("flxsnow", scalar3d_layout_int, kg/m2/s,  grid_name, ps);
+  add_field<Computed>("pguall",  vector3d_layout_mid, m/s2,     grid_name, ps);
+  add_field<Computed>("pgdall",  vector3d_layout_mid, m/s2,     grid_name, ps);
+  add_field<Computed>("icwu",    vector3d_layout_mid, m/s,      grid_name, ps);
 }
 
 // =========================================================================================
-void ZMDeepConvection::initialize_impl (const RunType /* run_type */)
+void ZMDeepConvection::
+set_computed_group_impl (const FieldGroup& group)
 {
-  zm_init_f90 (*m_raw_ptrs_in["limcnv_in"], m_raw_ptrs_in["no_deep_pbl_in"]);
+  const auto& name = group.m_info->m_group_name;
+
+  EKAT_REQUIRE_MSG(name=="tracers",
+    "Error! We were not expecting a field group called '" << name << "\n");
+
+  EKAT_REQUIRE_MSG(group.m_info->m_bundled,
+      "Error! ZM expects bundled fields for tracers.\n");
+
+  // Calculate number of advected tracers
+  m_num_tracers = group.m_info->size();
 }
+
 // =========================================================================================
-void ZMDeepConvection::run_impl (const double dt)
+size_t ZMDeepConvection::requested_buffer_size_in_bytes() const
 {
-  std::vector<const Real*> in;
-  std::vector<Real*> out;
+  // Number of Reals needed by local views in the interface
+  const size_t interface_request = Buffer::num_1d_scalar_ncol*m_num_cols*sizeof(Real) +
+                                   Buffer::num_2d_scalar_mid*m_num_cols*m_num_levs*sizeof(Real) +
+                                   Buffer::num_2d_scalar_int*m_num_cols*(m_num_levs+1)*sizeof(Real);
 
-  // Copy inputs to host. Copy also outputs, cause we might "update" them, rather than overwrite them.
-  for (auto& it : m_zm_fields_in) {
-    it.second.sync_to_host();
-  }
-  for (auto& it : m_zm_fields_out) {
-    it.second.sync_to_host();
+  // Number of Reals needed by the WorkspaceManager passed to zm_main
+  const int nlevi_packs    = ekat::npack<Spack>(m_num_levs+1);
+  const auto policy        = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nlevi_packs);
+  const size_t wsm_request = WSM::get_total_bytes_needed(nlevi_packs, 41, policy);
+
+  return interface_request + wsm_request;
+}
+
+// =========================================================================================
+void ZMDeepConvection::init_buffers(const ATMBufferManager &buffer_manager)
+{
+  EKAT_REQUIRE_MSG(buffer_manager.allocated_bytes() >= requested_buffer_size_in_bytes(), "Error! Buffers size not sufficient.\n");
+
+  Real* mem = reinterpret_cast<Real*>(buffer_manager.get_memory());
+
+  // 1d scalar views
+  using scalar_view_t = decltype(m_buffer.tpert);
+  scalar_view_t* _1d_scalar_view_ptrs[Buffer::num_1d_scalar_ncol] =
+    {&m_buffer.tpert, &m_buffer.landfrac};
+  for (int i = 0; i < Buffer::num_1d_scalar_ncol; ++i) {
+    *_1d_scalar_view_ptrs[i] = scalar_view_t(mem, m_num_cols);
+    mem += _1d_scalar_view_ptrs[i]->size();
   }
 
-  Real** temp = &m_raw_ptrs_out["fracis"];
-  Real*** fracis = &temp;
-
-  zm_main_f90(*m_raw_ptrs_out["lchnk"], *m_raw_ptrs_out["ncol"], m_raw_ptrs_out["t"],
-  	      m_raw_ptrs_out["qh"], m_raw_ptrs_out["prec"], m_raw_ptrs_out["jctop"],
-              m_raw_ptrs_out["jcbot"], m_raw_ptrs_out["pblh"], m_raw_ptrs_out["zm"],
-              m_raw_ptrs_out["geos"], m_raw_ptrs_out["zi"], m_raw_ptrs_out["qtnd"],
-              m_raw_ptrs_out["heat"], m_raw_ptrs_out["pap"], m_raw_ptrs_out["paph"],
-              m_raw_ptrs_out["dpp"], *m_raw_ptrs_out["delt"], m_raw_ptrs_out["mcon"],
-	      m_raw_ptrs_out["cme"], m_raw_ptrs_out["cape"], m_raw_ptrs_out["tpert"],
-              m_raw_ptrs_out["dlf"], m_raw_ptrs_out["plfx"], m_raw_ptrs_out["zdu"],
-	      m_raw_ptrs_out["rprd"], m_raw_ptrs_out["mu"], m_raw_ptrs_out["md"],
-              m_raw_ptrs_out["du"], m_raw_ptrs_out["eu"], m_raw_ptrs_out["ed"],
-	      m_raw_ptrs_out["dp"], m_raw_ptrs_out["dsubcld"], m_raw_ptrs_out["jt"],
-	      m_raw_ptrs_out["maxg"], m_raw_ptrs_out["ideep"], *m_raw_ptrs_out["lengath"],
-              m_raw_ptrs_out["ql"], m_raw_ptrs_out["rliq"], m_raw_ptrs_out["landfrac"],
-              m_raw_ptrs_out["hu_nm1"], m_raw_ptrs_out["cnv_nm1"], m_raw_ptrs_out["tm1"],
-              m_raw_ptrs_out["qm1"], &m_raw_ptrs_out["t_star"], &m_raw_ptrs_out["q_star"],
-              m_raw_ptrs_out["dcape"], m_raw_ptrs_out["qv"], &m_raw_ptrs_out["tend_s"],
-              &m_raw_ptrs_out["tend_q"], &m_raw_ptrs_out["cld"], m_raw_ptrs_out["snow"],
-              m_raw_ptrs_out["ntprprd"], m_raw_ptrs_out["ntsnprd"],
-              &m_raw_ptrs_out["flxprec"], &m_raw_ptrs_out["flxsnow"],
-              *m_raw_ptrs_out["ztodt"], m_raw_ptrs_out["pguall"], m_raw_ptrs_out["pgdall"],
-              m_raw_ptrs_out["icwu"], *m_raw_ptrs_out["ncnst"], fracis);
-  auto ts = timestamp();
-  ts += dt;
-  for (auto& it : m_zm_fields_out) {
-    it.second.get_header().get_tracking().update_time_stamp(ts);
+  // 2d scalar views
+  using scalar_2d_view_t = decltype(m_buffer.z_mid);
+  scalar_2d_view_t* _2d_scalar_mid_view_ptrs[Buffer::num_2d_scalar_mid] =
+    {&m_buffer.dz, &m_buffer.z_mid};
+  for (int i = 0; i < Buffer::num_2d_scalar_mid; ++i) {
+    *_2d_scalar_mid_view_ptrs[i] = scalar_2d_view_t(mem, m_num_cols, m_num_levs);
+    mem += _2d_scalar_mid_view_ptrs[i]->size();
   }
+  m_buffer.z_int = scalar_2d_view_t(mem, m_num_cols, m_num_levs+1);
+  mem += m_buffer.z_int.size();
+
+  Spack* s_mem = reinterpret_cast<Spack*>(mem);
+
+  // WSM data
+  m_buffer.wsm_data = s_mem;
+
+  const int nlevi_packs = ekat::npack<Spack>(m_num_levs+1);
+  const auto policy     = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nlevi_packs);
+  const int wsm_size    = WSM::get_total_bytes_needed(nlevi_packs, 41, policy)/sizeof(Spack);
+  s_mem += wsm_size;
+
+  size_t used_mem = (reinterpret_cast<Real*>(s_mem) - buffer_manager.get_memory())*sizeof(Real);
+  EKAT_REQUIRE_MSG(used_mem==requested_buffer_size_in_bytes(), "Error! Used memory != requested memory for ZMDeepConvection.");
 }
+
 // =========================================================================================
-void ZMDeepConvection::finalize_impl()
+void ZMDeepConvection::initialize_impl (const RunType /* run_type */)
 {
-  zm_finalize_f90 ();
+  const auto& T_mid          = get_field_in("T_mid").get_view<const Real**>();
+  const auto& p_mid          = get_field_in("p_mid").get_view<const Real**>();
+  const auto& pseudo_density = get_field_in("pseudo_density").get_view<const Real**>();
+  const auto& qv             = get_field_out("qv").get_view<const Real**>();
+
+  // Heights above the surface, computed at each step by zm_preprocess
+  const Real z_surf = 0.0;
+  zm_preprocess.set_variables(m_num_levs,z_surf,T_mid,p_mid,pseudo_density,qv,
+                              m_buffer.dz,m_buffer.z_mid,m_buffer.z_int);
+
+  // EAMxx has no PBL temperature perturbation (ZM only uses it if tp_fac!=0),
+  // and no land fraction yet (ZM only uses it to pick the autoconversion
+  // coefficient, which is the same over land and ocean by default).
+  Kokkos::deep_copy(m_buffer.tpert,0);
+  Kokkos::deep_copy(m_buffer.landfrac,0);
+
+  m_input.T_mid          = T_mid;
+  m_input.qv             = qv;
+  m_input.p_mid          = p_mid;
+  m_input.p_int          = get_field_in("p_int").get_view<const Real**>();
+  m_input.pseudo_density = pseudo_density;
+  m_input.z_mid          = m_buffer.z_mid;
+  m_input.z_int          = m_buffer.z_int;
+  m_input.phis           = get_field_in("phis").get_view<const Real*>();
+  m_input.pblh           = get_field_in("pbl_height").get_view<const Real*>();
+  m_input.tpert          = m_buffer.tpert;
+  m_input.landfrac       = m_buffer.landfrac;
+  m_input.cldfrac        = get_field_in("cldfrac_tot").get_view<const Real**>();
+
+  m_input_output.horiz_winds = get_field_out("horiz_winds").get_view<Real***>();
+  m_input_output.tracers     = get_group_out("tracers").m_bundle->get_view<Real***>();
+
+  // Water species are not transported by ZM: their convective transport is
+  // represented via the detrainment of cloud water (dlf), like in EAM.
+  const auto& tracer_info = get_group_out("tracers").m_info;
+  const std::set<std::string> no_transport = {"qv", "qc", "qi", "nc", "ni"};
+  view_1d<bool> doconvtran("doconvtran",m_num_tracers);
+  auto doconvtran_h = Kokkos::create_mirror_view(doconvtran);
+  for (const auto& it : tracer_info->m_subview_idx) {
+    doconvtran_h(it.second) = no_transport.count(it.first)==0;
+  }
+  Kokkos::deep_copy(doconvtran,doconvtran_h);
+  m_input_output.doconvtran = doconvtran;
+
+  m_output.prec    = get_field_out("prec").get_view<Real*>();
+  m_output.snow    = get_field_out("snow").get_view<Real*>();
+  m_output.jctop   = get_field_out("jctop").get_view<Real*>();
+  m_output.jcbot   = get_field_out("jcbot").get_view<Real*>();
+  m_output.qtnd    = get_field_out("qtnd").get_view<Real**>();
+  m_output.heat    = get_field_out("heat").get_view<Real**>();
+  m_output.mcon    = get_field_out("mcon").get_view<Real**>();
+  m_output.cme     = get_field_out("cme").get_view<Real**>();
+  m_output.cape    = get_field_out("cape").get_view<Real*>();
+  m_output.dlf     = get_field_out("dlf").get_view<Real**>();
+  m_output.pflx    = get_field_out("pflx").get_view<Real**>();
+  m_output.zdu     = get_field_out("zdu").get_view<Real**>();
+  m_output.rprd    = get_field_out("rprd").get_view<Real**>();
+  m_output.mu      = get_field_out("mu").get_view<Real**>();
+  m_output.md      = get_field_out("md").get_view<Real**>();
+  m_output.du      = get_field_out("du").get_view<Real**>();
+  m_output.eu      = get_field_out("eu").get_view<Real**>();
+  m_output.ed      = get_field_out("ed").get_view<Real**>();
+  m_output.dp      = get_field_out("dp").get_view<Real**>();
+  m_output.dsubcld = get_field_out("dsubcld").get_view<Real*>();
+  m_output.jt      = get_field_out("jt").get_view<Real*>();
+  m_output.maxg    = get_field_out("maxg").get_view<Real*>();
+  m_output.ql      = get_field_out("ql").get_view<Real**>();
+  m_output.rliq    = get_field_out("rliq").get_view<Real*>();
+  m_output.tend_s  = get_field_out("tend_s").get_view<Real**>();
+  m_output.tend_q  = get_field_out("tend_q").get_view<Real**>();
+  m_output.ntprprd = get_field_out("ntprprd").get_view<Real**>();
+  m_output.ntsnprd = get_field_out("ntsnprd").get_view<Real**>();
+  m_output.flxprec = get_field_out("flxprec").get_view<Real**>();
+  m_output.flxsnow = get_field_out("flxsnow").get_view<Real**>();
+  m_output.pguall  = get_field_out("pguall").get_view<Real***>();
+  m_output.pgdall  = get_field_out("pgdall").get_view<Real***>();
+  m_output.icwu    = get_field_out("icwu").get_view<Real***>();
+
+  // Setup WSM for internal local variables
+  const auto nlevi_packs    = ekat::npack<Spack>(m_num_levs+1);
+  const auto default_policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nlevi_packs);
+  m_workspace_mgr.setup(m_buffer.wsm_data, nlevi_packs, 41, default_policy);
+
+  if (m_use_fortran) {
+    zm_init_f90 (m_limcnv, m_no_deep_pbl, m_num_cols, m_num_levs);
+  }
 }
 // =========================================================================================
-void ZMDeepConvection::
-register_fields (const std::map<std::string,std::shared_ptr<FieldManager<Real>>>& field_mgrs) const {
-  auto& field_mgr = *field_mgrs.at("Physics");
-   for (const auto& fid : get_required_fields()) {
-     field_mgr.register_field(fid);
-   }
-   for (const auto& fid : get_computed_fields()) {
-     field_mgr.register_field(fid);
-   }
- }
-
-void ZMDeepConvection::set_required_field_impl (const Field<const Real>& f) {
-  // @Meredith: Diff between add_me_as_a_customer and get_tracking().add_customer?
-
-  // Store a copy of the field. We need this in order to do some tracking checks
-  // at the beginning of the run call. Other than that, there would be really
-  // no need to store a scream field here; we could simply set the view ptr
-  // in the Homme's view, and be done with it.
-  const auto& name = f.get_header().get_identifier().name();
-  m_zm_fields_in.emplace(name,f);
-  m_zm_host_views_in[name] = f.get_view<Host>();
-  m_raw_ptrs_in[name] = m_zm_host_views_in[name].data();
-
-  // Add myself as customer to the field
-  add_me_as_customer(f);
+void ZMDeepConvection::run_impl (const double dt)
+{
+  // Heights above the surface. Kernel contains a parallel_scan,
+  // so a special TeamPolicy is required.
+  const auto nlev_packs  = ekat::npack<Spack>(m_num_levs);
+  const auto scan_policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_thread_range_parallel_scan_team_policy(m_num_cols, nlev_packs);
+  Kokkos::parallel_for("zm_preprocess",
+                       scan_policy,
+                       zm_preprocess);
+  Kokkos::fence();
 
-}
+  if (m_use_fortran) {
+    run_f90(dt);
+    return;
+  }
 
-void ZMDeepConvection::set_computed_field_impl (const Field<      Real>& f) {
-  // Store a copy of the field. We need this in order to do some tracking updates
-  // at the end of the run call. Other than that, there would be really
-  // no need to store a scream field here; we could simply set the view ptr
-  // in the Homme's view, and be done with it.
-  const auto& name = f.get_header().get_identifier().name();
-  m_zm_fields_out.emplace(name,f);
-  m_zm_host_views_out[name] = f.get_view<Host>();
-  m_raw_ptrs_out[name] = m_zm_host_views_out[name].data();
-
-  // Add myself as provider for the field
-  add_me_as_provider(f);
+  // Reset internal WSM variables.
+  m_workspace_mgr.reset_internals();
+
+  ZMF::zm_main(m_num_cols, m_num_levs, m_limcnv, m_no_deep_pbl, dt, m_workspace_mgr,
+               m_input, m_input_output, m_output);
 }
+// =========================================================================================
+void ZMDeepConvection::run_f90 (const double dt)
+{
+  // The Fortran routines expect (pcols,pver) arrays, so the data is copied
+  // to host, and transposed, in and out.
+  const int ncol  = m_num_cols;
+  const int nlev  = m_num_levs;
+  const int ntrac = m_num_tracers;
 
-} // namespace scream
+  using f90_array = std::vector<Real>;
+  auto to_f90_1d = [&] (const auto& v) {
+    const auto h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),v);
+    f90_array a(ncol);
+    for (int i=0; i<ncol; ++i) {
+      a[i] = h(i);
+    }
+    return a;
+  };
+  auto to_f90_2d = [&] (const auto& v, const int nk) {
+    const auto h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),v);
+    f90_array a(ncol*nk);
+    for (int k=0; k<nk; ++k) {
+      for (int i=0; i<ncol; ++i) {
+        a[i+k*ncol] = h(i,k);
+      }
+    }
+    return a;
+  };
+  // Views with layout (ncol,ncmp,nlev) <-> (pcols,pver,ncmp) arrays
+  auto to_f90_3d = [&] (const auto& v) {
+    const auto h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),v);
+    const int ncmp = h.extent(1);
+    f90_array a(ncol*nlev*ncmp);
+    for (int m=0; m<ncmp; ++m) {
+      for (int k=0; k<nlev; ++k) {
+        for (int i=0; i<ncol; ++i) {
+          a[i+k*ncol+m*ncol*nlev] = h(i,m,k);
+        }
+      }
+    }
+    return a;
+  };
+  auto from_f90_1d = [&] (const f90_array& a, const auto& v) {
+    const auto h = Kokkos::create_mirror_view(v);
+    for (int i=0; i<ncol; ++i) {
+      h(i) = a[i];
+    }
+    Kokkos::deep_copy(v,h);
+  };
+  auto from_f90_2d = [&] (const f90_array& a, const auto& v, const int nk) {
+    const auto h = Kokkos::create_mirror_view(v);
+    Kokkos::deep_copy(h,v);
+    for (int k=0; k<nk; ++k) {
+      for (int i=0; i<ncol; ++i) {
+        h(i,k) = a[i+k*ncol];
+      }
+    }
+    Kokkos::deep_copy(v,h);
+  };
+  auto from_f90_3d = [&] (const f90_array& a, const auto& v) {
+    const auto h = Kokkos::create_mirror_view(v);
+    Kokkos::deep_copy(h,v);
+    const int ncmp = h.extent(1);
+    for (int m=0; m<ncmp; ++m) {
+      for (int k=0; k<nlev; ++k) {
+        for (int i=0; i<ncol; ++i) {
+          h(i,m,k) = a[i+k*ncol+m*ncol*nlev];
+        }
+      }
+    }
+    Kokkos::deep_copy(v,h);
+  };
 
-namespace {
-//Initializes struct GridOpts fields
-void set_grid_opts_helper(std::map<std::string, GridOpts>& opt_map,
-                          const std::string& n, bool out, int field_idx,
-                          const ekat::units::Units& unit = ekat::units::Units::nondimensional())
-{
-  opt_map.emplace(std::piecewise_construct,
-                  std::forward_as_tuple(n),
-                  std::forward_as_tuple(n,out,unit,field_idx));
-}
+  // Inputs
+  const auto t        = to_f90_2d(m_input.T_mid,nlev);
+  const auto qh       = to_f90_2d(m_input.qv,nlev);
+  const auto pap      = to_f90_2d(m_input.p_mid,nlev);
+  const auto paph     = to_f90_2d(m_input.p_int,nlev+1);
+  const auto dpp      = to_f90_2d(m_input.pseudo_density,nlev);
+  const auto zm       = to_f90_2d(m_input.z_mid,nlev);
+  const auto zi       = to_f90_2d(m_input.z_int,nlev+1);
+  const auto geos     = to_f90_1d(m_input.phis);
+  const auto pblh     = to_f90_1d(m_input.pblh);
+  const auto tpert    = to_f90_1d(m_input.tpert);
+  const auto landfrac = to_f90_1d(m_input.landfrac);
+  const auto cld      = to_f90_2d(m_input.cldfrac,nlev);
+  const auto doconvtran = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),m_input_output.doconvtran);
+
+  // Inputs/outputs
+  auto winds   = to_f90_3d(m_input_output.horiz_winds);
+  auto tracers = to_f90_3d(m_input_output.tracers);
+
+  // Outputs
+  f90_array prec(ncol), snow(ncol), jctop(ncol), jcbot(ncol), cape(ncol),
+            dsubcld(ncol), jt(ncol), maxg(ncol), rliq(ncol);
+  f90_array qtnd(ncol*nlev), heat(ncol*nlev), cme(ncol*nlev), dlf(ncol*nlev),
+            zdu(ncol*nlev), rprd(ncol*nlev), mu(ncol*nlev), md(ncol*nlev),
+            du(ncol*nlev), eu(ncol*nlev), ed(ncol*nlev), dp(ncol*nlev), ql(ncol*nlev),
+            tend_s(ncol*nlev), tend_q(ncol*nlev), ntprprd(ncol*nlev), ntsnprd(ncol*nlev);
+  f90_array mcon(ncol*(nlev+1)), pflx(ncol*(nlev+1)), flxprec(ncol*(nlev+1)), flxsnow(ncol*(nlev+1));
+  f90_array pguall(ncol*nlev*2), pgdall(ncol*nlev*2), icwu(ncol*nlev*2);
 
-void set_grid_opts(std::map<std::string, GridOpts>& opt_map){
-  //Layout options are set as an int
-  //to be passed into the GridOpts struct
-  const int SCALAR_3D_MID = 0;
-  const int SCALAR_3D_INT = 1;
-  const int VECTOR_3D_MID = 2;
-  const int LINEAR = 4;
-
-  const auto Pa = ekat::units::Pa;
-
-  // Sets the value of the grid opt struct categories
-  set_grid_opts_helper(opt_map, "limcnv_in",       true, 0);
-  set_grid_opts_helper(opt_map, "no_deep_pbl_in",  true, VECTOR_3D_MID);
-  set_grid_opts_helper(opt_map, "lchnk",           true, SCALAR_3D_MID, Pa); //temperature(K)
-  set_grid_opts_helper(opt_map, "ncol",            true, SCALAR_3D_MID, Pa); //temperature(K)
-  set_grid_opts_helper(opt_map, "t",               true, SCALAR_3D_MID, Pa); //temperature(K)
-  set_grid_opts_helper(opt_map, "qh",              true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "prec",            true, LINEAR);
-  set_grid_opts_helper(opt_map, "jctop",           true, LINEAR);
-  set_grid_opts_helper(opt_map, "jcbot",           true, LINEAR);
-  set_grid_opts_helper(opt_map, "pblh",            true, LINEAR);
-  set_grid_opts_helper(opt_map, "zm",              true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "geos",            true, LINEAR);
-  set_grid_opts_helper(opt_map, "zi",              true, SCALAR_3D_INT);
-  set_grid_opts_helper(opt_map, "qtnd",            true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "heat",            true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "pap",             true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "paph",            true, SCALAR_3D_INT);
-  set_grid_opts_helper(opt_map, "dpp",             true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "delt",            true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "mcon",            true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "cme",             true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "cape",            true, LINEAR);
-  set_grid_opts_helper(opt_map, "tpert",           true, LINEAR);
-  set_grid_opts_helper(opt_map, "dlf",             true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "pflx",            true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "zdu",             true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "rprd",            true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "mu",              true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "md",              true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "du",              true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "eu",              true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "ed",              true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "dp",              true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "dsubcld",         true, LINEAR);
-  set_grid_opts_helper(opt_map, "jt",              true, LINEAR);
-  set_grid_opts_helper(opt_map, "maxg",            true, LINEAR);
-  set_grid_opts_helper(opt_map, "ideep",           true, LINEAR);
-  set_grid_opts_helper(opt_map, "lengath",         true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "ql",              true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "rliq",            true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "landfrac",        true, LINEAR);
-  set_grid_opts_helper(opt_map, "hu_nm1",          true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "cnv_nm1",         true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "tm1",             true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "qm1",             true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "t_star",          true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "q_star",          true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "dcape",           true, LINEAR);
-  set_grid_opts_helper(opt_map, "qv",              true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "tend_s",          true, LINEAR);
-  set_grid_opts_helper(opt_map, "tend_q",          true, LINEAR);
-  set_grid_opts_helper(opt_map, "cld",             true, LINEAR);
-  set_grid_opts_helper(opt_map, "snow",            true, LINEAR);
-  set_grid_opts_helper(opt_map, "ntprprd",         true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "ntsnprd",         true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "flxprec",         true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "flxsnow",         true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "ztodt",           true, SCALAR_3D_MID);
-  set_grid_opts_helper(opt_map, "pguall",          true, VECTOR_3D_MID);
-  set_grid_opts_helper(opt_map, "pgdall",          true, VECTOR_3D_MID);
-  set_grid_opts_helper(opt_map, "icwu",            true, VECTOR_3D_MID);
-  set_grid_opts_helper(opt_map, "ncnst",           true, VECTOR_3D_MID);
-  set_grid_opts_helper(opt_map, "fracis",          true, VECTOR_3D_MID);
+  zm_main_f90(ncol, dt, t.data(), qh.data(), pap.data(), paph.data(), dpp.data(),
+              zm.data(), zi.data(), geos.data(), pblh.data(), tpert.data(), landfrac.data(),
+              cld.data(), ntrac, doconvtran.data(), winds.data(), tracers.data(),
+              prec.data(), snow.data(), jctop.data(), jcbot.data(), qtnd.data(), heat.data(),
+              mcon.data(), cme.data(), cape.data(), dlf.data(), pflx.data(), zdu.data(), rprd.data(),
+              mu.data(), md.data(), du.data(), eu.data(), ed.data(), dp.data(), dsubcld.data(),
+              jt.data(), maxg.data(), ql.data(), rliq.data(), tend_s.data(), tend_q.data(),
+              ntprprd.data(), ntsnprd.data(), flxprec.data(), flxsnow.data(),
+              pguall.data(), pgdall.data(), icwu.data());
+
+  from_f90_3d(winds,   m_input_output.horiz_winds);
+  from_f90_3d(tracers, m_input_output.tracers);
+
+  from_f90_1d(prec,    m_output.prec);
+  from_f90_1d(snow,    m_output.snow);
+  from_f90_1d(jctop,   m_output.jctop);
+  from_f90_1d(jcbot,   m_output.jcbot);
+  from_f90_1d(cape,    m_output.cape);
+  from_f90_1d(dsubcld, m_output.dsubcld);
+  from_f90_1d(jt,      m_output.jt);
+  from_f90_1d(maxg,    m_output.maxg);
+  from_f90_1d(rliq,    m_output.rliq);
+  from_f90_2d(qtnd,    m_output.qtnd,    nlev);
+  from_f90_2d(heat,    m_output.heat,    nlev);
+  from_f90_2d(cme,     m_output.cme,     nlev);
+  from_f90_2d(dlf,     m_output.dlf,     nlev);
+  from_f90_2d(zdu,     m_output.zdu,     nlev);
+  from_f90_2d(rprd,    m_output.rprd,    nlev);
+  from_f90_2d(mu,      m_output.mu,      nlev);
+  from_f90_2d(md,      m_output.md,      nlev);
+  from_f90_2d(du,      m_output.du,      nlev);
+  from_f90_2d(eu,      m_output.eu,      nlev);
+  from_f90_2d(ed,      m_output.ed,      nlev);
+  from_f90_2d(dp,      m_output.dp,      nlev);
+  from_f90_2d(ql,      m_output.ql,      nlev);
+  from_f90_2d(tend_s,  m_output.tend_s,  nlev);
+  from_f90_2d(tend_q,  m_output.tend_q,  nlev);
+  from_f90_2d(ntprprd, m_output.ntprprd, nlev);
+  from_f90_2d(ntsnprd, m_output.ntsnprd, nlev);
+  from_f90_2d(mcon,    m_output.mcon,    nlev+1);
+  from_f90_2d(pflx,    m_output.pflx,    nlev+1);
+  from_f90_2d(flxprec, m_output.flxprec, nlev+1);
+  from_f90_2d(flxsnow, m_output.flxsnow, nlev+1);
+  from_f90_3d(pguall,  m_output.pguall);
+  from_f90_3d(pgdall,  m_output.pgdall);
+  from_f90_3d(icwu,    m_output.icwu);
+}
+// =========================================================================================
+void ZMDeepConvection::finalize_impl()
+{
+  if (m_use_fortran) {
+    zm_finalize_f90 ();
+  }
 }
-} // anonymous namespace
 
+} // namespace scream
@@ -2,6 +2,9 @@
 #define SCREAM_ZM_DEEPCONVECTION_HPP
 
 #include "share/atm_process/atmosphere_process.hpp"
+#include "share/atm_process/ATMBufferManager.hpp"
+#include "share/util/scream_common_physics_functions.hpp"
+#include "physics/zm/zm_functions.hpp"
 #include "ekat/ekat_parameter_list.hpp"
 
 #include <string>
@@ -15,13 +18,39 @@ namespace scream
  * The AD should store exactly ONE instance of this class stored
  * in its list of subcomponents (the AD should make sure of this).
  *
+ * The temperature and water vapor tendencies of ZM (heat, qtnd, tend_s,
+ * tend_q) are outputs, like in EAM, where they are applied by the physics
+ * driver. The horizontal winds and the tracers (except water species) are
+ * instead transported in place.
+ *
+ * Two code paths are available:
+ *  - the default one runs the ported ZM column kernels (ZMF::zm_main)
+ *    directly on the field device views, one team per column;
+ *  - if the parameter 'use_fortran' is true, the whole scheme is run
+ *    through the Fortran zm_main_f90 on host. This is kept for BFB
+ *    comparisons against EAM.
 */
 
 class ZMDeepConvection : public AtmosphereProcess
 {
+  using ZMF          = zm::Functions<Real, DefaultDevice>;
+  using PF           = scream::PhysicsFunctions<DefaultDevice>;
+  using KT           = ekat::KokkosTypes<DefaultDevice>;
+
+  using Spack        = typename ZMF::Spack;
+  using WSM          = typename ZMF::WorkspaceMgr;
+
+  template<typename ScalarT>
+  using view_1d  = typename KT::template view_1d<ScalarT>;
+  template<typename ScalarT>
+  using view_2d  = typename KT::template view_2d<ScalarT>;
+
+  template<typename ScalarT>
+  using uview_1d = ekat::Unmanaged<view_1d<ScalarT>>;
+  template<typename ScalarT>
+  using uview_2d = ekat::Unmanaged<view_2d<ScalarT>>;
+
 public:
-  using field_type       = Field<      Real>;
-  using const_field_type = Field<const Real>;
 
   // Constructors
   ZMDeepConvection (const ekat::Comm& comm, const ekat::ParameterList& params);
@@ -35,34 +64,114 @@ public:
   // Set the grid
   void set_grids (const std::shared_ptr<const GridsManager> grids_manager);
 
-  // The three main interfaces for the subcomponent
+  // Structure to compute the heights above the surface, which ZM needs at
+  // midpoints and interfaces.
+  struct ZMPreprocess {
+    ZMPreprocess() = default;
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const Kokkos::TeamPolicy<KT::ExeSpace>::member_type& team) const {
+      const int i = team.league_rank();
+
+      const auto dz_s    = ekat::subview(dz, i);
+      const auto z_int_s = ekat::subview(z_int, i);
+      const auto z_mid_s = ekat::subview(z_mid, i);
+      PF::calculate_dz(team, ekat::subview(pseudo_density, i), ekat::subview(p_mid, i),
+                       ekat::subview(T_mid, i), ekat::subview(qv, i), dz_s);
+      team.team_barrier();
+      PF::calculate_z_int(team, nlev, dz_s, z_surf, z_int_s);
+      team.team_barrier();
+      PF::calculate_z_mid(team, nlev, z_int_s, z_mid_s);
+    } // operator
+
+    // Local variables
+    int nlev;
+    Real z_surf;
+    view_2d<const Real> T_mid;
+    view_2d<const Real> p_mid;
+    view_2d<const Real> pseudo_density;
+    view_2d<const Real> qv;
+    uview_2d<Real> dz;
+    uview_2d<Real> z_mid;
+    uview_2d<Real> z_int;
+
+    // Assigning local variables
+    void set_variables(const int nlev_, const Real z_surf_,
+                       const view_2d<const Real>& T_mid_, const view_2d<const Real>& p_mid_,
+                       const view_2d<const Real>& pseudo_density_, const view_2d<const Real>& qv_,
+                       const uview_2d<Real>& dz_, const uview_2d<Real>& z_mid_, const uview_2d<Real>& z_int_)
+    {
+      nlev = nlev_;
+      z_surf = z_surf_;
+      T_mid = T_mid_;
+      p_mid = p_mid_;
+      pseudo_density = pseudo_density_;
+      qv = qv_;
+      dz = dz_;
+      z_mid = z_mid_;
+      z_int = z_int_;
+    } // set_variables
+  }; // ZMPreprocess
+
+  // Structure for storing local variables initialized using the ATMBufferManager
+  struct Buffer {
+    static constexpr int num_1d_scalar_ncol = 2;
+    static constexpr int num_2d_scalar_mid  = 2;
+    static constexpr int num_2d_scalar_int  = 1;
+
+    uview_1d<Real> tpert;
+    uview_1d<Real> landfrac;
+
+    uview_2d<Real> dz;
+    uview_2d<Real> z_mid;
+    uview_2d<Real> z_int;
+
+    Spack* wsm_data;
+  };
+
+#ifndef KOKKOS_ENABLE_CUDA
+  // Cuda requires methods enclosing __device__ lambda's to be public
+protected:
+#endif
+
   void initialize_impl (const RunType run_type);
+
+protected:
+
   void run_impl        (const double dt);
   void finalize_impl   ();
 
-  // Register all fields in the proper field manager(s).
-  // Note: field_mgrs[grid_name] is the FM on grid $grid_name
-  void register_fields (const std::map<std::string,std::shared_ptr<FieldManager<Real>>>& field_mgrs) const;
+  // Run the whole scheme through the Fortran implementation (BFB path)
+  void run_f90 (const double dt);
 
-protected:
+  void set_computed_group_impl (const FieldGroup& group);
+
+  // Computes total number of bytes needed for local variables
+  size_t requested_buffer_size_in_bytes() const;
+
+  // Set local variables using memory provided by
+  // the ATMBufferManager
+  void init_buffers(const ATMBufferManager &buffer_manager);
 
-  std::map<std::string,const_field_type>  m_zm_fields_in;
-  std::map<std::string,field_type>        m_zm_fields_out;
+  Int  m_num_cols;
+  Int  m_num_levs;
+  Int  m_num_tracers;
+  Int  m_limcnv;
+  bool m_no_deep_pbl;
+  bool m_use_fortran;
 
-  template<typename T>
-  using view_type = field_type::view_type<T*>;
+  // Struct which contains local variables
+  Buffer m_buffer;
 
-  template<typename T>
-  using host_view_type = field_type::get_view_type<view_type<T>,Host>;
+  // Store the structures for each argument to zm_main;
+  ZMF::ZMInput         m_input;
+  ZMF::ZMInputOutput   m_input_output;
+  ZMF::ZMOutput        m_output;
 
-  using host_view_in_type   = host_view_type<const_field_type::RT>;
-  using host_view_out_type  = host_view_type<      field_type::RT>;
+  ZMPreprocess zm_preprocess;
 
-  std::map<std::string,host_view_in_type>   m_zm_host_views_in;
-  std::map<std::string,host_view_out_type>  m_zm_host_views_out;
-  
-  std::map<std::string,const Real*>  m_raw_ptrs_in;
-  std::map<std::string,Real*>        m_raw_ptrs_out;
+  // WSM for internal local variables
+  WSM m_workspace_mgr;
 
 }; // class ZMDeepConvection
 
@@ -0,0 +1,13 @@
+#include "zm_cldfrc_fice_impl.hpp"
+
+namespace scream {
+namespace zm {
+
+/*
+ * Explicit instantiation for using the default device.
+ */
+
+template struct Functions<Real,DefaultDevice>;
+
+} // namespace zm
+} // namespace scream
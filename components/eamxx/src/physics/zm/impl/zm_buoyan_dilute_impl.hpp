@@ -0,0 +1,303 @@
+#ifndef ZM_BUOYAN_DILUTE_IMPL_HPP
+#define ZM_BUOYAN_DILUTE_IMPL_HPP
+
+#include "zm_functions.hpp" // for ETI only but harmless for GPU
+
+namespace scream {
+namespace zm {
+
+/*
+ * Implementation of zm buoyan_dilute and parcel_dilute. Clients should NOT
+ * #include this file, #include zm_functions.hpp instead.
+ *
+ * These are ports of the routines with the same names in zm_conv.F90, for
+ * the default configuration (no trigmem/dcape-ull triggers, PERGRO not defined).
+ * They work on a single column, and are meant to be called by a single thread.
+ * Level indices are 0-based, and msg is the number of levels at the model top
+ * where convection is not allowed (limcnv-1).
+ */
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>
+::parcel_dilute(
+  const Int&                    nlev,
+  const Int&                    msg,
+  const Int&                    klaunch,
+  const uview_1d<const Scalar>& p,
+  const uview_1d<const Scalar>& t,
+  const uview_1d<const Scalar>& q,
+  const Scalar&                 tpert,
+  const uview_1d<Scalar>&       tp,
+  const uview_1d<Scalar>&       tpv,
+  const uview_1d<Scalar>&       qstp,
+  Scalar&                       pl,
+  Scalar&                       tl,
+  Int&                          lcl,
+  const uview_1d<Scalar>&       tmix,
+  const uview_1d<Scalar>&       qtmix,
+  const uview_1d<Scalar>&       qsmix,
+  const uview_1d<Scalar>&       smix,
+  const uview_1d<Scalar>&       xsh2o,
+  const uview_1d<Scalar>&       ds_xsh2o,
+  const uview_1d<Scalar>&       ds_freeze)
+{
+  const Scalar grav   = C::gravit;
+  const Scalar latice = C::LatIce;
+  const Scalar cpliq  = C::CpLiq;
+  const Scalar tfreez = C::Tmelt;
+  const Scalar rgas   = ZC::rair;
+  const Scalar dmpdz  = ZC::dmpdz;
+  const Scalar tp_fac = ZC::tp_fac;
+
+  static constexpr Int nit_lheat = 2;    // Iterations for ds,dq changes from condensation freezing
+  const Scalar lwmax  = Scalar(1.e-3);   // Maximum condensate that can be held in cloud before rainout
+  const Scalar tscool = 0;               // Temp at which water loading freezes in the cloud
+
+  for (Int k=0; k<nlev; ++k) {
+    qtmix(k) = 0;
+    smix(k)  = 0;
+  }
+
+  Scalar qtp0 = 0, sp0 = 0, mp0 = 0;  // Parcel launch total water, entropy and relative mass flux
+  Scalar qtp  = 0, sp  = 0, mp  = 0;  // Parcel total water, entropy and mass flux
+
+  // Entrainment loop: parcel entropy and total water, from the launch level up
+  for (Int k=nlev-1; k>=msg; --k) {
+    // Initialize parcel values at launch level
+    if (k == klaunch) {
+      qtp0 = q(k);
+      sp0  = entropy(t(k), p(k), qtp0);
+      mp0  = 1;
+      smix(k)  = sp0;
+      qtmix(k) = qtp0;
+      ientropy(smix(k), p(k), qtmix(k), t(k), tmix(k), qsmix(k));
+    }
+
+    // Entraining levels
+    if (k < klaunch) {
+      // Environmental values for this level
+      const Scalar dp    = p(k)-p(k+1);
+      const Scalar qtenv = Scalar(0.5)*(q(k)+q(k+1));
+      const Scalar tenv  = Scalar(0.5)*(t(k)+t(k+1));
+      const Scalar penv  = Scalar(0.5)*(p(k)+p(k+1));
+
+      const Scalar senv  = entropy(tenv, penv, qtenv);
+
+      // Fractional entrainment rate /mb, given the value /m
+      const Scalar dpdz  = -(penv*grav)/(rgas*tenv);
+      const Scalar dzdp  = 1/dpdz;
+      const Scalar dmpdp = dmpdz*dzdp;
+
+      // Sum entrainment to current level
+      sp  = sp  - dmpdp*dp*senv;
+      qtp = qtp - dmpdp*dp*qtenv;
+      mp  = mp  - dmpdp*dp;
+
+      // Entrain s and qt to next level
+      smix(k)  = (sp0  + sp)  / (mp0 + mp);
+      qtmix(k) = (qtp0 + qtp) / (mp0 + mp);
+
+      // Invert entropy to get T and saturation-capped q of the mixture
+      ientropy(smix(k), p(k), qtmix(k), tmix(k+1), tmix(k), qsmix(k));
+
+      // First level where qsmix <= qtmix on ascending is the lcl
+      if (qsmix(k) <= qtmix(k) && qsmix(k+1) > qtmix(k+1)) {
+        lcl = k;
+        const Scalar qxsk   = qtmix(k) - qsmix(k);
+        const Scalar qxskp1 = qtmix(k+1) - qsmix(k+1);
+        const Scalar dqxsdp = (qxsk - qxskp1)/dp;
+        pl = p(k+1) - qxskp1/dqxsdp;
+        const Scalar dsdp   = (smix(k)  - smix(k+1))/dp;
+        const Scalar dqtdp  = (qtmix(k) - qtmix(k+1))/dp;
+        const Scalar slcl   = smix(k+1)  + dsdp* (pl-p(k+1));
+        const Scalar qtlcl  = qtmix(k+1) + dqtdp*(pl-p(k+1));
+
+        Scalar qslcl;
+        ientropy(slcl, pl, qtlcl, tmix(k), tl, qslcl);
+      }
+    }
+  }
+
+  for (Int k=0; k<nlev; ++k) {
+    xsh2o(k)     = 0;
+    ds_xsh2o(k)  = 0;
+    ds_freeze(k) = 0;
+  }
+
+  // Precipitation/freezing loop
+  for (Int k=nlev-1; k>=msg; --k) {
+    // Parcel values at launch level, assuming no liquid water
+    if (k == klaunch) {
+      tp(k)   = tmix(k);
+      qstp(k) = q(k);
+      tpv(k)  = (tp(k) + tp_fac*tpert) * (1+Scalar(1.608)*qstp(k)) / (1+qstp(k));
+    }
+
+    if (k < klaunch) {
+      Scalar new_q = 0;
+      for (Int ii=0; ii<nit_lheat; ++ii) {
+        // Rain is the excess condensate, bar lwmax
+        xsh2o(k) = ekat::impl::max(Scalar(0), qtmix(k) - qsmix(k) - lwmax);
+
+        // Contribution to ds from precip loss of condensate
+        ds_xsh2o(k) = ds_xsh2o(k+1) - cpliq * std::log(tmix(k)/tfreez) * ekat::impl::max(Scalar(0), xsh2o(k)-xsh2o(k+1));
+
+        // Entropy of freezing: one off freezing of condensate, then continual freezing of additional condensate
+        if (tmix(k) <= tfreez+tscool && ds_freeze(k+1) == 0) {
+          ds_freeze(k) = (latice/tmix(k)) * ekat::impl::max(Scalar(0), qtmix(k)-qsmix(k)-xsh2o(k));
+        }
+        if (tmix(k) <= tfreez+tscool && ds_freeze(k+1) != 0) {
+          ds_freeze(k) = ds_freeze(k+1) + (latice/tmix(k)) * ekat::impl::max(Scalar(0), qsmix(k+1)-qsmix(k));
+        }
+
+        // Adjust entropy and liquid water, and invert entropy again
+        const Scalar new_s = smix(k) + ds_xsh2o(k) + ds_freeze(k);
+        new_q = qtmix(k) - xsh2o(k);
+
+        ientropy(new_s, p(k), new_q, tmix(k), tmix(k), qsmix(k));
+      }
+
+      // Parcel virtual temperature is the density temperature with new_q total water
+      tp(k) = tmix(k);
+      if (new_q > qsmix(k)) {
+        // Super-saturated, so condensate present (which reduces buoyancy)
+        qstp(k) = qsmix(k);
+      } else {
+        qstp(k) = new_q;
+      }
+      tpv(k) = (tp(k) + tp_fac*tpert) * (1+Scalar(1.608)*qstp(k)) / (1+new_q);
+    }
+  }
+}
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>
+::buoyan_dilute(
+  const Int&                    nlev,
+  const Int&                    msg,
+  const uview_1d<const Scalar>& q,
+  const uview_1d<const Scalar>& t,
+  const uview_1d<const Scalar>& p,
+  const uview_1d<const Scalar>& z,
+  const uview_1d<const Scalar>& pf,
+  const Int&                    pblt,
+  const Scalar&                 tpert,
+  const uview_1d<Scalar>&       tp,
+  const uview_1d<Scalar>&       qstp,
+  Scalar&                       tl,
+  Scalar&                       cape,
+  Int&                          lcl,
+  Int&                          lel,
+  Int&                          mx,
+  const uview_1d<Scalar>&       tv,
+  const uview_1d<Scalar>&       tpv,
+  const uview_1d<Scalar>&       buoy,
+  const uview_1d<Scalar>&       tmix,
+  const uview_1d<Scalar>&       qtmix,
+  const uview_1d<Scalar>&       qsmix,
+  const uview_1d<Scalar>&       smix,
+  const uview_1d<Scalar>&       xsh2o,
+  const uview_1d<Scalar>&       ds_xsh2o,
+  const uview_1d<Scalar>&       ds_freeze)
+{
+  const Scalar cp         = C::Cpair;
+  const Scalar grav       = C::gravit;
+  const Scalar rl         = C::LatVap;
+  const Scalar rd         = ZC::rair;
+  const Scalar tiedke_add = ZC::tiedke_add;
+
+  static constexpr Int num_cin = ZC::num_cin;
+
+  Scalar capeten[num_cin]; // Provisional values of cape
+  Int    lelten[num_cin];
+  for (Int n=0; n<num_cin; ++n) {
+    lelten[n]  = nlev-1;
+    capeten[n] = 0;
+  }
+  const Int lon = nlev-1; // Level of onset of deep convection
+  Int knt = 0;
+  lel  = nlev-1;
+  mx   = lon;
+  cape = 0;
+  Scalar hmax = 0;
+
+  for (Int k=0; k<nlev; ++k) {
+    tp(k)   = t(k);
+    qstp(k) = q(k);
+    tv(k)   = t(k)*(1+Scalar(1.608)*q(k))/(1+q(k));
+    tpv(k)  = tv(k);
+    buoy(k) = 0;
+  }
+
+  // Set the launching level (mx) at the level of max moist static energy.
+  // The search for this level stops at the PBL top.
+  const Int bot_layer = nlev-1 - ZC::mx_bot_lyr_adj;
+  for (Int k=bot_layer; k>=msg; --k) {
+    const Scalar hmn = cp*t(k) + grav*z(k) + rl*q(k);
+    if (k >= pblt && k <= lon && hmn > hmax) {
+      hmax = hmn;
+      mx = k;
+    }
+  }
+
+  // LCL dilute calculation: initialize to mx, and determine the lcl in parcel_dilute
+  lcl = mx;
+  tl  = t(mx);
+  Scalar pl = p(mx);
+
+  parcel_dilute(nlev, msg, mx, p, t, q, tpert, tp, tpv, qstp, pl, tl, lcl,
+                tmix, qtmix, qsmix, smix, xsh2o, ds_xsh2o, ds_freeze);
+
+  // If the lcl is above the nominal level of non-divergence (600 mb),
+  // no deep convection is permitted (cape retains the initial value of zero).
+  const bool plge600 = pl >= 600;
+
+  // Main buoyancy calculation
+  for (Int k=nlev-1; k>=msg; --k) {
+    if (k <= mx && plge600) {
+      // Define buoy from launch level to cloud top
+      tv(k)   = t(k)*(1+Scalar(1.608)*q(k))/(1+q(k));
+      buoy(k) = tpv(k) - tv(k) + tiedke_add;
+    } else {
+      qstp(k) = q(k);
+      tp(k)   = t(k);
+      tpv(k)  = tv(k);
+    }
+  }
+
+  for (Int k=msg+1; k<nlev; ++k) {
+    if (k < lcl && plge600) {
+      if (buoy(k+1) > 0 && buoy(k) <= 0) {
+        knt = ekat::impl::min(num_cin, knt+1);
+        lelten[knt-1] = k;
+      }
+    }
+  }
+
+  // Convective available potential energy (cape)
+  for (Int n=0; n<num_cin; ++n) {
+    for (Int k=msg; k<nlev; ++k) {
+      if (plge600 && k <= mx && k > lelten[n]) {
+        capeten[n] = capeten[n] + rd*buoy(k)*std::log(pf(k+1)/pf(k));
+      }
+    }
+  }
+
+  // Use the max cape from all possible tentative capes as the final cape
+  for (Int n=0; n<num_cin; ++n) {
+    if (capeten[n] > cape) {
+      cape = capeten[n];
+      lel  = lelten[n];
+    }
+  }
+
+  // Lower bound on cape for diagnostic purposes
+  cape = ekat::impl::max(cape, Scalar(0));
+}
+
+} // namespace zm
+} // namespace scream
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef ZM_CLDFRC_FICE_IMPL_HPP
+#define ZM_CLDFRC_FICE_IMPL_HPP
+
+#include "zm_functions.hpp" // for ETI only but harmless for GPU
+
+namespace scream {
+namespace zm {
+
+/*
+ * Implementation of zm cldfrc_fice. Clients should NOT #include
+ * this file, #include zm_functions.hpp instead.
+ */
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>
+::cldfrc_fice(
+  const MemberType&             team,
+  const Int&                    nlev,
+  const uview_1d<const Scalar>& t,
+  const uview_1d<Scalar>&       fice,
+  const uview_1d<Scalar>&       fsnow)
+{
+  const Scalar tmax_fice  = C::Tmelt - ZC::fice_tmax_offset; // max temperature for cloud ice formation
+  const Scalar tmin_fice  = tmax_fice - ZC::fice_trange;     // min temperature for cloud ice formation
+  const Scalar tmax_fsnow = C::Tmelt;                        // max temperature for transition to convective snow
+  const Scalar tmin_fsnow = C::Tmelt - ZC::fsnow_trange;     // min temperature for transition to convective snow
+
+  Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlev), [&] (const Int& k) {
+    // Pure water phase above tmax, pure ice phase below tmin, and mixed
+    // phase in between, with ice fraction decreasing linearly from tmin to tmax.
+    if (t(k) > tmax_fice) {
+      fice(k) = 0;
+    } else if (t(k) < tmin_fice) {
+      fice(k) = 1;
+    } else {
+      fice(k) = (tmax_fice - t(k)) / (tmax_fice - tmin_fice);
+    }
+
+    if (t(k) > tmax_fsnow) {
+      fsnow(k) = 0;
+    } else if (t(k) < tmin_fsnow) {
+      fsnow(k) = 1;
+    } else {
+      fsnow(k) = (tmax_fsnow - t(k)) / (tmax_fsnow - tmin_fsnow);
+    }
+  });
+}
+
+} // namespace zm
+} // namespace scream
+
+#endif
@@ -0,0 +1,435 @@
+#ifndef ZM_CLDPRP_IMPL_HPP
+#define ZM_CLDPRP_IMPL_HPP
+
+#include "zm_functions.hpp" // for ETI only but harmless for GPU
+
+namespace scream {
+namespace zm {
+
+/*
+ * Implementation of zm cldprp. Clients should NOT #include
+ * this file, #include zm_functions.hpp instead.
+ *
+ * This is a port of cldprp in zm_conv.F90 (without the trigmem option),
+ * computing the updraft/downdraft properties of a single column, normalized
+ * by the cloud base mass flux. It is meant to be called by a single thread.
+ * The Fortran code loops over the levels between the highest cloud top and
+ * the lowest cloud base of all the gathered columns, and skips the levels
+ * outside the column own range; here we loop over the column range directly.
+ */
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>
+::cldprp(
+  const Int&                    nlev,
+  const Int&                    msg,
+  const uview_1d<const Scalar>& q,
+  const uview_1d<const Scalar>& t,
+  const uview_1d<const Scalar>& p,
+  const uview_1d<const Scalar>& z,
+  const uview_1d<const Scalar>& s,
+  const uview_1d<const Scalar>& zf,
+  const uview_1d<const Scalar>& shat,
+  const Scalar&                 landfrac,
+  const Scalar&                 tpert,
+  const Int&                    mx,
+  const Int&                    lel,
+  const uview_1d<Scalar>&       mu,
+  const uview_1d<Scalar>&       eu,
+  const uview_1d<Scalar>&       du,
+  const uview_1d<Scalar>&       md,
+  const uview_1d<Scalar>&       ed,
+  const uview_1d<Scalar>&       sd,
+  const uview_1d<Scalar>&       qd,
+  const uview_1d<Scalar>&       mc,
+  const uview_1d<Scalar>&       qu,
+  const uview_1d<Scalar>&       su,
+  const uview_1d<Scalar>&       qst,
+  const uview_1d<Scalar>&       hmn,
+  const uview_1d<Scalar>&       hsat,
+  const uview_1d<Scalar>&       ql,
+  const uview_1d<Scalar>&       cmeg,
+  Int&                          jt,
+  Int&                          jlcl,
+  Int&                          j0,
+  Int&                          jd,
+  const uview_1d<Scalar>&       pflx,
+  const uview_1d<Scalar>&       evp,
+  const uview_1d<Scalar>&       cu,
+  const uview_1d<Scalar>&       rprd,
+  const uview_1d<Scalar>&       gamma,
+  const uview_1d<Scalar>&       hu,
+  const uview_1d<Scalar>&       hd,
+  const uview_1d<Scalar>&       eps,
+  const uview_1d<Scalar>&       f,
+  const uview_1d<Scalar>&       k1,
+  const uview_1d<Scalar>&       i2,
+  const uview_1d<Scalar>&       i3,
+  const uview_1d<Scalar>&       i4,
+  const uview_1d<Scalar>&       qsthat,
+  const uview_1d<Scalar>&       hsthat,
+  const uview_1d<Scalar>&       gamhat,
+  const uview_1d<Scalar>&       qds)
+{
+  const Scalar cp         = C::Cpair;
+  const Scalar grav       = C::gravit;
+  const Scalar rl         = C::LatVap;
+  const Scalar eps1       = C::ep_2;
+  const Scalar rd         = ZC::rair;
+  const Scalar tiedke_add = ZC::tiedke_add;
+  const Scalar tp_fac     = ZC::tp_fac;
+  const Scalar alfa       = ZC::alfa;
+  const Scalar small      = Scalar(1.e-20);
+
+  // The updraft base is the launch level
+  const Int jb = mx;
+
+  // Layer thickness [m]
+  const auto dz = [&] (const Int k) { return zf(k) - zf(k+1); };
+
+  const Scalar c0mask = ZC::c0_ocn*(1-landfrac) + ZC::c0_lnd*landfrac;
+
+  // Initialize many output and work variables
+  pflx(0) = 0;
+  for (Int k=0; k<nlev; ++k) {
+    k1(k)   = 0;
+    i2(k)   = 0;
+    i3(k)   = 0;
+    i4(k)   = 0;
+    mu(k)   = 0;
+    f(k)    = 0;
+    eps(k)  = 0;
+    eu(k)   = 0;
+    du(k)   = 0;
+    ql(k)   = 0;
+    cu(k)   = 0;
+    evp(k)  = 0;
+    cmeg(k) = 0;
+    qds(k)  = q(k);
+    md(k)   = 0;
+    ed(k)   = 0;
+    sd(k)   = s(k);
+    qd(k)   = q(k);
+    mc(k)   = 0;
+    qu(k)   = q(k);
+    su(k)   = s(k);
+    Scalar est;
+    qsat_hpa(t(k), p(k), est, qst(k));
+    if (p(k)-est <= 0) {
+      qst(k) = 1;
+    }
+    gamma(k) = qst(k)*(1 + qst(k)/eps1)*eps1*rl/(rd*(t(k)*t(k)))*rl/cp;
+    hmn(k)   = cp*t(k) + grav*z(k) + rl*q(k);
+    hsat(k)  = cp*t(k) + grav*z(k) + rl*qst(k);
+    hu(k)    = hmn(k);
+    hd(k)    = hmn(k);
+    rprd(k)  = 0;
+  }
+
+  // Interpolate the layer values of qst, hsat and gamma to layer interfaces
+  for (Int k=0; k<=msg; ++k) {
+    hsthat(k) = hsat(k);
+    qsthat(k) = qst(k);
+    gamhat(k) = gamma(k);
+  }
+  Scalar totpcp = 0;
+  Scalar totevp = 0;
+  for (Int k=msg+1; k<nlev; ++k) {
+    if (std::abs(qst(k-1)-qst(k)) > Scalar(1.e-6)) {
+      qsthat(k) = std::log(qst(k-1)/qst(k))*qst(k-1)*qst(k)/(qst(k-1)-qst(k));
+    } else {
+      qsthat(k) = qst(k);
+    }
+    hsthat(k) = cp*shat(k) + rl*qsthat(k);
+    if (std::abs(gamma(k-1)-gamma(k)) > Scalar(1.e-6)) {
+      gamhat(k) = std::log(gamma(k-1)/gamma(k))*gamma(k-1)*gamma(k)/(gamma(k-1)-gamma(k));
+    } else {
+      gamhat(k) = gamma(k);
+    }
+  }
+
+  // Initialize cloud top to highest plume top (not above limcnv+1)
+  jt   = ekat::impl::min(ekat::impl::max(lel, msg+1), nlev-1);
+  jd   = nlev-1;
+  jlcl = lel;
+  Scalar hmin = Scalar(1.e6);
+
+  // Find the level of minimum hsat, where detrainment starts
+  j0 = jb;
+  for (Int k=msg; k<nlev; ++k) {
+    if (hsat(k) <= hmin && k >= jt && k <= jb) {
+      hmin = hsat(k);
+      j0 = k;
+    }
+  }
+  j0 = ekat::impl::min(j0, jb-2);
+  j0 = ekat::impl::max(j0, jt+2);
+  j0 = ekat::impl::min(j0, nlev-1);
+
+  // Initialize certain arrays inside cloud
+  for (Int k=msg; k<nlev; ++k) {
+    if (k >= jt && k <= jb) {
+      hu(k) = hmn(mx) + cp*(tiedke_add+tp_fac*tpert);
+      su(k) = s(mx) + tiedke_add + tp_fac*tpert;
+    }
+  }
+
+  // Taylor series for the approximate eps(z) below
+  for (Int k=nlev-2; k>=msg; --k) {
+    if (k < jb && k >= jt) {
+      k1(k) = k1(k+1) + (hmn(mx)-hmn(k))*dz(k);
+      const Scalar ihat = Scalar(0.5)*(k1(k+1)+k1(k));
+      i2(k) = i2(k+1) + ihat*dz(k);
+      const Scalar idag = Scalar(0.5)*(i2(k+1)+i2(k));
+      i3(k) = i3(k+1) + idag*dz(k);
+      const Scalar iprm = Scalar(0.5)*(i3(k+1)+i3(k));
+      i4(k) = i4(k+1) + iprm*dz(k);
+    }
+  }
+
+  hmin = Scalar(1.e6);
+  Scalar expdif = 0;
+  for (Int k=msg; k<nlev; ++k) {
+    if (k >= j0 && k <= jb && hmn(k) <= hmin) {
+      hmin = hmn(k);
+      expdif = hmn(mx) - hmin;
+    }
+  }
+
+  // Approximate eps(z), using the above taylor series
+  for (Int k=msg+1; k<nlev; ++k) {
+    Scalar expnum = 0;
+    if (k < jt || k >= jb) {
+      k1(k) = 0;
+    } else {
+      expnum = hmn(mx) - (hsat(k-1)*(zf(k)-z(k)) + hsat(k)*(z(k-1)-zf(k)))/(z(k-1)-z(k));
+    }
+    if ((expdif > 100 && expnum > 0) && k1(k) > expnum*dz(k)) {
+      const Scalar ftemp  = expnum/k1(k);
+      const Scalar ftemp2 = ftemp*ftemp;
+      const Scalar k1sq   = k1(k)*k1(k);
+      f(k) = ftemp + i2(k)/k1(k)*ftemp2
+             + (2*(i2(k)*i2(k))-k1(k)*i3(k))/k1sq*(ftemp2*ftemp)
+             + (-5*k1(k)*i2(k)*i3(k) + 5*((i2(k)*i2(k))*i2(k)) + k1sq*i4(k))/(k1sq*k1(k))*(ftemp2*ftemp2);
+      f(k) = ekat::impl::max(f(k), Scalar(0));
+      f(k) = ekat::impl::min(f(k), Scalar(0.0002));
+    }
+  }
+  if (j0 < jb) {
+    if (f(j0) < Scalar(1.e-6) && f(j0+1) > f(j0)) j0 = j0 + 1;
+  }
+  for (Int k=msg+1; k<nlev; ++k) {
+    if (k >= jt && k <= j0) {
+      f(k) = ekat::impl::max(f(k), f(k-1));
+    }
+  }
+  const Scalar eps0 = f(j0);
+  eps(jb) = eps0;
+
+  // This is set to match the Rasch and Kristjansson paper
+  for (Int k=nlev-1; k>=msg; --k) {
+    if (k >= j0 && k <= jb) {
+      eps(k) = f(j0);
+    }
+  }
+  for (Int k=nlev-1; k>=msg; --k) {
+    if (k < j0 && k >= jt) eps(k) = f(k);
+  }
+
+  // Updraft mass flux mu, entrainment eu, detrainment du and moist static energy hu.
+  // Here and below mu, eu, du, md and ed are all normalized by mb.
+  if (eps0 > 0) {
+    mu(jb) = 1;
+    eu(jb) = mu(jb)/dz(jb);
+  }
+  for (Int k=nlev-1; k>=msg; --k) {
+    if (eps0 > 0 && (k >= jt && k < jb)) {
+      const Scalar zuef = zf(k) - zf(jb);
+      const Scalar rmue = (1/eps0)*(std::exp(eps(k+1)*zuef)-1)/zuef;
+      mu(k) = (1/eps0)*(std::exp(eps(k)*zuef)-1)/zuef;
+      eu(k) = (rmue-mu(k+1))/dz(k);
+      du(k) = (rmue-mu(k))/dz(k);
+    }
+  }
+
+  if (eps0 > 0) {
+    for (Int k=jb-1; k>=lel; --k) {
+      if (mu(k) < Scalar(0.02)) {
+        hu(k) = hmn(k);
+        mu(k) = 0;
+        eu(k) = 0;
+        du(k) = mu(k+1)/dz(k);
+      } else {
+        hu(k) = mu(k+1)/mu(k)*hu(k+1) + dz(k)/mu(k)*(eu(k)*hmn(k) - du(k)*hsat(k));
+      }
+    }
+  }
+
+  // Reset cloud top index beginning from two layers above the cloud base
+  // (i.e. if cloud is only one layer thick, top is not reset)
+  for (Int k=jb-2; k>=lel-1; --k) {
+    if (hu(k) <= hsthat(k) && hu(k+1) > hsthat(k+1) && mu(k) >= Scalar(0.02)) {
+      if (hu(k)-hsthat(k) < -2000) {
+        jt = k + 1;
+      } else {
+        jt = k;
+      }
+      break;
+    } else if (hu(k) > hu(jb) || mu(k) < Scalar(0.02)) {
+      jt = k + 1;
+      break;
+    }
+  }
+  for (Int k=nlev-1; k>=msg; --k) {
+    if (k >= lel && k <= jt && eps0 > 0) {
+      mu(k) = 0;
+      eu(k) = 0;
+      du(k) = 0;
+      hu(k) = hmn(k);
+    }
+    if (k == jt && eps0 > 0) {
+      du(k) = mu(k+1)/dz(k);
+      eu(k) = 0;
+      mu(k) = 0;
+    }
+  }
+
+  // Downdraft properties (no downdrafts if jd>=jb). Scale down the downward mass
+  // flux profile so that the net flux (up-down) at cloud base is not negative.
+  jt = ekat::impl::min(jt, jb-1);
+  jd = ekat::impl::max(j0, jt+1);
+  jd = ekat::impl::min(jd, jb);
+  hd(jd) = hmn(jd-1);
+  Scalar epsm = 0;
+  if (jd < jb && eps0 > 0) {
+    epsm = eps0;
+    md(jd) = -alfa*epsm/eps0;
+  }
+  for (Int k=msg; k<nlev; ++k) {
+    if ((k > jd && k <= jb) && eps0 > 0) {
+      const Scalar zdef = zf(jd) - zf(k);
+      md(k) = -alfa/(2*eps0)*(std::exp(2*epsm*zdef)-1)/zdef;
+    }
+  }
+  for (Int k=msg; k<nlev; ++k) {
+    if ((k >= jt && k <= jb) && eps0 > 0 && jd < jb) {
+      const Scalar ratmjb = ekat::impl::min(std::abs(mu(jb)/md(jb)), Scalar(1));
+      md(k) = md(k)*ratmjb;
+    }
+  }
+
+  // Note: the Fortran code reads out of bounds here if the cloud top is the
+  // model top, so we skip that level.
+  for (Int k=ekat::impl::max(msg,1); k<nlev; ++k) {
+    if (k >= jt && eps0 > 0) {
+      ed(k-1) = (md(k-1)-md(k))/dz(k-1);
+      const Scalar mdt = ekat::impl::min(md(k), -small);
+      hd(k) = (md(k-1)*hd(k-1) - dz(k-1)*ed(k-1)*hmn(k-1))/mdt;
+    }
+  }
+
+  // Updraft and downdraft properties
+  for (Int k=msg+1; k<nlev; ++k) {
+    if ((k >= jd && k <= jb) && eps0 > 0 && jd < jb) {
+      qds(k) = qsthat(k) + gamhat(k)*(hd(k)-hsthat(k))/(rl*(1 + gamhat(k)));
+    }
+  }
+
+  bool done = false;
+  for (Int k=nlev-1; k>=msg+1; --k) {
+    if (k == jb && eps0 > 0) {
+      qu(k) = q(mx);
+      su(k) = (hu(k)-rl*qu(k))/cp;
+    }
+    if ((!done && k > jt && k < jb) && eps0 > 0) {
+      su(k) = mu(k+1)/mu(k)*su(k+1) + dz(k)/mu(k)*(eu(k)-du(k))*s(k);
+      qu(k) = mu(k+1)/mu(k)*qu(k+1) + dz(k)/mu(k)*(eu(k)*q(k) - du(k)*qst(k));
+      const Scalar tu = su(k) - grav/cp*zf(k);
+      Scalar estu, qstu;
+      qsat_hpa(tu, (p(k)+p(k-1))/2, estu, qstu);
+      if (qu(k) >= qstu) {
+        jlcl = k;
+        done = true;
+      }
+    }
+  }
+  for (Int k=msg+1; k<nlev; ++k) {
+    if ((k > jt && k <= jlcl) && eps0 > 0) {
+      su(k) = shat(k) + (hu(k)-hsthat(k))/(cp*(1 + gamhat(k)));
+      qu(k) = qsthat(k) + gamhat(k)*(hu(k)-hsthat(k))/(rl*(1 + gamhat(k)));
+    }
+  }
+
+  // Condensation in updraft
+  for (Int k=nlev-1; k>=msg+1; --k) {
+    if (k >= jt && k < jb && eps0 > 0) {
+      cu(k) = ((mu(k)*su(k)-mu(k+1)*su(k+1))/dz(k) - (eu(k)-du(k))*s(k))/(rl/cp);
+      if (k == jt) cu(k) = 0;
+      cu(k) = ekat::impl::max(Scalar(0), cu(k));
+    }
+  }
+
+  // Condensed liquid and rain production rate, and accumulated total precipitation
+  // (condensation - detrainment of liquid). mu and ql are interface quantities,
+  // while cu, du, eu and rprd are midpoint quantities.
+  for (Int k=nlev-1; k>=msg+1; --k) {
+    rprd(k) = 0;
+    if (k >= jt && k < jb && eps0 > 0 && mu(k) >= 0) {
+      if (mu(k) > 0) {
+        const Scalar ql1 = 1/mu(k)*(mu(k+1)*ql(k+1) - dz(k)*du(k)*ql(k+1) + dz(k)*cu(k));
+        ql(k) = ql1/(1 + dz(k)*c0mask);
+      } else {
+        ql(k) = 0;
+      }
+      totpcp = totpcp + dz(k)*(cu(k)-du(k)*ql(k+1));
+      rprd(k) = c0mask*mu(k)*ql(k);
+    }
+  }
+
+  qd(jd) = qds(jd);
+  sd(jd) = (hd(jd) - rl*qd(jd))/cp;
+  for (Int k=msg+1; k<nlev; ++k) {
+    if (k >= jd && k < jb && eps0 > 0) {
+      qd(k+1) = qds(k+1);
+      evp(k) = -ed(k)*q(k) + (md(k)*qd(k)-md(k+1)*qd(k+1))/dz(k);
+      evp(k) = ekat::impl::max(evp(k), Scalar(0));
+      const Scalar mdt = ekat::impl::min(md(k+1), -small);
+      sd(k+1) = ((rl/cp*evp(k)-ed(k)*s(k))*dz(k) + md(k)*sd(k))/mdt;
+      totevp = totevp - dz(k)*ed(k)*q(k);
+    }
+  }
+  totevp = totevp + md(jd)*qd(jd) - md(jb)*qd(jb);
+
+  totpcp = ekat::impl::max(totpcp, Scalar(0));
+  totevp = ekat::impl::max(totevp, Scalar(0));
+  for (Int k=msg+1; k<nlev; ++k) {
+    if (totevp > 0 && totpcp > 0) {
+      md(k)  = md(k) *ekat::impl::min(Scalar(1), totpcp/(totevp+totpcp));
+      ed(k)  = ed(k) *ekat::impl::min(Scalar(1), totpcp/(totevp+totpcp));
+      evp(k) = evp(k)*ekat::impl::min(Scalar(1), totpcp/(totevp+totpcp));
+    } else {
+      md(k)  = 0;
+      ed(k)  = 0;
+      evp(k) = 0;
+    }
+    // cmeg is the cloud water condensed - rain water evaporated
+    // rprd is the cloud water converted to rain - (rain evaporated)
+    cmeg(k) = cu(k) - evp(k);
+    rprd(k) = rprd(k) - evp(k);
+  }
+
+  // Net precipitation flux across interfaces
+  pflx(0) = 0;
+  for (Int k=1; k<=nlev; ++k) {
+    pflx(k) = pflx(k-1) + rprd(k-1)*dz(k-1);
+  }
+  for (Int k=msg; k<nlev; ++k) {
+    mc(k) = mu(k) + md(k);
+  }
+}
+
+} // namespace zm
+} // namespace scream
+
+#endif
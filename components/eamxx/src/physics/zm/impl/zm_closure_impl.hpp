@@ -0,0 +1,131 @@
+#ifndef ZM_CLOSURE_IMPL_HPP
+#define ZM_CLOSURE_IMPL_HPP
+
+#include "zm_functions.hpp" // for ETI only but harmless for GPU
+
+namespace scream {
+namespace zm {
+
+/*
+ * Implementation of zm closure. Clients should NOT #include
+ * this file, #include zm_functions.hpp instead.
+ *
+ * This is a port of closure in zm_conv.F90, computing the cloud base mass
+ * flux mb of a single column from the CAPE consumption rate. It is meant to
+ * be called by a single thread. The Fortran code stores the cumulus heating,
+ * drying and buoyancy change in (pcols,pver) arrays; since each level only
+ * needs its own values, here they are computed on the fly while integrating.
+ */
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>
+::closure(
+  const Int&                    nlev,
+  const Int&                    msg,
+  const uview_1d<const Scalar>& q,
+  const uview_1d<const Scalar>& t,
+  const uview_1d<const Scalar>& p,
+  const uview_1d<const Scalar>& s,
+  const uview_1d<const Scalar>& tp,
+  const uview_1d<const Scalar>& qu,
+  const uview_1d<const Scalar>& su,
+  const uview_1d<const Scalar>& mc,
+  const uview_1d<const Scalar>& du,
+  const uview_1d<const Scalar>& mu,
+  const uview_1d<const Scalar>& md,
+  const uview_1d<const Scalar>& qd,
+  const uview_1d<const Scalar>& sd,
+  const uview_1d<const Scalar>& qhat,
+  const uview_1d<const Scalar>& shat,
+  const uview_1d<const Scalar>& dp,
+  const uview_1d<const Scalar>& qstp,
+  const uview_1d<const Scalar>& zf,
+  const uview_1d<const Scalar>& ql,
+  const Scalar&                 dsubcld,
+  const Scalar&                 cape,
+  const Scalar&                 tl,
+  const Int&                    lcl,
+  const Int&                    lel,
+  const Int&                    jt,
+  const Int&                    mx,
+  Scalar&                       mb)
+{
+  const Scalar cp      = C::Cpair;
+  const Scalar grav    = C::gravit;
+  const Scalar rl      = C::LatVap;
+  const Scalar eps1    = C::ep_2;
+  const Scalar rd      = ZC::rair;
+  const Scalar tau     = ZC::tau;
+  const Scalar capelmt = ZC::capelmt;
+  const Scalar beta    = 0;
+
+  // Change of subcloud layer properties due to convection is related to cumulus
+  // updrafts and downdrafts. All time derivatives are per unit cloud-base mass
+  // flux, i.e. they have units of 1/mb instead of 1/sec.
+  mb = 0;
+  const Scalar eb = p(mx)*q(mx)/(eps1 + q(mx));
+  const Scalar dtbdt = (1/dsubcld)*(mu(mx)*(shat(mx)-su(mx)) +
+                                    md(mx)*(shat(mx)-sd(mx)));
+  const Scalar dqbdt = (1/dsubcld)*(mu(mx)*(qhat(mx)-qu(mx)) +
+                                    md(mx)*(qhat(mx)-qd(mx)));
+  const Scalar epsq  = eps1 + q(mx);
+  const Scalar debdt = eps1*p(mx)/(epsq*epsq)*dqbdt;
+  const Scalar tlden = Scalar(3.5)*std::log(t(mx)) - std::log(eb) - Scalar(4.805);
+  const Scalar dtldt = -2840*(Scalar(3.5)/t(mx)*dtbdt - debdt/eb)/(tlden*tlden);
+
+  // Buoyant energy change is set to 2/3*excess cape per 3 hours
+  Scalar dadt = 0;
+  for (Int k=lel; k<=mx-1; ++k) {
+    // Cumulus heating (dtmdt) and drying (dqmdt)
+    Scalar dtmdt = 0;
+    Scalar dqmdt = 0;
+    if (k >= msg && k <= nlev-2) {
+      if (k == jt) {
+        dtmdt = (1/dp(k))*(mu(k+1)*(su(k+1)-shat(k+1)-rl/cp*ql(k+1)) +
+                           md(k+1)*(sd(k+1)-shat(k+1)));
+        dqmdt = (1/dp(k))*(mu(k+1)*(qu(k+1)-qhat(k+1)+ql(k+1)) +
+                           md(k+1)*(qd(k+1)-qhat(k+1)));
+      }
+      if (k > jt && k < mx) {
+        dtmdt = (mc(k)*(shat(k)-s(k)) + mc(k+1)*(s(k)-shat(k+1)))/dp(k)
+                - rl/cp*du(k)*(beta*ql(k) + (1-beta)*ql(k+1));
+        dqmdt = (mu(k+1)*(qu(k+1)-qhat(k+1)+cp/rl*(su(k+1)-s(k)))
+                 - mu(k)*(qu(k)-qhat(k)+cp/rl*(su(k)-s(k)))
+                 + md(k+1)*(qd(k+1)-qhat(k+1)+cp/rl*(sd(k+1)-s(k)))
+                 - md(k)*(qd(k)-qhat(k)+cp/rl*(sd(k)-s(k))))/dp(k)
+                + du(k)*(beta*ql(k) + (1-beta)*ql(k+1));
+      }
+    }
+
+    // dboydt is the integrand of cape change
+    Scalar dboydt;
+    if (k <= lcl) {
+      const Scalar thetavp = tp(k)*std::pow(1000/p(k), rd/cp)*(1 + Scalar(1.608)*qstp(k) - q(mx));
+      const Scalar thetavm = t(k)*std::pow(1000/p(k), rd/cp)*(1 + Scalar(0.608)*q(k));
+      const Scalar dqsdtp  = qstp(k)*(1 + qstp(k)/eps1)*eps1*rl/(rd*(tp(k)*tp(k)));
+      // dtpdt is the parcel temperature change due to change of
+      // subcloud layer properties during convection.
+      const Scalar dtpdt = tp(k)/(1 + rl/cp*(dqsdtp-qstp(k)/tp(k)))*
+                           (dtbdt/t(mx) + rl/cp*(dqbdt/tl - q(mx)/(tl*tl)*dtldt));
+      dboydt = ((dtpdt/tp(k) + 1/(1 + Scalar(1.608)*qstp(k) - q(mx))*
+                 (Scalar(1.608)*dqsdtp*dtpdt - dqbdt)) -
+                (dtmdt/t(k) + Scalar(0.608)/(1 + Scalar(0.608)*q(k))*dqmdt))*grav*thetavp/thetavm;
+    } else {
+      const Scalar thetavp = tp(k)*std::pow(1000/p(k), rd/cp)*(1 + Scalar(0.608)*q(mx));
+      const Scalar thetavm = t(k)*std::pow(1000/p(k), rd/cp)*(1 + Scalar(0.608)*q(k));
+      dboydt = (dtbdt/t(mx) + Scalar(0.608)/(1 + Scalar(0.608)*q(mx))*dqbdt
+                - dtmdt/t(k) - Scalar(0.608)/(1 + Scalar(0.608)*q(k))*dqmdt)*
+               grav*thetavp/thetavm;
+    }
+    dadt = dadt + dboydt*(zf(k)-zf(k+1));
+  }
+
+  const Scalar dltaa = -1*(cape-capelmt);
+  if (dadt != 0) mb = ekat::impl::max(dltaa/tau/dadt, Scalar(0));
+}
+
+} // namespace zm
+} // namespace scream
+
+#endif
@@ -0,0 +1,151 @@
+#ifndef ZM_CONV_EVAP_IMPL_HPP
+#define ZM_CONV_EVAP_IMPL_HPP
+
+#include "zm_functions.hpp" // for ETI only but harmless for GPU
+
+namespace scream {
+namespace zm {
+
+/*
+ * Implementation of zm zm_conv_evap. Clients should NOT #include
+ * this file, #include zm_functions.hpp instead.
+ *
+ * This is a line-by-line port of zm_conv_evap in zm_conv.F90. The saturation
+ * and ice fraction computations are parallel over levels, while the
+ * precip flux recursion is inherently serial in the vertical, and is done
+ * by a single thread of the team.
+ */
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>
+::zm_conv_evap(
+  const MemberType&             team,
+  const Int&                    nlev,
+  const Scalar&                 deltat,
+  const uview_1d<const Scalar>& t,
+  const uview_1d<const Scalar>& pmid,
+  const uview_1d<const Scalar>& pdel,
+  const uview_1d<const Scalar>& q,
+  const uview_1d<const Scalar>& prdprec,
+  const uview_1d<const Scalar>& cldfrc,
+  const Workspace&              workspace,
+  Scalar&                       prec,
+  Scalar&                       snow,
+  const uview_1d<Scalar>&       tend_s,
+  const uview_1d<Scalar>&       tend_q,
+  const uview_1d<Scalar>&       ntprprd,
+  const uview_1d<Scalar>&       ntsnprd,
+  const uview_1d<Scalar>&       flxprec,
+  const uview_1d<Scalar>&       flxsnow)
+{
+  const Scalar gravit = C::gravit;
+  const Scalar latvap = C::LatVap;
+  const Scalar latice = C::LatIce;
+  const Scalar tmelt  = C::Tmelt;
+  const Scalar ke     = ZC::ke;
+
+  // Define temporary variables
+  uview_1d<Spack> qs_p, fice_p, fsnow_conv_p;
+  workspace.template take_many_contiguous_unsafe<3>(
+    {"qs", "fice", "fsnow_conv"},
+    {&qs_p, &fice_p, &fsnow_conv_p});
+  const auto qs         = ekat::scalarize(qs_p);
+  const auto fice       = ekat::scalarize(fice_p);
+  const auto fsnow_conv = ekat::scalarize(fsnow_conv_p);
+
+  // Determine saturation specific humidity (w.r.t. liquid)
+  Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlev), [&] (const Int& k) {
+    qs(k) = qsat(t(k), pmid(k));
+  });
+
+  // Determine ice fraction in rain production (use cloud water parameterization fraction at present)
+  cldfrc_fice(team, nlev, t, fice, fsnow_conv);
+  team.team_barrier();
+
+  Kokkos::single(Kokkos::PerTeam(team), [&] () {
+    // Convert input precip to kg/m2/s
+    Scalar prec_kg = prec*1000;
+
+    // Zero the flux integrals on the top boundary
+    flxprec(0) = 0;
+    flxsnow(0) = 0;
+    Scalar evpvint = 0;
+
+    for (Int k=0; k<nlev; ++k) {
+      // Melt snow falling into layer, if necessary.
+      Scalar flxsntm, snowmlt;
+      if (t(k) > tmelt) {
+        flxsntm = 0;
+        snowmlt = flxsnow(k) * gravit / pdel(k);
+      } else {
+        flxsntm = flxsnow(k);
+        snowmlt = 0;
+      }
+
+      // Relative humidity depression must be > 0 for evaporation
+      Scalar evplimit = ekat::impl::max(1 - q(k)/qs(k), Scalar(0));
+
+      // Total evaporation depends on flux in the top of the layer;
+      // flux prec is the net production above layer minus evaporation into environment
+      Scalar evpprec = ke * (1 - cldfrc(k)) * evplimit * std::sqrt(flxprec(k));
+
+      // Don't let evaporation supersaturate layer (approx). Layer may already be saturated.
+      evplimit = ekat::impl::max(Scalar(0), (qs(k)-q(k)) / deltat);
+
+      // Don't evaporate more than is falling into the layer
+      evplimit = ekat::impl::min(evplimit, flxprec(k) * gravit / pdel(k));
+
+      // Total evaporation cannot exceed input precipitation
+      evplimit = ekat::impl::min(evplimit, (prec_kg - evpvint) * gravit / pdel(k));
+
+      evpprec = ekat::impl::min(evplimit, evpprec);
+
+      // Evaporation of snow depends on snow fraction of total precip in the top after melting
+      Scalar evpsnow = 0;
+      if (flxprec(k) > 0) {
+        const Scalar work1 = ekat::impl::min(ekat::impl::max(Scalar(0),flxsntm/flxprec(k)),Scalar(1));
+        evpsnow = evpprec * work1;
+      }
+
+      // Vertically integrated evaporation
+      evpvint += evpprec * pdel(k)/gravit;
+
+      // Net precip production is production - evaporation
+      ntprprd(k) = prdprec(k) - evpprec;
+
+      // Net snow production is precip production * ice fraction - evaporation - melting
+      Scalar work1 = 0;
+      if (flxprec(k) > 0) {
+        work1 = ekat::impl::min(ekat::impl::max(Scalar(0),flxsnow(k)/flxprec(k)),Scalar(1));
+      }
+      Scalar work2 = ekat::impl::max(fsnow_conv(k), work1);
+      if (snowmlt > 0) work2 = 0;
+      ntsnprd(k) = prdprec(k)*work2 - evpsnow - snowmlt;
+
+      // Precipitation fluxes, protected against rounding error
+      flxprec(k+1) = ekat::impl::max(flxprec(k) + ntprprd(k) * pdel(k)/gravit, Scalar(0));
+      flxsnow(k+1) = ekat::impl::max(flxsnow(k) + ntsnprd(k) * pdel(k)/gravit, Scalar(0));
+
+      // Heating (cooling) and moistening due to evaporation
+      //  - latent heat of vaporization for precip production has already been accounted for
+      //  - snow is contained in prec
+      tend_s(k) = -evpprec*latvap + ntsnprd(k)*latice;
+      tend_q(k) = evpprec;
+    }
+
+    // Set output precipitation rates (m/s)
+    prec = flxprec(nlev) / 1000;
+    snow = flxsnow(nlev) / 1000;
+  });
+  team.team_barrier();
+
+  // Release temporary variables from the workspace
+  workspace.template release_many_contiguous<3>(
+    {&qs_p, &fice_p, &fsnow_conv_p});
+}
+
+} // namespace zm
+} // namespace scream
+
+#endif
@@ -0,0 +1,334 @@
+#ifndef ZM_CONVR_IMPL_HPP
+#define ZM_CONVR_IMPL_HPP
+
+#include "zm_functions.hpp" // for ETI only but harmless for GPU
+
+namespace scream {
+namespace zm {
+
+/*
+ * Implementation of zm zm_convr. Clients should NOT #include
+ * this file, #include zm_functions.hpp instead.
+ *
+ * This is a port of the convective core zm_convr in zm_conv.F90, in its
+ * default configuration (no trigmem/dcape-ull triggers). The Fortran code
+ * gathers the columns where cape>capelmt, and runs the cloud model on the
+ * gathered arrays; here each team handles one column, and the cloud model
+ * only runs if the column is deep. Pointwise initializations are parallel
+ * over levels, while the cloud model is inherently serial in the vertical,
+ * and is done by a single thread of the team.
+ *
+ * Level indices are 0-based, so that the output jctop/jcbot/jt/maxg are
+ * 0-based too. The gathered outputs of the Fortran code (mu, md, du, eu, ed,
+ * dp, dsubcld, jt, maxg) are stored in the column itself, and are zero (jt and
+ * maxg are set to nlev-1 and 0, like jctop and jcbot) if the column is not deep.
+ * Returns true if the column is deep.
+ */
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+bool Functions<S,D>
+::zm_convr(
+  const MemberType&             team,
+  const Int&                    nlev,
+  const Int&                    msg,
+  const bool&                   no_deep_pbl,
+  const Scalar&                 delt,
+  const uview_1d<const Scalar>& t,
+  const uview_1d<const Scalar>& qh,
+  const uview_1d<const Scalar>& pap,
+  const uview_1d<const Scalar>& paph,
+  const uview_1d<const Scalar>& dpp,
+  const uview_1d<const Scalar>& zm,
+  const uview_1d<const Scalar>& zi,
+  const Scalar&                 geos,
+  const Scalar&                 pblh,
+  const Scalar&                 tpert,
+  const Scalar&                 landfrac,
+  const Workspace&              workspace,
+  Scalar&                       prec,
+  Scalar&                       jctop,
+  Scalar&                       jcbot,
+  const uview_1d<Scalar>&       qtnd,
+  const uview_1d<Scalar>&       heat,
+  const uview_1d<Scalar>&       mcon,
+  const uview_1d<Scalar>&       cme,
+  Scalar&                       cape,
+  const uview_1d<Scalar>&       dlf,
+  const uview_1d<Scalar>&       pflx,
+  const uview_1d<Scalar>&       zdu,
+  const uview_1d<Scalar>&       rprd,
+  const uview_1d<Scalar>&       mu,
+  const uview_1d<Scalar>&       md,
+  const uview_1d<Scalar>&       du,
+  const uview_1d<Scalar>&       eu,
+  const uview_1d<Scalar>&       ed,
+  const uview_1d<Scalar>&       dp,
+  Scalar&                       dsubcld,
+  Scalar&                       jt,
+  Scalar&                       maxg,
+  const uview_1d<Scalar>&       ql,
+  Scalar&                       rliq)
+{
+  const Scalar cpres   = C::Cpair;
+  const Scalar grav    = C::gravit;
+  const Scalar rgrav   = 1/C::gravit;
+  const Scalar capelmt = ZC::capelmt;
+
+  // Define temporary variables
+  uview_1d<Spack> p_p, z_p, s_p, pf_p, zf_p, shat_p, qhat_p, tp_p, qstp_p,
+                  tv_p, tpv_p, buoy_p, tmix_p, qtmix_p, qsmix_p, smix_p,
+                  xsh2o_p, ds_xsh2o_p, ds_freeze_p,
+                  sd_p, qd_p, qu_p, su_p, qs_p, hmn_p, hsat_p, evp_p, cu_p,
+                  gamma_p, hu_p, hd_p, eps_p, f_p, k1_p, i2_p, i3_p, i4_p,
+                  qsthat_p, hsthat_p, gamhat_p, qds_p;
+  workspace.template take_many_contiguous_unsafe<41>(
+    {"p", "z", "s", "pf", "zf", "shat", "qhat", "tp", "qstp",
+     "tv", "tpv", "buoy", "tmix", "qtmix", "qsmix", "smix",
+     "xsh2o", "ds_xsh2o", "ds_freeze",
+     "sd", "qd", "qu", "su", "qs", "hmn", "hsat", "evp", "cu",
+     "gamma", "hu", "hd", "eps", "f", "k1", "i2", "i3", "i4",
+     "qsthat", "hsthat", "gamhat", "qds"},
+    {&p_p, &z_p, &s_p, &pf_p, &zf_p, &shat_p, &qhat_p, &tp_p, &qstp_p,
+     &tv_p, &tpv_p, &buoy_p, &tmix_p, &qtmix_p, &qsmix_p, &smix_p,
+     &xsh2o_p, &ds_xsh2o_p, &ds_freeze_p,
+     &sd_p, &qd_p, &qu_p, &su_p, &qs_p, &hmn_p, &hsat_p, &evp_p, &cu_p,
+     &gamma_p, &hu_p, &hd_p, &eps_p, &f_p, &k1_p, &i2_p, &i3_p, &i4_p,
+     &qsthat_p, &hsthat_p, &gamhat_p, &qds_p});
+  const auto p         = ekat::scalarize(p_p);
+  const auto z         = ekat::scalarize(z_p);
+  const auto s         = ekat::scalarize(s_p);
+  const auto pf        = ekat::scalarize(pf_p);
+  const auto zf        = ekat::scalarize(zf_p);
+  const auto shat      = ekat::scalarize(shat_p);
+  const auto qhat      = ekat::scalarize(qhat_p);
+  const auto tp        = ekat::scalarize(tp_p);
+  const auto qstp      = ekat::scalarize(qstp_p);
+  const auto tv        = ekat::scalarize(tv_p);
+  const auto tpv       = ekat::scalarize(tpv_p);
+  const auto buoy      = ekat::scalarize(buoy_p);
+  const auto tmix      = ekat::scalarize(tmix_p);
+  const auto qtmix     = ekat::scalarize(qtmix_p);
+  const auto qsmix     = ekat::scalarize(qsmix_p);
+  const auto smix      = ekat::scalarize(smix_p);
+  const auto xsh2o     = ekat::scalarize(xsh2o_p);
+  const auto ds_xsh2o  = ekat::scalarize(ds_xsh2o_p);
+  const auto ds_freeze = ekat::scalarize(ds_freeze_p);
+  const auto sd        = ekat::scalarize(sd_p);
+  const auto qd        = ekat::scalarize(qd_p);
+  const auto qu        = ekat::scalarize(qu_p);
+  const auto su        = ekat::scalarize(su_p);
+  const auto qs        = ekat::scalarize(qs_p);
+  const auto hmn       = ekat::scalarize(hmn_p);
+  const auto hsat      = ekat::scalarize(hsat_p);
+  const auto evp       = ekat::scalarize(evp_p);
+  const auto cu        = ekat::scalarize(cu_p);
+  const auto gamma     = ekat::scalarize(gamma_p);
+  const auto hu        = ekat::scalarize(hu_p);
+  const auto hd        = ekat::scalarize(hd_p);
+  const auto eps       = ekat::scalarize(eps_p);
+  const auto f         = ekat::scalarize(f_p);
+  const auto k1        = ekat::scalarize(k1_p);
+  const auto i2        = ekat::scalarize(i2_p);
+  const auto i3        = ekat::scalarize(i3_p);
+  const auto i4        = ekat::scalarize(i4_p);
+  const auto qsthat    = ekat::scalarize(qsthat_p);
+  const auto hsthat    = ekat::scalarize(hsthat_p);
+  const auto gamhat    = ekat::scalarize(gamhat_p);
+  const auto qds       = ekat::scalarize(qds_p);
+
+  // Initialize the outputs, and compute local pressure (mb) and height (m)
+  // for both interface and mid-layer locations. Also define the dry static
+  // energy (normalized by cp), and its interface values.
+  const Scalar zs = geos*rgrav;
+  Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlev+1), [&] (const Int& k) {
+    pflx(k) = 0;
+    mcon(k) = 0;
+    pf(k) = paph(k)*Scalar(0.01);
+    zf(k) = zi(k) + zs;
+    if (k == nlev) return;
+
+    qtnd(k) = 0;
+    heat(k) = 0;
+    cme(k)  = 0;
+    rprd(k) = 0;
+    zdu(k)  = 0;
+    ql(k)   = 0;
+    dlf(k)  = 0;
+    mu(k)   = 0;
+    md(k)   = 0;
+    du(k)   = 0;
+    eu(k)   = 0;
+    ed(k)   = 0;
+    dp(k)   = 0;
+
+    p(k) = pap(k)*Scalar(0.01);
+    z(k) = zm(k) + zs;
+    s(k) = t(k) + (grav/cpres)*z(k);
+    tp(k) = 0;
+    shat(k) = s(k);
+    qhat(k) = qh(k);
+  });
+  team.team_barrier();
+
+  bool deep;
+  Kokkos::single(Kokkos::PerTeam(team), [&] (bool& is_deep) {
+    prec    = 0;
+    rliq    = 0;
+    jctop   = nlev-1;
+    jcbot   = 0;
+    dsubcld = 0;
+    jt      = nlev-1;
+    maxg    = 0;
+
+    Int pblt = nlev-1;
+    for (Int k=nlev-2; k>=msg; --k) {
+      if (std::abs(z(k)-zs-pblh) < (zf(k)-zf(k+1))*Scalar(0.5)) pblt = k;
+    }
+
+    // Evaluate Tparcel, qs(Tparcel), buoyancy and CAPE,
+    // lcl, lel, parcel launch level at index mx
+    Scalar tl;
+    Int lcl, lel, mx;
+    buoyan_dilute(nlev, msg, qh, t, p, z, pf, pblt, tpert, tp, qstp, tl, cape,
+                  lcl, lel, mx, tv, tpv, buoy, tmix, qtmix, qsmix, smix,
+                  xsh2o, ds_xsh2o, ds_freeze);
+
+    // Determine whether the column will undergo some deep convection
+    is_deep = cape > capelmt;
+
+    if (is_deep) {
+      for (Int k=0; k<nlev; ++k) {
+        dp(k) = Scalar(0.01)*dpp(k);
+      }
+
+      // Sub-cloud layer pressure "thickness", for use in closure and tendency routines
+      for (Int k=msg; k<nlev; ++k) {
+        if (k >= mx) {
+          dsubcld = dsubcld + dp(k);
+        }
+      }
+
+      // Interfacial values for (q,s) used in subsequent routines
+      for (Int k=msg+1; k<nlev; ++k) {
+        Scalar sdifr = 0;
+        Scalar qdifr = 0;
+        if (s(k) > 0 || s(k-1) > 0) {
+          sdifr = std::abs((s(k)-s(k-1))/ekat::impl::max(s(k-1),s(k)));
+        }
+        if (qh(k) > 0 || qh(k-1) > 0) {
+          qdifr = std::abs((qh(k)-qh(k-1))/ekat::impl::max(qh(k-1),qh(k)));
+        }
+        if (sdifr > Scalar(1.e-6)) {
+          shat(k) = std::log(s(k-1)/s(k))*s(k-1)*s(k)/(s(k-1)-s(k));
+        } else {
+          shat(k) = Scalar(0.5)*(s(k)+s(k-1));
+        }
+        if (qdifr > Scalar(1.e-6)) {
+          qhat(k) = std::log(qh(k-1)/qh(k))*qh(k-1)*qh(k)/(qh(k-1)-qh(k));
+        } else {
+          qhat(k) = Scalar(0.5)*(qh(k)+qh(k-1));
+        }
+      }
+
+      // Obtain cloud properties
+      Int jt_k, jlcl, j0, jd;
+      cldprp(nlev, msg, qh, t, p, z, s, zf, shat, landfrac, tpert, mx, lel,
+             mu, eu, du, md, ed, sd, qd, mcon, qu, su, qs, hmn, hsat, ql, cme,
+             jt_k, jlcl, j0, jd, pflx, evp, cu, rprd,
+             gamma, hu, hd, eps, f, k1, i2, i3, i4, qsthat, hsthat, gamhat, qds);
+
+      // Convert detrainment from units of "1/m" to "1/mb"
+      for (Int k=msg; k<nlev; ++k) {
+        du(k)   = du(k)  *(zf(k)-zf(k+1))/dp(k);
+        eu(k)   = eu(k)  *(zf(k)-zf(k+1))/dp(k);
+        ed(k)   = ed(k)  *(zf(k)-zf(k+1))/dp(k);
+        cu(k)   = cu(k)  *(zf(k)-zf(k+1))/dp(k);
+        cme(k)  = cme(k) *(zf(k)-zf(k+1))/dp(k);
+        rprd(k) = rprd(k)*(zf(k)-zf(k+1))/dp(k);
+        evp(k)  = evp(k) *(zf(k)-zf(k+1))/dp(k);
+      }
+
+      Scalar mb;
+      closure(nlev, msg, qh, t, p, s, tp, qu, su, mcon, du, mu, md, qd, sd,
+              qhat, shat, dp, qstp, zf, ql, dsubcld, cape, tl, lcl, lel, jt_k, mx, mb);
+
+      // Limit cloud base mass flux to theoretical upper bound
+      Scalar mumax = 0;
+      for (Int k=msg+1; k<nlev; ++k) {
+        mumax = ekat::impl::max(mumax, mu(k)/dp(k));
+      }
+      if (mumax > 0) {
+        mb = ekat::impl::min(mb, Scalar(0.5)/(delt*mumax));
+      } else {
+        mb = 0;
+      }
+      // If no_deep_pbl = true, don't allow convection entirely
+      // within PBL (suggestion of Bjorn Stevens, 8-2000)
+      if (no_deep_pbl) {
+        if (zm(jt_k) < pblh) mb = 0;
+      }
+
+      for (Int k=msg; k<nlev; ++k) {
+        mu(k)     = mu(k)  *mb;
+        md(k)     = md(k)  *mb;
+        mcon(k)   = mcon(k)*mb;
+        du(k)     = du(k)  *mb;
+        eu(k)     = eu(k)  *mb;
+        ed(k)     = ed(k)  *mb;
+        cme(k)    = cme(k) *mb;
+        rprd(k)   = rprd(k)*mb;
+        cu(k)     = cu(k)  *mb;
+        evp(k)    = evp(k) *mb;
+        pflx(k+1) = pflx(k+1)*mb*100/grav;
+      }
+
+      // Compute temperature and moisture changes due to convection
+      q1q2_pjr(nlev, msg, qu, su, du, qhat, shat, dp, mu, md, sd, qd, ql,
+               dsubcld, jt_k, mx, evp, cu, qtnd, heat, dlf);
+
+      for (Int k=msg; k<nlev; ++k) {
+        zdu(k)  = du(k);
+        heat(k) = heat(k)*cpres;
+      }
+      jt      = jt_k;
+      maxg    = mx;
+      jctop   = jt_k;
+      jcbot   = mx;
+    }
+
+    // Compute precip by integrating change in water vapor minus detrained cloud water.
+    // Note: qtnd is zero where the column is not updated, so q=qh there.
+    for (Int k=nlev-1; k>=msg; --k) {
+      const Scalar q = qh(k) + 2*delt*qtnd(k);
+      prec = prec - dpp(k)*(q-qh(k)) - dpp(k)*dlf(k)*2*delt;
+    }
+
+    // Obtain final precipitation rate in m/s
+    prec = rgrav*ekat::impl::max(prec, Scalar(0))/(2*delt)/1000;
+
+    // Compute reserved liquid (not yet in cldliq) for energy integrals.
+    // Treat rliq as flux out bottom, to be added back later.
+    for (Int k=0; k<nlev; ++k) {
+      rliq = rliq + dlf(k)*dpp(k)/grav;
+    }
+    rliq = rliq/1000;
+  }, deep);
+  team.team_barrier();
+
+  // Release temporary variables from the workspace
+  workspace.template release_many_contiguous<41>(
+    {&p_p, &z_p, &s_p, &pf_p, &zf_p, &shat_p, &qhat_p, &tp_p, &qstp_p,
+     &tv_p, &tpv_p, &buoy_p, &tmix_p, &qtmix_p, &qsmix_p, &smix_p,
+     &xsh2o_p, &ds_xsh2o_p, &ds_freeze_p,
+     &sd_p, &qd_p, &qu_p, &su_p, &qs_p, &hmn_p, &hsat_p, &evp_p, &cu_p,
+     &gamma_p, &hu_p, &hd_p, &eps_p, &f_p, &k1_p, &i2_p, &i3_p, &i4_p,
+     &qsthat_p, &hsthat_p, &gamhat_p, &qds_p});
+
+  return deep;
+}
+
+} // namespace zm
+} // namespace scream
+
+#endif
@@ -0,0 +1,172 @@
+#ifndef ZM_CONVTRAN_IMPL_HPP
+#define ZM_CONVTRAN_IMPL_HPP
+
+#include "zm_functions.hpp" // for ETI only but harmless for GPU
+
+namespace scream {
+namespace zm {
+
+/*
+ * Implementation of zm convtran. Clients should NOT #include
+ * this file, #include zm_functions.hpp instead.
+ *
+ * This is a port of convtran in zm_conv.F90, for a single deep column. The
+ * tracers q have layout (ntrac,nlev), and are updated in place, with the
+ * tendency integrated over dt. Only the tracers with doconvtran=true are
+ * transported. All tracers are treated as insoluble (fracis=1), and dry
+ * mixing ratios are transported using dp as the dry pressure thickness, so
+ * that the mass fluxes are rescaled by dp/dp, like in the Fortran code.
+ * The updraft/downdraft recursions are serial in the vertical, and are
+ * done by a single thread of the team.
+ */
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>
+::convtran(
+  const MemberType&             team,
+  const Int&                    nlev,
+  const Int&                    jt,
+  const Int&                    mx,
+  const uview_1d<const Scalar>& mu,
+  const uview_1d<const Scalar>& md,
+  const uview_1d<const Scalar>& du,
+  const uview_1d<const Scalar>& eu,
+  const uview_1d<const Scalar>& ed,
+  const uview_1d<const Scalar>& dp,
+  const Scalar&                 dt,
+  const view_1d<const bool>&    doconvtran,
+  const Workspace&              workspace,
+  const uview_2d<Scalar>&       q)
+{
+  const Scalar small = 1.e-36;
+  // mbsth is the threshold below which we treat the mass fluxes as zero (in mb/s)
+  const Scalar mbsth = 1.e-15;
+
+  // Define temporary variables
+  uview_1d<Spack> chat_p, conu_p, cond_p, dcondt_p;
+  workspace.template take_many_contiguous_unsafe<4>(
+    {"chat", "conu", "cond", "dcondt"},
+    {&chat_p, &conu_p, &cond_p, &dcondt_p});
+  const auto chat   = ekat::scalarize(chat_p);
+  const auto conu   = ekat::scalarize(conu_p);
+  const auto cond   = ekat::scalarize(cond_p);
+  const auto dcondt = ekat::scalarize(dcondt_p);
+
+  // Dry pressure thickness, and mass fluxes rescaled by dp/dpdry
+  const auto dptmp = [&] (const Int& k) { return dp(k); };
+  const auto dutmp = [&] (const Int& k) { return du(k)*dp(k)/dp(k); };
+  const auto eutmp = [&] (const Int& k) { return eu(k)*dp(k)/dp(k); };
+  const auto edtmp = [&] (const Int& k) { return ed(k)*dp(k)/dp(k); };
+
+  const Int ntrac = q.extent(0);
+  for (Int m=0; m<ntrac; ++m) {
+    if (not doconvtran(m)) continue;
+
+    const auto c = Kokkos::subview(q, m, Kokkos::ALL());
+
+    // Interpolate environment tracer values to interfaces
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlev), [&] (const Int& k) {
+      const Int km1 = ekat::impl::max(0, k-1);
+      const Scalar minc = ekat::impl::min(c(km1), c(k));
+      const Scalar maxc = ekat::impl::max(c(km1), c(k));
+      Scalar cdifr;
+      if (minc < 0) {
+        cdifr = 0;
+      } else {
+        cdifr = std::abs(c(k)-c(km1))/ekat::impl::max(maxc, small);
+      }
+
+      // If the two layers differ significantly use a geometric averaging procedure
+      if (cdifr > Scalar(1.e-6)) {
+        const Scalar cabv = ekat::impl::max(c(km1), maxc*Scalar(1.e-12));
+        const Scalar cbel = ekat::impl::max(c(k),   maxc*Scalar(1.e-12));
+        chat(k) = std::log(cabv/cbel)/(cabv-cbel)*cabv*cbel;
+      } else {
+        // Small diff, so just arithmetic mean
+        chat(k) = Scalar(0.5)*(c(k)+c(km1));
+      }
+
+      // Provisional up and down draft values, and tendencies
+      conu(k)   = chat(k);
+      cond(k)   = chat(k);
+      dcondt(k) = 0;
+    });
+    team.team_barrier();
+
+    Kokkos::single(Kokkos::PerTeam(team), [&] () {
+      // Do levels adjacent to top and bottom
+      {
+        const Int k = 1, km1 = 0, kk = nlev-1;
+        const Scalar mupdudp = mu(kk) + dutmp(kk)*dptmp(kk);
+        if (mupdudp > mbsth) {
+          conu(kk) = (+eutmp(kk)*c(kk)*dptmp(kk))/mupdudp;
+        }
+        if (md(k) < -mbsth) {
+          cond(k) = (-edtmp(km1)*c(km1)*dptmp(km1))/md(k);
+        }
+      }
+
+      // Updraft from bottom to top
+      for (Int kk=nlev-2; kk>=0; --kk) {
+        const Int kkp1 = ekat::impl::min(nlev-1, kk+1);
+        const Scalar mupdudp = mu(kk) + dutmp(kk)*dptmp(kk);
+        if (mupdudp > mbsth) {
+          conu(kk) = (mu(kkp1)*conu(kkp1) + eutmp(kk)*c(kk)*dptmp(kk))/mupdudp;
+        }
+      }
+
+      // Downdraft from top to bottom
+      for (Int k=2; k<nlev; ++k) {
+        const Int km1 = ekat::impl::max(0, k-1);
+        if (md(k) < -mbsth) {
+          cond(k) = (md(km1)*cond(km1) - edtmp(km1)*c(km1)*dptmp(km1))/md(k);
+        }
+      }
+    });
+    team.team_barrier();
+
+    // Limit fluxes outside convection to mass in appropriate layer (version 3
+    // of the Fortran code). These limiters are probably only safe for positive
+    // definite quantities, and assume that mu and md already satisfy a courant
+    // number limit of 1.
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team, jt, nlev), [&] (const Int& k) {
+      const Int km1 = ekat::impl::max(0, k-1);
+      const Int kp1 = ekat::impl::min(nlev-1, k+1);
+      Scalar fluxin, fluxout;
+      if (k < mx) {
+        fluxin  = mu(kp1)*conu(kp1) + mu(k)*ekat::impl::min(chat(k), c(km1))
+                  - (md(k)*cond(k) + md(kp1)*ekat::impl::min(chat(kp1), c(kp1)));
+        fluxout = mu(k)*conu(k) + mu(kp1)*ekat::impl::min(chat(kp1), c(k))
+                  - (md(kp1)*cond(kp1) + md(k)*ekat::impl::min(chat(k), c(k)));
+      } else if (k == mx) {
+        fluxin  = mu(k)*ekat::impl::min(chat(k), c(km1)) - md(k)*cond(k);
+        fluxout = mu(k)*conu(k) - md(k)*ekat::impl::min(chat(k), c(k));
+      } else {
+        dcondt(k) = 0;
+        return;
+      }
+
+      Scalar netflux = fluxin - fluxout;
+      if (std::abs(netflux) < ekat::impl::max(fluxin, fluxout)*Scalar(1.e-12)) {
+        netflux = 0;
+      }
+      dcondt(k) = netflux/dptmp(k);
+    });
+    team.team_barrier();
+
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlev), [&] (const Int& k) {
+      c(k) += dt*dcondt(k);
+    });
+    team.team_barrier();
+  }
+
+  // Release temporary variables from the workspace
+  workspace.template release_many_contiguous<4>(
+    {&chat_p, &conu_p, &cond_p, &dcondt_p});
+}
+
+} // namespace zm
+} // namespace scream
+
+#endif
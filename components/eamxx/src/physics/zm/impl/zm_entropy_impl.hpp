@@ -0,0 +1,134 @@
+#ifndef ZM_ENTROPY_IMPL_HPP
+#define ZM_ENTROPY_IMPL_HPP
+
+#include "zm_functions.hpp" // for ETI only but harmless for GPU
+
+namespace scream {
+namespace zm {
+
+/*
+ * Implementation of zm entropy and ientropy. Clients should NOT #include
+ * this file, #include zm_functions.hpp instead.
+ *
+ * These are ports of the functions with the same names in zm_conv.F90,
+ * used by the dilute parcel calculation. Pressures are in hPa.
+ */
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+typename Functions<S,D>::Scalar
+Functions<S,D>::entropy(const Scalar& tk, const Scalar& p, const Scalar& qtot)
+{
+  const Scalar rl     = C::LatVap;
+  const Scalar cpliq  = C::CpLiq;
+  const Scalar tfreez = C::Tmelt;
+  const Scalar eps1   = C::ep_2;
+  const Scalar cpres  = C::Cpair;
+  const Scalar cpwv   = ZC::cpwv;
+  const Scalar rgas   = ZC::rair;
+  const Scalar rh2o   = ZC::rh2o;
+  const Scalar pref   = 1000;
+
+  // Raymond and Blyth 1992
+  const Scalar L = rl - (cpliq - cpwv)*(tk-tfreez);
+
+  Scalar est, qst;
+  qsat_hpa(tk, p, est, qst);
+
+  // Partition qtot into vapor part only
+  const Scalar qv = ekat::impl::min(qtot, qst);
+  const Scalar e  = qv*p / (eps1+qv);
+
+  return (cpres + qtot*cpliq)*std::log(tk/tfreez) - rgas*std::log((p-e)/pref)
+         + L*qv/tk - qv*rh2o*std::log(qv/qst);
+}
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>::ientropy(
+  const Scalar& s,
+  const Scalar& p,
+  const Scalar& qt,
+  const Scalar& tfg,
+  Scalar&       t,
+  Scalar&       qst)
+{
+  // Invert the entropy equation for T, using Brent's method, as in the Fortran code.
+  // Brent, R. P. Ch. 3-4 in Algorithms for Minimization Without Derivatives. Englewood Cliffs, NJ: Prentice-Hall, 1973.
+  static constexpr Int    loopmax = 100;
+  static constexpr Scalar eps     = 3.e-8;
+  static constexpr Scalar tol     = 0.001;
+
+  Scalar a = tfg-10; // low bracket
+  Scalar b = tfg+10; // high bracket
+
+  Scalar fa = entropy(a, p, qt) - s;
+  Scalar fb = entropy(b, p, qt) - s;
+
+  Scalar c  = b;
+  Scalar fc = fb;
+  Scalar d = 0, ebr = 0;
+
+  for (Int i=0; i<=loopmax; ++i) {
+    if ((fb > 0 && fc > 0) || (fb < 0 && fc < 0)) {
+      c   = a;
+      fc  = fa;
+      d   = b-a;
+      ebr = d;
+    }
+    if (std::abs(fc) < std::abs(fb)) {
+      a  = b;
+      b  = c;
+      c  = a;
+      fa = fb;
+      fb = fc;
+      fc = fa;
+    }
+
+    const Scalar tol1 = 2*eps*std::abs(b) + Scalar(0.5)*tol;
+    const Scalar xm   = Scalar(0.5)*(c-b);
+    if (std::abs(xm) <= tol1 || fb == 0) {
+      break;
+    }
+
+    if (std::abs(ebr) >= tol1 && std::abs(fa) > std::abs(fb)) {
+      const Scalar sbr = fb/fa;
+      Scalar pbr, qbr;
+      if (a == c) {
+        pbr = 2*xm*sbr;
+        qbr = 1-sbr;
+      } else {
+        qbr = fa/fc;
+        const Scalar rbr = fb/fc;
+        pbr = sbr*(2*xm*qbr*(qbr-rbr)-(b-a)*(rbr-1));
+        qbr = (qbr-1)*(rbr-1)*(sbr-1);
+      }
+      if (pbr > 0) qbr = -qbr;
+      pbr = std::abs(pbr);
+      if (2*pbr < ekat::impl::min(3*xm*qbr-std::abs(tol1*qbr), std::abs(ebr*qbr))) {
+        ebr = d;
+        d   = pbr/qbr;
+      } else {
+        d   = xm;
+        ebr = d;
+      }
+    } else {
+      d   = xm;
+      ebr = d;
+    }
+    a  = b;
+    fa = fb;
+    b += (std::abs(d) > tol1 ? d : std::copysign(tol1, xm));
+
+    fb = entropy(b, p, qt) - s;
+  }
+
+  t = b;
+  Scalar est;
+  qsat_hpa(t, p, est, qst);
+}
+
+} // namespace zm
+} // namespace scream
+
+#endif
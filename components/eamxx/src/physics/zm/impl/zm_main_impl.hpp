@@ -0,0 +1,147 @@
+#ifndef ZM_MAIN_IMPL_HPP
+#define ZM_MAIN_IMPL_HPP
+
+#include "zm_functions.hpp" // for ETI only but harmless for GPU
+
+#include <chrono>
+
+namespace scream {
+namespace zm {
+
+/*
+ * Implementation of zm main function. Clients should NOT #include
+ * this file, #include zm_functions.hpp instead.
+ *
+ * This mirrors the sequence of calls of zm_conv_tend in zm_conv_intr.F90:
+ * convective core, evaporation of precip, and, in deep columns, convective
+ * transport of momentum and tracers. The core uses a timestep of dtime/2
+ * (delt), like in the Fortran code.
+ */
+
+template<typename S, typename D>
+Int Functions<S,D>::zm_main(
+  const Int&           ncol,            // Number of columns
+  const Int&           nlev,            // Number of levels
+  const Int&           limcnv,          // Top level (1-based) where convection is allowed
+  const bool&          no_deep_pbl,     // Whether to prevent convection entirely within the PBL
+  const Scalar&        dtime,           // ZM timestep [s]
+  WorkspaceMgr&        workspace_mgr,   // WorkspaceManager for local variables
+  const ZMInput&       zm_input,        // Input
+  const ZMInputOutput& zm_input_output, // Input/Output
+  const ZMOutput&      zm_output)       // Output
+{
+  using ExeSpace = typename KT::ExeSpace;
+
+  // Start timer
+  auto start = std::chrono::steady_clock::now();
+
+  const Int msg = limcnv-1;
+  const Scalar delt = Scalar(0.5)*dtime;
+
+  const auto nlev_packs = ekat::npack<Spack>(nlev+1);
+  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, nlev_packs);
+  Kokkos::parallel_for("zm_main", policy, KOKKOS_LAMBDA(const MemberType& team) {
+    const Int i = team.league_rank();
+
+    auto workspace = workspace_mgr.get_workspace(team);
+
+    const auto T_mid_s          = ekat::subview(zm_input.T_mid, i);
+    const auto qv_s             = ekat::subview(zm_input.qv, i);
+    const auto p_mid_s          = ekat::subview(zm_input.p_mid, i);
+    const auto p_int_s          = ekat::subview(zm_input.p_int, i);
+    const auto pseudo_density_s = ekat::subview(zm_input.pseudo_density, i);
+    const auto z_mid_s          = ekat::subview(zm_input.z_mid, i);
+    const auto z_int_s          = ekat::subview(zm_input.z_int, i);
+    const auto cldfrac_s        = ekat::subview(zm_input.cldfrac, i);
+    const auto horiz_winds_s    = ekat::subview(zm_input_output.horiz_winds, i);
+    const auto tracers_s        = ekat::subview(zm_input_output.tracers, i);
+    const auto qtnd_s           = ekat::subview(zm_output.qtnd, i);
+    const auto heat_s           = ekat::subview(zm_output.heat, i);
+    const auto mcon_s           = ekat::subview(zm_output.mcon, i);
+    const auto cme_s            = ekat::subview(zm_output.cme, i);
+    const auto dlf_s            = ekat::subview(zm_output.dlf, i);
+    const auto pflx_s           = ekat::subview(zm_output.pflx, i);
+    const auto zdu_s            = ekat::subview(zm_output.zdu, i);
+    const auto rprd_s           = ekat::subview(zm_output.rprd, i);
+    const auto mu_s             = ekat::subview(zm_output.mu, i);
+    const auto md_s             = ekat::subview(zm_output.md, i);
+    const auto du_s             = ekat::subview(zm_output.du, i);
+    const auto eu_s             = ekat::subview(zm_output.eu, i);
+    const auto ed_s             = ekat::subview(zm_output.ed, i);
+    const auto dp_s             = ekat::subview(zm_output.dp, i);
+    const auto ql_s             = ekat::subview(zm_output.ql, i);
+    const auto tend_s_s         = ekat::subview(zm_output.tend_s, i);
+    const auto tend_q_s         = ekat::subview(zm_output.tend_q, i);
+    const auto ntprprd_s        = ekat::subview(zm_output.ntprprd, i);
+    const auto ntsnprd_s        = ekat::subview(zm_output.ntsnprd, i);
+    const auto flxprec_s        = ekat::subview(zm_output.flxprec, i);
+    const auto flxsnow_s        = ekat::subview(zm_output.flxsnow, i);
+    const auto pguall_s         = ekat::subview(zm_output.pguall, i);
+    const auto pgdall_s         = ekat::subview(zm_output.pgdall, i);
+    const auto icwu_s           = ekat::subview(zm_output.icwu, i);
+
+    // Convective core
+    const bool deep =
+      zm_convr(team, nlev, msg, no_deep_pbl, delt,
+               T_mid_s, qv_s, p_mid_s, p_int_s, pseudo_density_s,    // Input
+               z_mid_s, z_int_s, zm_input.phis(i), zm_input.pblh(i), // Input
+               zm_input.tpert(i), zm_input.landfrac(i),              // Input
+               workspace,                                            // Workspace
+               zm_output.prec(i), zm_output.jctop(i), zm_output.jcbot(i), // Output
+               qtnd_s, heat_s, mcon_s, cme_s, zm_output.cape(i),     // Output
+               dlf_s, pflx_s, zdu_s, rprd_s,                         // Output
+               mu_s, md_s, du_s, eu_s, ed_s, dp_s,                   // Output
+               zm_output.dsubcld(i), zm_output.jt(i), zm_output.maxg(i), // Output
+               ql_s, zm_output.rliq(i));                             // Output
+
+    // Evaporation of convective precip
+    zm_conv_evap(team, nlev, dtime,
+                 T_mid_s, p_mid_s, pseudo_density_s, qv_s,  // Input
+                 rprd_s, cldfrac_s,                         // Input
+                 workspace,                                 // Workspace
+                 zm_output.prec(i),                         // Input/Output
+                 zm_output.snow(i),                         // Output
+                 tend_s_s, tend_q_s, ntprprd_s, ntsnprd_s,  // Output
+                 flxprec_s, flxsnow_s);                     // Output
+
+    if (deep) {
+      const Int jt = zm_output.jt(i);
+      const Int mx = zm_output.maxg(i);
+
+      // Convective transport of momentum. The heating needed to conserve
+      // the kinetic energy is added to the heating of the convective core.
+      uview_1d<Spack> seten_p;
+      workspace.template take_many_contiguous_unsafe<1>({"seten"}, {&seten_p});
+      const auto seten = ekat::scalarize(seten_p);
+      momtran(team, nlev, jt, mx, mu_s, md_s, du_s, eu_s, ed_s, dp_s, dtime,
+              workspace, horiz_winds_s, pguall_s, pgdall_s, icwu_s, seten);
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlev), [&] (const Int& k) {
+        heat_s(k) += seten(k);
+      });
+      team.team_barrier();
+      workspace.template release_many_contiguous<1>({&seten_p});
+
+      // Convective transport of tracers
+      convtran(team, nlev, jt, mx, mu_s, md_s, du_s, eu_s, ed_s, dp_s, dtime,
+               zm_input_output.doconvtran, workspace, tracers_s);
+    } else {
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlev), [&] (const Int& k) {
+        for (Int m=0; m<2; ++m) {
+          pguall_s(m,k) = 0;
+          pgdall_s(m,k) = 0;
+          icwu_s(m,k)   = horiz_winds_s(m,k);
+        }
+      });
+    }
+  });
+  Kokkos::fence();
+
+  auto finish = std::chrono::steady_clock::now();
+  auto duration = std::chrono::duration_cast<std::chrono::microseconds>(finish - start);
+  return duration.count();
+}
+
+} // namespace zm
+} // namespace scream
+
+#endif
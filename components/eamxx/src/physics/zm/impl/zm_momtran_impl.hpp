@@ -0,0 +1,207 @@
+#ifndef ZM_MOMTRAN_IMPL_HPP
+#define ZM_MOMTRAN_IMPL_HPP
+
+#include "zm_functions.hpp" // for ETI only but harmless for GPU
+
+namespace scream {
+namespace zm {
+
+/*
+ * Implementation of zm momtran. Clients should NOT #include
+ * this file, #include zm_functions.hpp instead.
+ *
+ * This is a port of momtran in zm_conv.F90, for a single deep column. The
+ * horizontal winds have layout (2,nlev), and are updated in place, with the
+ * tendency integrated over dt. Besides the apparent forces from the updraft
+ * and downdraft pressure gradients (pguall, pgdall) and the in-cloud updraft
+ * winds (icwu), it computes the dry static energy tendency seten needed to
+ * conserve the kinetic energy dissipated by the transport.
+ * The updraft/downdraft recursions are serial in the vertical, and are
+ * done by a single thread of the team.
+ */
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>
+::momtran(
+  const MemberType&             team,
+  const Int&                    nlev,
+  const Int&                    jt,
+  const Int&                    mx,
+  const uview_1d<const Scalar>& mu,
+  const uview_1d<const Scalar>& md,
+  const uview_1d<const Scalar>& du,
+  const uview_1d<const Scalar>& eu,
+  const uview_1d<const Scalar>& ed,
+  const uview_1d<const Scalar>& dp,
+  const Scalar&                 dt,
+  const Workspace&              workspace,
+  const uview_2d<Scalar>&       wind,
+  const uview_2d<Scalar>&       pguall,
+  const uview_2d<Scalar>&       pgdall,
+  const uview_2d<Scalar>&       icwu,
+  const uview_1d<Scalar>&       seten)
+{
+  // Constants for the updraft/downdraft pressure gradient terms
+  const Scalar momcu = 0.4;
+  const Scalar momcd = 0.4;
+  // mbsth is the threshold below which we treat the mass fluxes as zero (in mb/s)
+  const Scalar mbsth = 1.e-15;
+
+  // Define temporary variables
+  uview_1d<Spack> chat_u_p, cond_u_p, dcondt_u_p, mflux_u_p,
+                  chat_v_p, cond_v_p, dcondt_v_p, mflux_v_p;
+  workspace.template take_many_contiguous_unsafe<8>(
+    {"chat_u", "cond_u", "dcondt_u", "mflux_u",
+     "chat_v", "cond_v", "dcondt_v", "mflux_v"},
+    {&chat_u_p, &cond_u_p, &dcondt_u_p, &mflux_u_p,
+     &chat_v_p, &cond_v_p, &dcondt_v_p, &mflux_v_p});
+  const uview_1d<Scalar> chat[2]   = {ekat::scalarize(chat_u_p),   ekat::scalarize(chat_v_p)};
+  const uview_1d<Scalar> cond[2]   = {ekat::scalarize(cond_u_p),   ekat::scalarize(cond_v_p)};
+  const uview_1d<Scalar> dcondt[2] = {ekat::scalarize(dcondt_u_p), ekat::scalarize(dcondt_v_p)};
+  const uview_1d<Scalar> mflux[2]  = {ekat::scalarize(mflux_u_p),  ekat::scalarize(mflux_v_p)};
+
+  for (Int m=0; m<2; ++m) {
+    const auto c   = Kokkos::subview(wind,   m, Kokkos::ALL());
+    const auto pgu = Kokkos::subview(pguall, m, Kokkos::ALL());
+    const auto pgd = Kokkos::subview(pgdall, m, Kokkos::ALL());
+    const auto conu = Kokkos::subview(icwu,  m, Kokkos::ALL());
+
+    // Interpolate environment wind values to interfaces, and compute the
+    // pressure gradient terms for updraft and downdraft
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlev), [&] (const Int& k) {
+      const Int km1 = ekat::impl::max(0, k-1);
+      const Int kp1 = ekat::impl::min(nlev-1, k+1);
+      chat[m](k) = Scalar(0.5)*(c(k)+c(km1));
+
+      // Provisional up and down draft values, and tendencies
+      conu(k)      = chat[m](k);
+      cond[m](k)   = chat[m](k);
+      dcondt[m](k) = 0;
+
+      if (k == 0) {
+        pgu(k) = 0;
+        pgd(k) = 0;
+      } else if (k < nlev-1) {
+        const Scalar mududp = (mu(k) *(c(k)-c(km1))/dp(km1)
+                             + mu(kp1)*(c(kp1)-c(k))/dp(k));
+        pgu(k) = -momcu*Scalar(0.5)*mududp;
+
+        const Scalar mddudp = (md(k) *(c(k)-c(km1))/dp(km1)
+                             + md(kp1)*(c(kp1)-c(k))/dp(k));
+        pgd(k) = -momcd*Scalar(0.5)*mddudp;
+      } else {
+        const Scalar mududp = mu(k)*(c(k)-c(km1))/dp(km1);
+        pgu(k) = -momcu*mududp;
+
+        const Scalar mddudp = md(k)*(c(k)-c(km1))/dp(km1);
+        pgd(k) = -momcd*mddudp;
+      }
+    });
+    team.team_barrier();
+
+    Kokkos::single(Kokkos::PerTeam(team), [&] () {
+      // Do levels adjacent to top and bottom. Note: unlike convtran, the
+      // division by md only applies to the pressure gradient term here.
+      {
+        const Int k = 1, km1 = 0, kk = nlev-1;
+        const Scalar mupdudp = mu(kk) + du(kk)*dp(kk);
+        if (mupdudp > mbsth) {
+          conu(kk) = (+eu(kk)*c(kk)*dp(kk) + pgu(kk)*dp(kk))/mupdudp;
+        }
+        if (md(k) < -mbsth) {
+          cond[m](k) = (-ed(km1)*c(km1)*dp(km1)) - pgd(km1)*dp(km1)/md(k);
+        }
+      }
+
+      // Updraft from bottom to top
+      for (Int kk=nlev-2; kk>=0; --kk) {
+        const Int kkp1 = ekat::impl::min(nlev-1, kk+1);
+        const Scalar mupdudp = mu(kk) + du(kk)*dp(kk);
+        if (mupdudp > mbsth) {
+          conu(kk) = (mu(kkp1)*conu(kkp1) + eu(kk)*c(kk)*dp(kk) + pgu(kk)*dp(kk))/mupdudp;
+        }
+      }
+
+      // Downdraft from top to bottom
+      for (Int k=2; k<nlev; ++k) {
+        const Int km1 = ekat::impl::max(0, k-1);
+        if (md(k) < -mbsth) {
+          cond[m](k) = (md(km1)*cond[m](km1) - ed(km1)*c(km1)*dp(km1) - pgd(km1)*dp(km1))/md(k);
+        }
+      }
+    });
+    team.team_barrier();
+
+    // Tendencies (version 1 of the Fortran code), with the cloud base level
+    // handled separately, and momentum fluxes
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlev+1), [&] (const Int& k) {
+      if (k < jt || k == nlev) {
+        mflux[m](k) = 0;
+        return;
+      }
+      const Int kp1 = ekat::impl::min(nlev-1, k+1);
+      if (k == mx) {
+        dcondt[m](k) = (1/dp(k))*
+                       (-mu(k)*(conu(k)-chat[m](k))
+                        -md(k)*(cond[m](k)-chat[m](k)));
+      } else {
+        dcondt[m](k) = (+mu(kp1)*(conu(kp1)-chat[m](kp1))
+                        -mu(k)  *(conu(k)  -chat[m](k))
+                        +md(kp1)*(cond[m](kp1)-chat[m](kp1))
+                        -md(k)  *(cond[m](k)  -chat[m](k)))/dp(k);
+      }
+      mflux[m](k) = -mu(k)*(conu(k)-chat[m](k))
+                    -md(k)*(cond[m](k)-chat[m](k));
+    });
+  }
+  team.team_barrier();
+
+  // Dry static energy tendency that conserves the kinetic energy
+  Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlev), [&] (const Int& k) {
+    if (k < jt) {
+      seten(k) = 0;
+      return;
+    }
+    const Int km1 = ekat::impl::max(0, k-1);
+    const Int kp1 = ekat::impl::min(nlev-1, k+1);
+    const auto u = Kokkos::subview(wind, 0, Kokkos::ALL());
+    const auto v = Kokkos::subview(wind, 1, Kokkos::ALL());
+
+    const Scalar utop = (u(k)+u(km1))/2;
+    const Scalar vtop = (v(k)+v(km1))/2;
+    const Scalar ubot = (u(kp1)+u(k))/2;
+    const Scalar vbot = (v(kp1)+v(k))/2;
+    const Scalar fket = utop*mflux[0](k)   + vtop*mflux[1](k);   // top of layer
+    const Scalar fkeb = ubot*mflux[0](k+1) + vbot*mflux[1](k+1); // bot of layer
+
+    const Scalar ketend_cons = (fket-fkeb)/dp(k);
+
+    const Scalar uf = u(k) - (mflux[0](k+1)-mflux[0](k))*dt/dp(k);
+    const Scalar vf = v(k) - (mflux[1](k+1)-mflux[1](k))*dt/dp(k);
+    const Scalar ketend = ((uf*uf + vf*vf) - (u(k)*u(k) + v(k)*v(k)))*Scalar(0.5)/dt;
+
+    seten(k) = ketend_cons - ketend;
+  });
+  team.team_barrier();
+
+  // Update the winds, and store the apparent forces (with the right sign)
+  Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlev), [&] (const Int& k) {
+    for (Int m=0; m<2; ++m) {
+      wind(m,k)  += dt*dcondt[m](k);
+      pguall(m,k) = -pguall(m,k);
+      pgdall(m,k) = -pgdall(m,k);
+    }
+  });
+  team.team_barrier();
+
+  // Release temporary variables from the workspace
+  workspace.template release_many_contiguous<8>(
+    {&chat_u_p, &cond_u_p, &dcondt_u_p, &mflux_u_p,
+     &chat_v_p, &cond_v_p, &dcondt_v_p, &mflux_v_p});
+}
+
+} // namespace zm
+} // namespace scream
+
+#endif
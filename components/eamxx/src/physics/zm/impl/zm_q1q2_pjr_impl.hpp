@@ -0,0 +1,91 @@
+#ifndef ZM_Q1Q2_PJR_IMPL_HPP
+#define ZM_Q1Q2_PJR_IMPL_HPP
+
+#include "zm_functions.hpp" // for ETI only but harmless for GPU
+
+namespace scream {
+namespace zm {
+
+/*
+ * Implementation of zm q1q2_pjr. Clients should NOT #include
+ * this file, #include zm_functions.hpp instead.
+ *
+ * This is a port of q1q2_pjr in zm_conv.F90, computing the temperature and
+ * moisture tendencies due to convection in a single column. It is meant to
+ * be called by a single thread. The Fortran code starts the loops at the
+ * highest cloud top (and lowest cloud base) among the gathered columns; here
+ * we use the column own cloud top and base, which only changes the sign of
+ * some zero tendencies above the cloud top.
+ */
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>
+::q1q2_pjr(
+  const Int&                    nlev,
+  const Int&                    msg,
+  const uview_1d<const Scalar>& qu,
+  const uview_1d<const Scalar>& su,
+  const uview_1d<const Scalar>& du,
+  const uview_1d<const Scalar>& qhat,
+  const uview_1d<const Scalar>& shat,
+  const uview_1d<const Scalar>& dp,
+  const uview_1d<const Scalar>& mu,
+  const uview_1d<const Scalar>& md,
+  const uview_1d<const Scalar>& sd,
+  const uview_1d<const Scalar>& qd,
+  const uview_1d<const Scalar>& ql,
+  const Scalar&                 dsubcld,
+  const Int&                    jt,
+  const Int&                    mx,
+  const uview_1d<const Scalar>& evp,
+  const uview_1d<const Scalar>& cu,
+  const uview_1d<Scalar>&       dqdt,
+  const uview_1d<Scalar>&       dsdt,
+  const uview_1d<Scalar>&       dl)
+{
+  const Scalar cp = C::Cpair;
+  const Scalar rl = C::LatVap;
+
+  for (Int k=msg; k<nlev; ++k) {
+    dsdt(k) = 0;
+    dqdt(k) = 0;
+    dl(k)   = 0;
+  }
+
+  for (Int k=jt; k<nlev-1; ++k) {
+    // condensation in updraft and evaporating rain in downdraft
+    const Scalar emc = -cu(k) + evp(k);
+
+    dsdt(k) = -rl/cp*emc
+              + (+mu(k+1)*(su(k+1)-shat(k+1))
+                 -mu(k)  *(su(k)-shat(k))
+                 +md(k+1)*(sd(k+1)-shat(k+1))
+                 -md(k)  *(sd(k)-shat(k)))/dp(k);
+
+    dqdt(k) = emc
+              + (+mu(k+1)*(qu(k+1)-qhat(k+1))
+                 -mu(k)  *(qu(k)-qhat(k))
+                 +md(k+1)*(qd(k+1)-qhat(k+1))
+                 -md(k)  *(qd(k)-qhat(k)))/dp(k);
+
+    dl(k) = du(k)*ql(k+1);
+  }
+
+  for (Int k=mx; k<nlev; ++k) {
+    if (k == mx) {
+      dsdt(k) = (1/dsubcld)*(-mu(k)*(su(k)-shat(k))
+                             -md(k)*(sd(k)-shat(k)));
+      dqdt(k) = (1/dsubcld)*(-mu(k)*(qu(k)-qhat(k))
+                             -md(k)*(qd(k)-qhat(k)));
+    } else {
+      dsdt(k) = dsdt(k-1);
+      dqdt(k) = dqdt(k-1);
+    }
+  }
+}
+
+} // namespace zm
+} // namespace scream
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef ZM_QSAT_IMPL_HPP
+#define ZM_QSAT_IMPL_HPP
+
+#include "zm_functions.hpp" // for ETI only but harmless for GPU
+
+namespace scream {
+namespace zm {
+
+/*
+ * Implementation of zm qsat. Clients should NOT #include
+ * this file, #include zm_functions.hpp instead.
+ *
+ * This mirrors qsat in zm_conv.F90 called with i_wrt=0, which is the only
+ * way ZM calls it. Unlike physics::qv_sat, there is no check on the
+ * temperature range, so that the results match the Fortran code also
+ * for the (unphysical) inputs the Fortran code accepts.
+ */
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+typename Functions<S,D>::Scalar
+Functions<S,D>::svp(const Scalar& t)
+{
+  // Flatau et al. 1992, table 4 (right-hand column), liquid, V1.7
+  static constexpr Scalar a0 =  6.11239921;
+  static constexpr Scalar a1 =  0.443987641;
+  static constexpr Scalar a2 =  0.142986287e-1;
+  static constexpr Scalar a3 =  0.264847430e-3;
+  static constexpr Scalar a4 =  0.302950461e-5;
+  static constexpr Scalar a5 =  0.206739458e-7;
+  static constexpr Scalar a6 =  0.640689451e-10;
+  static constexpr Scalar a7 = -0.952447341e-13;
+  static constexpr Scalar a8 = -0.976195544e-15;
+
+  const Scalar dt = ekat::impl::max(Scalar(-80), t - Scalar(273.15));
+  Scalar es = a0 + dt*(a1+dt*(a2+dt*(a3+dt*(a4+dt*(a5+dt*(a6+dt*(a7+a8*dt)))))));
+  return es*100;
+}
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+typename Functions<S,D>::Scalar
+Functions<S,D>::qsat(const Scalar& t, const Scalar& p)
+{
+  const Scalar es = svp(t);
+  return C::ep_2*es / ekat::impl::max(Scalar(1.e-3), p-es);
+}
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>::qsat_hpa(const Scalar& t, const Scalar& p, Scalar& es, Scalar& qs)
+{
+  // Same as qsat_hPa in zm_conv.F90: pressure in hPa, and es returned in hPa
+  es = svp(t);
+  qs = C::ep_2*es / ekat::impl::max(Scalar(1.e-3), p*100-es);
+  es = es*Scalar(0.01);
+}
+
+} // namespace zm
+} // namespace scream
+
+#endif
@@ -16,24 +16,32 @@ extern "C"
 {
 
 // Fortran routines to be called from C
-void zm_init_f90     (const Real& limcnv_in, const bool& no_deep_pbl_in);
-void zm_main_f90(const Real& lchnk, const Real& ncol, Real* t, Real* qh, Real* prec,
-			Real* jctop, Real* jcbot, Real* pblh, Real *zm, Real* geos, Real* zi,
-			Real* qtnd, Real* heat, Real* pap, Real* paph, Real* dpp, const Real &delt,
-			Real* mcon, Real* cme, Real* cape, Real* tpert, Real* dlf, Real* plfx,
-			Real* zdu, Real* rprd, Real* mu, Real* md, Real* du, Real* eu, 
-			Real* ed, Real* dp, Real* dsubcld, Real* jt, Real* maxg, Real* ideep,
-			const Real& lengath, Real* ql, Real* rliq, Real* landfrac, Real* hu_nm1,
-			Real* cnv_nm1, Real* tm1, Real* qm1, Real** t_star, Real** q_star, 
-			Real* dcape, Real* q, Real** tend_s,
-			Real** tend_q, Real** cld, Real* snow, Real* ntprprd, Real* ntsnprd,
-			Real** flxprec, Real** flxsnow, const Real& ztodt, Real* pguall, Real* pgdall, 
-			Real* icwu, const Real& ncnst, Real*** fracis 
-			); 
+void zm_init_f90 (Int limcnv, bool no_deep_pbl, Int ncol, Int nlev);
+// Full ZM step (convective core, evaporation of precip, transport of
+// momentum and tracers). See scream_zm_interface.F90 for details.
+void zm_main_f90 (Int ncol, Real dtime, const Real* t, const Real* qh, const Real* pap,
+                  const Real* paph, const Real* dpp, const Real* zm, const Real* zi,
+                  const Real* geos, const Real* pblh, const Real* tpert, const Real* landfrac,
+                  const Real* cld, Int ntrac, const bool* doconvtran, Real* winds, Real* tracers,
+                  Real* prec, Real* snow, Real* jctop, Real* jcbot, Real* qtnd, Real* heat,
+                  Real* mcon, Real* cme, Real* cape, Real* dlf, Real* pflx, Real* zdu, Real* rprd,
+                  Real* mu, Real* md, Real* du, Real* eu, Real* ed, Real* dp, Real* dsubcld,
+                  Real* jt, Real* maxg, Real* ql, Real* rliq, Real* tend_s, Real* tend_q,
+                  Real* ntprprd, Real* ntsnprd, Real* flxprec, Real* flxsnow,
+                  Real* pguall, Real* pgdall, Real* icwu);
 void zm_finalize_f90 ();
 
+// Single ZM routines, used by the unit tests. Arrays are Fortran-ordered
+// (pcols,pver) arrays, with pcols/pver returned by zm_dims_f90.
+void zm_dims_f90 (Int& pcols, Int& pver);
+void zm_conv_evap_f90 (Int ncol, const Real* t, const Real* pmid, const Real* pdel,
+                       const Real* q, const Real* prdprec, const Real* cldfrc, Real deltat,
+                       Real* prec, Real* snow, Real* tend_s, Real* tend_q,
+                       Real* ntprprd, Real* ntsnprd, Real* flxprec, Real* flxsnow);
+void cldfrc_fice_f90 (Int ncol, const Real* t, Real* fice, Real* fsnow);
+
 } // extern "C"
 
 } // namespace scream
 
-#endif // SCREAM_SHOC_INTERFACE_HPP
+#endif // SCREAM_ZM_INTERFACE_HPP
@@ -0,0 +1,132 @@
+#include "catch2/catch.hpp"
+
+#include "zm_unit_tests_common.hpp"
+#include "zm_functions.hpp"
+#include "scream_zm_interface.hpp"
+#include "physics/share/physics_constants.hpp"
+#include "share/util/scream_setup_random_test.hpp"
+#include "share/scream_types.hpp"
+
+namespace scream {
+namespace zm {
+namespace unit_test {
+
+template <typename D>
+struct UnitWrap::UnitTest<D>::TestCldfrcFice {
+
+  // Run the C++ kernel, one team per column
+  static void run_cxx (const Int ncol, const Int nlev, F90Array& t, F90Array& fice, F90Array& fsnow)
+  {
+    const auto t_d     = to_device(t);
+    const auto fice_d  = to_device(fice);
+    const auto fsnow_d = to_device(fsnow);
+
+    const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, nlev);
+    Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+      const Int i = team.league_rank();
+      Functions::cldfrc_fice(team, nlev,
+                             ekat::subview(t_d,i),
+                             ekat::subview(fice_d,i),
+                             ekat::subview(fsnow_d,i));
+    });
+    Kokkos::fence();
+
+    from_device(fice_d,fice);
+    from_device(fsnow_d,fsnow);
+  }
+
+  static void run_property()
+  {
+    using C = scream::physics::Constants<Real>;
+
+    Int ncol, nlev;
+    zm_dims_f90(ncol,nlev);
+
+    // Temperature decreasing from well above melting to well below the
+    // homogeneous freezing range, within each column.
+    F90Array t(ncol,nlev), fice(ncol,nlev), fsnow(ncol,nlev);
+    for (Int i=0; i<ncol; ++i) {
+      for (Int k=0; k<nlev; ++k) {
+        t(i,k) = 310 - 120*Real(k)/(nlev-1) - Real(i)/ncol;
+      }
+    }
+
+    run_cxx(ncol,nlev,t,fice,fsnow);
+
+    for (Int i=0; i<ncol; ++i) {
+      for (Int k=0; k<nlev; ++k) {
+        // Fractions are in [0,1]
+        REQUIRE ( (fice(i,k)>=0 && fice(i,k)<=1) );
+        REQUIRE ( (fsnow(i,k)>=0 && fsnow(i,k)<=1) );
+
+        // Pure water above the max temperatures, pure ice below the min ones
+        if (t(i,k)>C::Tmelt) {
+          REQUIRE (fsnow(i,k)==0);
+        }
+        if (t(i,k)>C::Tmelt-10) {
+          REQUIRE (fice(i,k)==0);
+        }
+        if (t(i,k)<C::Tmelt-5) {
+          REQUIRE (fsnow(i,k)==1);
+        }
+        if (t(i,k)<C::Tmelt-40) {
+          REQUIRE (fice(i,k)==1);
+        }
+
+        // Colder means more ice
+        if (k>0) {
+          REQUIRE (fice(i,k)>=fice(i,k-1));
+          REQUIRE (fsnow(i,k)>=fsnow(i,k-1));
+        }
+      }
+    }
+  }
+
+  static void run_bfb()
+  {
+    auto engine = setup_random_test();
+
+    Int ncol, nlev;
+    zm_dims_f90(ncol,nlev);
+
+    F90Array t(ncol,nlev);
+    randomize(t,engine,190,310);
+
+    F90Array fice_f90(ncol,nlev), fsnow_f90(ncol,nlev);
+    F90Array fice_cxx(ncol,nlev), fsnow_cxx(ncol,nlev);
+
+    cldfrc_fice_f90(ncol, t.data.data(), fice_f90.data.data(), fsnow_f90.data.data());
+    run_cxx(ncol,nlev,t,fice_cxx,fsnow_cxx);
+
+    if (SCREAM_BFB_TESTING) {
+      for (Int i=0; i<ncol; ++i) {
+        for (Int k=0; k<nlev; ++k) {
+          REQUIRE (fice_f90(i,k)==fice_cxx(i,k));
+          REQUIRE (fsnow_f90(i,k)==fsnow_cxx(i,k));
+        }
+      }
+    }
+  }
+};
+
+} // namespace unit_test
+} // namespace zm
+} // namespace scream
+
+namespace {
+
+TEST_CASE("zm_cldfrc_fice_property", "zm")
+{
+  using TestStruct = scream::zm::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestCldfrcFice;
+
+  TestStruct::run_property();
+}
+
+TEST_CASE("zm_cldfrc_fice_bfb", "zm")
+{
+  using TestStruct = scream::zm::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestCldfrcFice;
+
+  TestStruct::run_bfb();
+}
+
+} // namespace
@@ -0,0 +1,214 @@
+#include "catch2/catch.hpp"
+
+#include "zm_unit_tests_common.hpp"
+#include "zm_functions.hpp"
+#include "scream_zm_interface.hpp"
+#include "share/util/scream_setup_random_test.hpp"
+#include "share/scream_types.hpp"
+
+namespace scream {
+namespace zm {
+namespace unit_test {
+
+template <typename D>
+struct UnitWrap::UnitTest<D>::TestZmConvEvap {
+
+  struct EvapData {
+    EvapData (const Int ncol_in, const Int nlev_in)
+      : ncol(ncol_in), nlev(nlev_in)
+      , t(ncol,nlev), pmid(ncol,nlev), pdel(ncol,nlev), q(ncol,nlev)
+      , prdprec(ncol,nlev), cldfrc(ncol,nlev)
+      , prec(ncol,1), snow(ncol,1)
+      , tend_s(ncol,nlev), tend_q(ncol,nlev), ntprprd(ncol,nlev), ntsnprd(ncol,nlev)
+      , flxprec(ncol,nlev+1), flxsnow(ncol,nlev+1)
+    {}
+
+    template <typename Engine>
+    void randomize (Engine& engine) {
+      UnitTest::randomize(t,engine,200,300);
+      UnitTest::randomize(pdel,engine,500,1500);
+      UnitTest::randomize(q,engine,1e-6,2e-2);
+      UnitTest::randomize(prdprec,engine,-1e-8,1e-6);
+      UnitTest::randomize(cldfrc,engine,0,1);
+      UnitTest::randomize(prec,engine,0,1e-6);
+      for (Int i=0; i<ncol; ++i) {
+        Real p = 100;
+        for (Int k=0; k<nlev; ++k) {
+          pmid(i,k) = p + pdel(i,k)/2;
+          p += pdel(i,k);
+        }
+      }
+    }
+
+    Int ncol, nlev;
+    Real dt = 300;
+
+    // Inputs
+    F90Array t, pmid, pdel, q, prdprec, cldfrc;
+    // Input/Output
+    F90Array prec;
+    // Outputs
+    F90Array snow, tend_s, tend_q, ntprprd, ntsnprd, flxprec, flxsnow;
+  };
+
+  static void run_f90 (EvapData& d)
+  {
+    zm_conv_evap_f90(d.ncol, d.t.data.data(), d.pmid.data.data(), d.pdel.data.data(),
+                     d.q.data.data(), d.prdprec.data.data(), d.cldfrc.data.data(), d.dt,
+                     d.prec.data.data(), d.snow.data.data(), d.tend_s.data.data(),
+                     d.tend_q.data.data(), d.ntprprd.data.data(), d.ntsnprd.data.data(),
+                     d.flxprec.data.data(), d.flxsnow.data.data());
+  }
+
+  // Run the C++ kernel, one team per column
+  static void run_cxx (EvapData& d)
+  {
+    const Int nlev = d.nlev;
+    const Real dt  = d.dt;
+
+    const auto t       = to_device(d.t);
+    const auto pmid    = to_device(d.pmid);
+    const auto pdel    = to_device(d.pdel);
+    const auto q       = to_device(d.q);
+    const auto prdprec = to_device(d.prdprec);
+    const auto cldfrc  = to_device(d.cldfrc);
+    const auto prec    = to_device(d.prec);
+    const auto snow    = to_device(d.snow);
+    const auto tend_s  = to_device(d.tend_s);
+    const auto tend_q  = to_device(d.tend_q);
+    const auto ntprprd = to_device(d.ntprprd);
+    const auto ntsnprd = to_device(d.ntsnprd);
+    const auto flxprec = to_device(d.flxprec);
+    const auto flxsnow = to_device(d.flxsnow);
+
+    const Int nlev_packs = ekat::npack<Spack>(nlev);
+    const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(d.ncol, nlev_packs);
+    typename Functions::WorkspaceMgr workspace_mgr(nlev_packs, 3, policy);
+
+    Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+      const Int i = team.league_rank();
+      auto workspace = workspace_mgr.get_workspace(team);
+      Functions::zm_conv_evap(team, nlev, dt,
+                              ekat::subview(t,i), ekat::subview(pmid,i), ekat::subview(pdel,i),
+                              ekat::subview(q,i), ekat::subview(prdprec,i), ekat::subview(cldfrc,i),
+                              workspace, prec(i,0), snow(i,0),
+                              ekat::subview(tend_s,i), ekat::subview(tend_q,i),
+                              ekat::subview(ntprprd,i), ekat::subview(ntsnprd,i),
+                              ekat::subview(flxprec,i), ekat::subview(flxsnow,i));
+    });
+    Kokkos::fence();
+
+    from_device(prec,d.prec);
+    from_device(snow,d.snow);
+    from_device(tend_s,d.tend_s);
+    from_device(tend_q,d.tend_q);
+    from_device(ntprprd,d.ntprprd);
+    from_device(ntsnprd,d.ntsnprd);
+    from_device(flxprec,d.flxprec);
+    from_device(flxsnow,d.flxsnow);
+  }
+
+  static void run_property()
+  {
+    auto engine = setup_random_test();
+
+    Int ncol, nlev;
+    zm_dims_f90(ncol,nlev);
+
+    EvapData d(ncol,nlev);
+    d.randomize(engine);
+
+    // Use a realistic temperature profile, so that qs<1 everywhere
+    std::uniform_real_distribution<Real> jitter(-1,1);
+    for (Int i=0; i<ncol; ++i) {
+      for (Int k=0; k<nlev; ++k) {
+        d.t(i,k) = 200 + 100*Real(k)/(nlev-1) + jitter(engine);
+      }
+    }
+
+    // Saturate the first column, and remove all precip from the second one:
+    // in both cases, nothing can evaporate.
+    for (Int k=0; k<nlev; ++k) {
+      d.q(0,k) = 1;
+      d.prdprec(1,k) = 0;
+    }
+    d.prec(1,0) = 0;
+
+    const EvapData in = d;
+    run_cxx(d);
+
+    for (Int i=0; i<ncol; ++i) {
+      for (Int k=0; k<nlev; ++k) {
+        // Evaporation happens only in the clear-sky part
+        if (in.cldfrc(i,k)==1) {
+          REQUIRE (d.tend_q(i,k)==0);
+        }
+        if (i<2) {
+          REQUIRE (d.tend_q(i,k)==0);
+        }
+
+        // Fluxes are non-negative
+        REQUIRE (d.flxprec(i,k+1)>=0);
+        REQUIRE (d.flxsnow(i,k+1)>=0);
+      }
+      REQUIRE (d.flxprec(i,0)==0);
+      REQUIRE (d.flxsnow(i,0)==0);
+      REQUIRE (d.prec(i,0)>=0);
+      REQUIRE (d.snow(i,0)>=0);
+    }
+  }
+
+  static void run_bfb()
+  {
+    auto engine = setup_random_test();
+
+    Int ncol, nlev;
+    zm_dims_f90(ncol,nlev);
+
+    EvapData d_f90(ncol,nlev);
+    d_f90.randomize(engine);
+    EvapData d_cxx = d_f90;
+
+    run_f90(d_f90);
+    run_cxx(d_cxx);
+
+    if (SCREAM_BFB_TESTING) {
+      for (Int i=0; i<ncol; ++i) {
+        REQUIRE (d_f90.prec(i,0)==d_cxx.prec(i,0));
+        REQUIRE (d_f90.snow(i,0)==d_cxx.snow(i,0));
+        for (Int k=0; k<nlev; ++k) {
+          REQUIRE (d_f90.tend_s(i,k)==d_cxx.tend_s(i,k));
+          REQUIRE (d_f90.tend_q(i,k)==d_cxx.tend_q(i,k));
+          REQUIRE (d_f90.ntprprd(i,k)==d_cxx.ntprprd(i,k));
+          REQUIRE (d_f90.ntsnprd(i,k)==d_cxx.ntsnprd(i,k));
+        }
+        for (Int k=0; k<=nlev; ++k) {
+          REQUIRE (d_f90.flxprec(i,k)==d_cxx.flxprec(i,k));
+          REQUIRE (d_f90.flxsnow(i,k)==d_cxx.flxsnow(i,k));
+        }
+      }
+    }
+  }
+};
+
+} // namespace unit_test
+} // namespace zm
+} // namespace scream
+
+namespace {
+
+TEST_CASE("zm_conv_evap_property", "zm")
+{
+  using TestStruct = scream::zm::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestZmConvEvap;
+
+  TestStruct::run_property();
+}
+
+TEST_CASE("zm_conv_evap_bfb", "zm")
+{
+  using TestStruct = scream::zm::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestZmConvEvap;
+
+  TestStruct::run_bfb();
+}
+
+} // namespace
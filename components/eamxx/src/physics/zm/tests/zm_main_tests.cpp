@@ -0,0 +1,383 @@
+#include "catch2/catch.hpp"
+
+#include "zm_unit_tests_common.hpp"
+#include "zm_functions.hpp"
+#include "scream_zm_interface.hpp"
+#include "physics/share/physics_constants.hpp"
+#include "share/util/scream_setup_random_test.hpp"
+#include "share/scream_types.hpp"
+
+#include <cmath>
+
+namespace scream {
+namespace zm {
+namespace unit_test {
+
+template <typename D>
+struct UnitWrap::UnitTest<D>::TestZmMain {
+
+  // Tracers: the first one is not transported (like the water species in EAMxx)
+  static constexpr Int ntrac = 4;
+
+  struct MainData {
+    MainData (const Int ncol_in, const Int nlev_in)
+      : ncol(ncol_in), nlev(nlev_in)
+      , t(ncol,nlev), qh(ncol,nlev), pap(ncol,nlev), paph(ncol,nlev+1), dpp(ncol,nlev)
+      , zm(ncol,nlev), zi(ncol,nlev+1), geos(ncol,1), pblh(ncol,1), tpert(ncol,1)
+      , landfrac(ncol,1), cld(ncol,nlev)
+      , winds(ncol,nlev*2), tracers(ncol,nlev*ntrac)
+      , prec(ncol,1), snow(ncol,1), jctop(ncol,1), jcbot(ncol,1), cape(ncol,1)
+      , dsubcld(ncol,1), jt(ncol,1), maxg(ncol,1), rliq(ncol,1)
+      , qtnd(ncol,nlev), heat(ncol,nlev), cme(ncol,nlev), dlf(ncol,nlev), zdu(ncol,nlev)
+      , rprd(ncol,nlev), mu(ncol,nlev), md(ncol,nlev), du(ncol,nlev), eu(ncol,nlev)
+      , ed(ncol,nlev), dp(ncol,nlev), ql(ncol,nlev), tend_s(ncol,nlev), tend_q(ncol,nlev)
+      , ntprprd(ncol,nlev), ntsnprd(ncol,nlev)
+      , mcon(ncol,nlev+1), pflx(ncol,nlev+1), flxprec(ncol,nlev+1), flxsnow(ncol,nlev+1)
+      , pguall(ncol,nlev*2), pgdall(ncol,nlev*2), icwu(ncol,nlev*2)
+    {}
+
+    // Moist, conditionally unstable soundings, with a hydrostatic vertical grid
+    template <typename Engine>
+    void randomize (Engine& engine) {
+      using C = scream::physics::Constants<Real>;
+
+      std::uniform_real_distribution<Real> ts_dist(298,304), rh_dist(0.7,0.95);
+      const Real ptop = 200, ps = 100000;
+      for (Int i=0; i<ncol; ++i) {
+        const Real ts = ts_dist(engine);
+        for (Int k=0; k<=nlev; ++k) {
+          const Real eta = Real(k)/nlev;
+          paph(i,k) = ptop + (ps-ptop)*eta*eta;
+        }
+        for (Int k=0; k<nlev; ++k) {
+          dpp(i,k) = paph(i,k+1)-paph(i,k);
+          pap(i,k) = (paph(i,k)+paph(i,k+1))/2;
+
+          // Constant lapse rate up to the tropopause
+          t(i,k) = std::max(Real(ts*std::pow(pap(i,k)/ps,C::Rair*6.5e-3/C::gravit)),Real(200));
+
+          // Relative humidity decreasing with height
+          const Real es = 611.2*std::exp(17.67*(t(i,k)-C::Tmelt)/(t(i,k)-29.65));
+          const Real qs = C::ep_2*es/std::max(pap(i,k)-(1-C::ep_2)*es,es);
+          qh(i,k) = std::max(rh_dist(engine)*qs*pap(i,k)/ps,Real(1e-6));
+        }
+
+        zi(i,nlev) = 0;
+        for (Int k=nlev-1; k>=0; --k) {
+          const Real tv = t(i,k)*(1+C::ZVIR*qh(i,k));
+          zi(i,k) = zi(i,k+1) + C::Rair*tv/C::gravit*std::log(paph(i,k+1)/paph(i,k));
+          zm(i,k) = (zi(i,k)+zi(i,k+1))/2;
+        }
+      }
+
+      UnitTest::randomize(geos,engine,0,1000);
+      UnitTest::randomize(pblh,engine,300,1500);
+      UnitTest::randomize(landfrac,engine,0,1);
+      UnitTest::randomize(cld,engine,0,0.5);
+      UnitTest::randomize(winds,engine,-10,10);
+      UnitTest::randomize(tracers,engine,0,1e-3);
+    }
+
+    Int ncol, nlev;
+    Real dt = 1800;
+    bool doconvtran[ntrac] = {false, true, true, true};
+
+    // Inputs
+    F90Array t, qh, pap, paph, dpp, zm, zi, geos, pblh, tpert, landfrac, cld;
+    // Inputs/Outputs
+    F90Array winds, tracers;
+    // Outputs
+    F90Array prec, snow, jctop, jcbot, cape, dsubcld, jt, maxg, rliq;
+    F90Array qtnd, heat, cme, dlf, zdu, rprd, mu, md, du, eu, ed, dp, ql;
+    F90Array tend_s, tend_q, ntprprd, ntsnprd, mcon, pflx, flxprec, flxsnow;
+    F90Array pguall, pgdall, icwu;
+  };
+
+  static void run_f90 (MainData& d)
+  {
+    zm_main_f90(d.ncol, d.dt, d.t.data.data(), d.qh.data.data(), d.pap.data.data(),
+                d.paph.data.data(), d.dpp.data.data(), d.zm.data.data(), d.zi.data.data(),
+                d.geos.data.data(), d.pblh.data.data(), d.tpert.data.data(),
+                d.landfrac.data.data(), d.cld.data.data(), ntrac, d.doconvtran,
+                d.winds.data.data(), d.tracers.data.data(),
+                d.prec.data.data(), d.snow.data.data(), d.jctop.data.data(), d.jcbot.data.data(),
+                d.qtnd.data.data(), d.heat.data.data(), d.mcon.data.data(), d.cme.data.data(),
+                d.cape.data.data(), d.dlf.data.data(), d.pflx.data.data(), d.zdu.data.data(),
+                d.rprd.data.data(), d.mu.data.data(), d.md.data.data(), d.du.data.data(),
+                d.eu.data.data(), d.ed.data.data(), d.dp.data.data(), d.dsubcld.data.data(),
+                d.jt.data.data(), d.maxg.data.data(), d.ql.data.data(), d.rliq.data.data(),
+                d.tend_s.data.data(), d.tend_q.data.data(), d.ntprprd.data.data(),
+                d.ntsnprd.data.data(), d.flxprec.data.data(), d.flxsnow.data.data(),
+                d.pguall.data.data(), d.pgdall.data.data(), d.icwu.data.data());
+  }
+
+  static void run_cxx (MainData& d, const Int limcnv, const bool no_deep_pbl)
+  {
+    typename Functions::ZMInput       input;
+    typename Functions::ZMInputOutput input_output;
+    typename Functions::ZMOutput      output;
+
+    input.T_mid          = to_device(d.t);
+    input.qv             = to_device(d.qh);
+    input.p_mid          = to_device(d.pap);
+    input.p_int          = to_device(d.paph);
+    input.pseudo_density = to_device(d.dpp);
+    input.z_mid          = to_device(d.zm);
+    input.z_int          = to_device(d.zi);
+    input.phis           = to_device_1d(d.geos);
+    input.pblh           = to_device_1d(d.pblh);
+    input.tpert          = to_device_1d(d.tpert);
+    input.landfrac       = to_device_1d(d.landfrac);
+    input.cldfrac        = to_device(d.cld);
+
+    const auto winds   = to_device_3d(d.winds,2);
+    const auto tracers = to_device_3d(d.tracers,ntrac);
+    view_1d<bool> doconvtran("doconvtran",ntrac);
+    const auto doconvtran_h = Kokkos::create_mirror_view(doconvtran);
+    for (Int m=0; m<ntrac; ++m) {
+      doconvtran_h(m) = d.doconvtran[m];
+    }
+    Kokkos::deep_copy(doconvtran,doconvtran_h);
+    input_output.horiz_winds = winds;
+    input_output.tracers     = tracers;
+    input_output.doconvtran  = doconvtran;
+
+    const auto prec    = to_device_1d(d.prec);
+    const auto snow    = to_device_1d(d.snow);
+    const auto jctop   = to_device_1d(d.jctop);
+    const auto jcbot   = to_device_1d(d.jcbot);
+    const auto cape    = to_device_1d(d.cape);
+    const auto dsubcld = to_device_1d(d.dsubcld);
+    const auto jt      = to_device_1d(d.jt);
+    const auto maxg    = to_device_1d(d.maxg);
+    const auto rliq    = to_device_1d(d.rliq);
+    const auto qtnd    = to_device(d.qtnd);
+    const auto heat    = to_device(d.heat);
+    const auto cme     = to_device(d.cme);
+    const auto dlf     = to_device(d.dlf);
+    const auto zdu     = to_device(d.zdu);
+    const auto rprd    = to_device(d.rprd);
+    const auto mu      = to_device(d.mu);
+    const auto md      = to_device(d.md);
+    const auto du      = to_device(d.du);
+    const auto eu      = to_device(d.eu);
+    const auto ed      = to_device(d.ed);
+    const auto dp      = to_device(d.dp);
+    const auto ql      = to_device(d.ql);
+    const auto tend_s  = to_device(d.tend_s);
+    const auto tend_q  = to_device(d.tend_q);
+    const auto ntprprd = to_device(d.ntprprd);
+    const auto ntsnprd = to_device(d.ntsnprd);
+    const auto mcon    = to_device(d.mcon);
+    const auto pflx    = to_device(d.pflx);
+    const auto flxprec = to_device(d.flxprec);
+    const auto flxsnow = to_device(d.flxsnow);
+    const auto pguall  = to_device_3d(d.pguall,2);
+    const auto pgdall  = to_device_3d(d.pgdall,2);
+    const auto icwu    = to_device_3d(d.icwu,2);
+    output.prec    = prec;
+    output.snow    = snow;
+    output.jctop   = jctop;
+    output.jcbot   = jcbot;
+    output.cape    = cape;
+    output.dsubcld = dsubcld;
+    output.jt      = jt;
+    output.maxg    = maxg;
+    output.rliq    = rliq;
+    output.qtnd    = qtnd;
+    output.heat    = heat;
+    output.cme     = cme;
+    output.dlf     = dlf;
+    output.zdu     = zdu;
+    output.rprd    = rprd;
+    output.mu      = mu;
+    output.md      = md;
+    output.du      = du;
+    output.eu      = eu;
+    output.ed      = ed;
+    output.dp      = dp;
+    output.ql      = ql;
+    output.tend_s  = tend_s;
+    output.tend_q  = tend_q;
+    output.ntprprd = ntprprd;
+    output.ntsnprd = ntsnprd;
+    output.mcon    = mcon;
+    output.pflx    = pflx;
+    output.flxprec = flxprec;
+    output.flxsnow = flxsnow;
+    output.pguall  = pguall;
+    output.pgdall  = pgdall;
+    output.icwu    = icwu;
+
+    const Int nlevi_packs = ekat::npack<Spack>(d.nlev+1);
+    const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(d.ncol, nlevi_packs);
+    typename Functions::WorkspaceMgr workspace_mgr(nlevi_packs, 41, policy);
+
+    Functions::zm_main(d.ncol, d.nlev, limcnv, no_deep_pbl, d.dt, workspace_mgr,
+                       input, input_output, output);
+
+    from_device_3d(winds,d.winds);
+    from_device_3d(tracers,d.tracers);
+    from_device_1d(prec,d.prec);
+    from_device_1d(snow,d.snow);
+    from_device_1d(jctop,d.jctop);
+    from_device_1d(jcbot,d.jcbot);
+    from_device_1d(cape,d.cape);
+    from_device_1d(dsubcld,d.dsubcld);
+    from_device_1d(jt,d.jt);
+    from_device_1d(maxg,d.maxg);
+    from_device_1d(rliq,d.rliq);
+    from_device(qtnd,d.qtnd);
+    from_device(heat,d.heat);
+    from_device(cme,d.cme);
+    from_device(dlf,d.dlf);
+    from_device(zdu,d.zdu);
+    from_device(rprd,d.rprd);
+    from_device(mu,d.mu);
+    from_device(md,d.md);
+    from_device(du,d.du);
+    from_device(eu,d.eu);
+    from_device(ed,d.ed);
+    from_device(dp,d.dp);
+    from_device(ql,d.ql);
+    from_device(tend_s,d.tend_s);
+    from_device(tend_q,d.tend_q);
+    from_device(ntprprd,d.ntprprd);
+    from_device(ntsnprd,d.ntsnprd);
+    from_device(mcon,d.mcon);
+    from_device(pflx,d.pflx);
+    from_device(flxprec,d.flxprec);
+    from_device(flxsnow,d.flxsnow);
+    from_device_3d(pguall,d.pguall);
+    from_device_3d(pgdall,d.pgdall);
+    from_device_3d(icwu,d.icwu);
+  }
+
+  static void run_property()
+  {
+    auto engine = setup_random_test();
+
+    Int ncol, nlev;
+    zm_dims_f90(ncol,nlev);
+
+    MainData d(ncol,nlev);
+    d.randomize(engine);
+
+    // Dry out the first column, so that it cannot convect
+    for (Int k=0; k<nlev; ++k) {
+      d.qh(0,k) = 1e-8;
+    }
+
+    const MainData in = d;
+    run_cxx(d,1,false);
+
+    Int num_deep = 0;
+    for (Int i=0; i<ncol; ++i) {
+      REQUIRE (d.prec(i,0)>=0);
+      REQUIRE (d.snow(i,0)>=0);
+      REQUIRE (d.cape(i,0)>=0);
+
+      // Non-transported tracers are untouched
+      for (Int k=0; k<nlev; ++k) {
+        REQUIRE (d.tracers(i,k)==in.tracers(i,k));
+      }
+
+      const bool deep = d.maxg(i,0)>0;
+      if (not deep) {
+        REQUIRE (d.prec(i,0)==0);
+        REQUIRE (d.jt(i,0)==nlev-1);
+        for (Int n=0; n<2*nlev; ++n) {
+          REQUIRE (d.winds(i,n)==in.winds(i,n));
+          REQUIRE (d.icwu(i,n)==in.winds(i,n));
+          REQUIRE (d.pguall(i,n)==0);
+          REQUIRE (d.pgdall(i,n)==0);
+        }
+        for (Int n=0; n<ntrac*nlev; ++n) {
+          REQUIRE (d.tracers(i,n)==in.tracers(i,n));
+        }
+        for (Int k=0; k<nlev; ++k) {
+          REQUIRE (d.heat(i,k)==0);
+          REQUIRE (d.mu(i,k)==0);
+          REQUIRE (d.md(i,k)==0);
+        }
+        continue;
+      }
+
+      ++num_deep;
+      REQUIRE (d.jt(i,0)<=d.maxg(i,0));
+      REQUIRE (d.jctop(i,0)<=d.jcbot(i,0));
+      for (Int k=0; k<nlev; ++k) {
+        // Updraft mass flux is upward, downdraft mass flux is downward
+        REQUIRE (d.mu(i,k)>=0);
+        REQUIRE (d.md(i,k)<=0);
+        REQUIRE (d.ql(i,k)>=0);
+      }
+    }
+
+    // The dry column does not convect, while the moist soundings do
+    REQUIRE (d.maxg(0,0)==0);
+    REQUIRE (num_deep>0);
+  }
+
+  static void run_bfb()
+  {
+    auto engine = setup_random_test();
+
+    Int ncol, nlev;
+    zm_dims_f90(ncol,nlev);
+
+    const Int limcnv = 1;
+    const bool no_deep_pbl = false;
+    zm_init_f90(limcnv,no_deep_pbl,ncol,nlev);
+
+    MainData d_f90(ncol,nlev);
+    d_f90.randomize(engine);
+    MainData d_cxx = d_f90;
+
+    run_f90(d_f90);
+    run_cxx(d_cxx,limcnv,no_deep_pbl);
+
+    if (SCREAM_BFB_TESTING) {
+      const F90Array MainData::* fields[] = {
+        &MainData::winds, &MainData::tracers,
+        &MainData::prec, &MainData::snow, &MainData::jctop, &MainData::jcbot, &MainData::cape,
+        &MainData::dsubcld, &MainData::jt, &MainData::maxg, &MainData::rliq,
+        &MainData::qtnd, &MainData::heat, &MainData::cme, &MainData::dlf, &MainData::zdu,
+        &MainData::rprd, &MainData::mu, &MainData::md, &MainData::du, &MainData::eu,
+        &MainData::ed, &MainData::dp, &MainData::ql, &MainData::tend_s, &MainData::tend_q,
+        &MainData::ntprprd, &MainData::ntsnprd, &MainData::mcon, &MainData::pflx,
+        &MainData::flxprec, &MainData::flxsnow, &MainData::pguall, &MainData::pgdall,
+        &MainData::icwu
+      };
+      for (const auto f : fields) {
+        const auto& a_f90 = (d_f90.*f).data;
+        const auto& a_cxx = (d_cxx.*f).data;
+        for (size_t n=0; n<a_f90.size(); ++n) {
+          REQUIRE (a_f90[n]==a_cxx[n]);
+        }
+      }
+    }
+  }
+};
+
+} // namespace unit_test
+} // namespace zm
+} // namespace scream
+
+namespace {
+
+TEST_CASE("zm_main_property", "zm")
+{
+  using TestStruct = scream::zm::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestZmMain;
+
+  TestStruct::run_property();
+}
+
+TEST_CASE("zm_main_bfb", "zm")
+{
+  using TestStruct = scream::zm::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestZmMain;
+
+  TestStruct::run_bfb();
+}
+
+} // namespace
@@ -0,0 +1,151 @@
+#ifndef ZM_UNIT_TESTS_COMMON_HPP
+#define ZM_UNIT_TESTS_COMMON_HPP
+
+#include "zm_functions.hpp"
+#include "scream_zm_interface.hpp"
+#include "share/scream_types.hpp"
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+
+#include <random>
+#include <vector>
+
+namespace scream {
+namespace zm {
+namespace unit_test {
+
+/*
+ * Unit test infrastructure for zm unit tests.
+ *
+ * All unit test impls should be within an inner struct of UnitWrap::UnitTest for
+ * easy access to useful types.
+ *
+ * The Fortran routines work on (pcols,pver) arrays, with the dimensions of
+ * the zm_conv module, so the tests use ncol=pcols and nlev=pver, and move
+ * data between the Fortran-ordered host arrays and the C-ordered device views.
+ */
+
+struct UnitWrap {
+
+  template <typename D=DefaultDevice>
+  struct UnitTest : public KokkosTypes<D> {
+
+    using Device      = D;
+    using MemberType  = typename KokkosTypes<Device>::MemberType;
+    using TeamPolicy  = typename KokkosTypes<Device>::TeamPolicy;
+    using ExeSpace    = typename KokkosTypes<Device>::ExeSpace;
+
+    template <typename S>
+    using view_1d = typename KokkosTypes<Device>::template view_1d<S>;
+    template <typename S>
+    using view_2d = typename KokkosTypes<Device>::template view_2d<S>;
+    template <typename S>
+    using view_3d = typename KokkosTypes<Device>::template view_3d<S>;
+
+    using Functions = scream::zm::Functions<Real, Device>;
+    using Scalar    = typename Functions::Scalar;
+    using Spack     = typename Functions::Spack;
+
+    // Fortran-ordered (pcols,nk) host array. Arrays with a trailing
+    // dimension, like (pcols,pver,ncmp), are stored as (pcols,pver*ncmp).
+    struct F90Array {
+      F90Array (const Int ncol_in, const Int nk_in)
+        : ncol(ncol_in), nk(nk_in), data(ncol_in*nk_in,0) {}
+
+      Real& operator() (const Int i, const Int k) { return data[i+k*ncol]; }
+
+      Int ncol, nk;
+      std::vector<Real> data;
+    };
+
+    // Fill with random values in [lo,hi)
+    template <typename Engine>
+    static void randomize (F90Array& a, Engine& engine, const Real lo, const Real hi) {
+      std::uniform_real_distribution<Real> dist(lo,hi);
+      for (auto& v : a.data) {
+        v = dist(engine);
+      }
+    }
+
+    static view_2d<Real> to_device (F90Array& a) {
+      view_2d<Real> v("",a.ncol,a.nk);
+      auto h = Kokkos::create_mirror_view(v);
+      for (Int i=0; i<a.ncol; ++i) {
+        for (Int k=0; k<a.nk; ++k) {
+          h(i,k) = a(i,k);
+        }
+      }
+      Kokkos::deep_copy(v,h);
+      return v;
+    }
+
+    static void from_device (const view_2d<Real>& v, F90Array& a) {
+      auto h = Kokkos::create_mirror_view(v);
+      Kokkos::deep_copy(h,v);
+      for (Int i=0; i<a.ncol; ++i) {
+        for (Int k=0; k<a.nk; ++k) {
+          a(i,k) = h(i,k);
+        }
+      }
+    }
+
+    static view_1d<Real> to_device_1d (F90Array& a) {
+      view_1d<Real> v("",a.ncol);
+      auto h = Kokkos::create_mirror_view(v);
+      for (Int i=0; i<a.ncol; ++i) {
+        h(i) = a(i,0);
+      }
+      Kokkos::deep_copy(v,h);
+      return v;
+    }
+
+    static void from_device_1d (const view_1d<Real>& v, F90Array& a) {
+      auto h = Kokkos::create_mirror_view(v);
+      Kokkos::deep_copy(h,v);
+      for (Int i=0; i<a.ncol; ++i) {
+        a(i,0) = h(i);
+      }
+    }
+
+    // (pcols,nlev,ncmp) array <-> (ncol,ncmp,nlev) view
+    static view_3d<Real> to_device_3d (F90Array& a, const Int ncmp) {
+      const Int nlev = a.nk/ncmp;
+      view_3d<Real> v("",a.ncol,ncmp,nlev);
+      auto h = Kokkos::create_mirror_view(v);
+      for (Int i=0; i<a.ncol; ++i) {
+        for (Int m=0; m<ncmp; ++m) {
+          for (Int k=0; k<nlev; ++k) {
+            h(i,m,k) = a(i,k+m*nlev);
+          }
+        }
+      }
+      Kokkos::deep_copy(v,h);
+      return v;
+    }
+
+    static void from_device_3d (const view_3d<Real>& v, F90Array& a) {
+      auto h = Kokkos::create_mirror_view(v);
+      Kokkos::deep_copy(h,v);
+      const Int ncmp = h.extent(1);
+      const Int nlev = h.extent(2);
+      for (Int i=0; i<a.ncol; ++i) {
+        for (Int m=0; m<ncmp; ++m) {
+          for (Int k=0; k<nlev; ++k) {
+            a(i,k+m*nlev) = h(i,m,k);
+          }
+        }
+      }
+    }
+
+    // Put struct decls here
+    struct TestCldfrcFice;
+    struct TestZmConvEvap;
+    struct TestZmMain;
+  };
+
+};
+
+} // namespace unit_test
+} // namespace zm
+} // namespace scream
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef ZM_CONSTANTS_HPP
+#define ZM_CONSTANTS_HPP
+
+namespace scream {
+  namespace zm {
+
+    /*
+     * Tuning constants used by the ZM deep convection scheme.
+     * These mirror the hard-coded values set in zmconv_readnl (zm_conv.F90),
+     * and must be kept in sync with them for BFB comparisons.
+     */
+
+template <typename Scalar>
+struct Constants
+  {
+    static constexpr Scalar ke          = 1.5e-6;   // Evaporation efficiency of convective precip
+    static constexpr Scalar c0_lnd      = 0.007;    // Autoconversion coefficient over land
+    static constexpr Scalar c0_ocn      = 0.007;    // Autoconversion coefficient over ocean
+    static constexpr Scalar tau         = 3600;     // Convective time scale [s]
+    static constexpr Scalar capelmt     = 70;       // Threshold value of cape for deep convection [J/kg]
+    static constexpr Scalar tiedke_add  = 0.8;      // Temperature perturbation of the parcel at launch [K]
+    static constexpr Scalar dmpdz       = -0.7e-3;  // Parcel fractional mass entrainment rate [1/m]
+    static constexpr Scalar tp_fac      = 0;        // Scaling of the PBL temperature perturbation
+    static constexpr Scalar alfa        = 0.1;      // Maximum downdraft mass flux fraction
+    static constexpr int    num_cin     = 1;        // Number of negative buoyancy regions allowed below the cloud top
+    static constexpr int    mx_bot_lyr_adj = 2;     // Bottom layer adjustment for the launch level search
+    static constexpr Scalar fice_tmax_offset  = 10; // tmelt - tmax_fice [K]
+    static constexpr Scalar fice_trange       = 30; // tmax_fice - tmin_fice [K]
+    static constexpr Scalar fsnow_trange      = 5;  // tmax_fsnow - tmin_fsnow [K]
+
+    // ZM has its own thermodynamic constants, which slightly differ from the
+    // ones in physics::Constants (e.g., Rair and RH2O).
+    static constexpr Scalar rair        = 287.042311365049; // Gas constant for dry air [J/K/kg]
+    static constexpr Scalar rh2o        = 461.504639820160; // Gas constant for water vapor [J/K/kg]
+    static constexpr Scalar cpwv        = 1810;             // Specific heat of water vapor [J/K/kg]
+  };
+
+  } // namespace zm
+} // namespace scream
+
+#endif
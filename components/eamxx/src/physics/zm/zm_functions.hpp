@@ -0,0 +1,543 @@
+#ifndef ZM_FUNCTIONS_HPP
+#define ZM_FUNCTIONS_HPP
+
+#include "physics/share/physics_constants.hpp"
+#include "physics/zm/zm_constants.hpp"
+
+#include "share/scream_types.hpp"
+
+#include "ekat/ekat_pack_kokkos.hpp"
+#include "ekat/ekat_workspace.hpp"
+
+namespace scream {
+namespace zm {
+
+/*
+ * Functions is a stateless struct used to encapsulate a
+ * number of functions for ZM. We use the ETI pattern for
+ * these functions.
+ *
+ * The kernels in here are column kernels: each Kokkos team
+ * handles one column. The cloud model is serial in the vertical,
+ * so the kernels work on scalar (not packed) column views, and
+ * level indices are 0-based (Fortran level k is level k-1 here).
+ */
+
+template <typename ScalarT, typename DeviceT>
+struct Functions
+{
+  //
+  // ------- Types --------
+  //
+
+  using Scalar = ScalarT;
+  using Device = DeviceT;
+
+  template <typename S>
+  using BigPack = ekat::Pack<S,SCREAM_PACK_SIZE>;
+  template <typename S>
+  using SmallPack = ekat::Pack<S,SCREAM_SMALL_PACK_SIZE>;
+
+  using IntSmallPack = SmallPack<Int>;
+  using Pack = BigPack<Scalar>;
+  using Spack = SmallPack<Scalar>;
+
+  using Mask  = ekat::Mask<Pack::n>;
+  using Smask = ekat::Mask<Spack::n>;
+
+  using KT = ekat::KokkosTypes<Device>;
+
+  using C  = physics::Constants<Scalar>;
+  using ZC = zm::Constants<Scalar>;
+
+  template <typename S>
+  using view_1d = typename KT::template view_1d<S>;
+  template <typename S>
+  using view_2d = typename KT::template view_2d<S>;
+
+  template <typename S>
+  using view_3d = typename KT::template view_3d<S>;
+
+  template <typename S>
+  using uview_1d = typename ekat::template Unmanaged<view_1d<S> >;
+  template <typename S>
+  using uview_2d = typename ekat::template Unmanaged<view_2d<S> >;
+
+  using MemberType = typename KT::MemberType;
+
+  using WorkspaceMgr = typename ekat::WorkspaceManager<Spack,  Device>;
+  using Workspace    = typename WorkspaceMgr::Workspace;
+
+  // This struct stores input views for zm_main.
+  struct ZMInput {
+    ZMInput() = default;
+
+    // Temperature [K]
+    view_2d<const Scalar> T_mid;
+    // Water vapor [kg/kg]
+    view_2d<const Scalar> qv;
+    // Midpoint pressure [Pa]
+    view_2d<const Scalar> p_mid;
+    // Interface pressure [Pa]
+    view_2d<const Scalar> p_int;
+    // Layer thickness [Pa]
+    view_2d<const Scalar> pseudo_density;
+    // Midpoint height above the surface [m]
+    view_2d<const Scalar> z_mid;
+    // Interface height above the surface [m]
+    view_2d<const Scalar> z_int;
+    // Surface geopotential [m2/s2]
+    view_1d<const Scalar> phis;
+    // PBL height [m]
+    view_1d<const Scalar> pblh;
+    // Thermal temperature excess [K]
+    view_1d<const Scalar> tpert;
+    // Land fraction [-]
+    view_1d<const Scalar> landfrac;
+    // Cloud fraction [-]
+    view_2d<const Scalar> cldfrac;
+  };
+
+  // This struct stores input/output views for zm_main.
+  struct ZMInputOutput {
+    ZMInputOutput() = default;
+
+    // Horizontal winds, with layout (ncol,2,nlev) [m/s]
+    view_3d<Scalar> horiz_winds;
+    // Tracers, with layout (ncol,ntrac,nlev) [kg/kg]
+    view_3d<Scalar> tracers;
+    // Whether each tracer is transported by convection
+    view_1d<const bool> doconvtran;
+  };
+
+  // This struct stores output only views for zm_main.
+  // Level indices (jctop, jcbot, jt, maxg) are 0-based.
+  struct ZMOutput {
+    ZMOutput() = default;
+
+    // Convective precipitation rate [m/s]
+    view_1d<Scalar> prec;
+    // Convective snowfall rate [m/s]
+    view_1d<Scalar> snow;
+    // Cloud top level index
+    view_1d<Scalar> jctop;
+    // Cloud base level index
+    view_1d<Scalar> jcbot;
+    // Water vapor tendency of the convective core [kg/kg/s]
+    view_2d<Scalar> qtnd;
+    // Heating rate of the convective core, including the kinetic energy
+    // dissipation of the momentum transport [J/kg/s]
+    view_2d<Scalar> heat;
+    // Convective mass flux at interfaces [mb/s]
+    view_2d<Scalar> mcon;
+    // Net condensation rate [kg/kg/s]
+    view_2d<Scalar> cme;
+    // Convective available potential energy [J/kg]
+    view_1d<Scalar> cape;
+    // Detrainment of cloud water [kg/kg/s]
+    view_2d<Scalar> dlf;
+    // Precip flux at interfaces [kg/m2/s]
+    view_2d<Scalar> pflx;
+    // Detrainment rate [1/s]
+    view_2d<Scalar> zdu;
+    // Rain production rate [kg/kg/s]
+    view_2d<Scalar> rprd;
+    // Updraft mass flux [mb/s]
+    view_2d<Scalar> mu;
+    // Downdraft mass flux [mb/s]
+    view_2d<Scalar> md;
+    // Updraft detrainment [1/s]
+    view_2d<Scalar> du;
+    // Updraft entrainment [1/s]
+    view_2d<Scalar> eu;
+    // Downdraft entrainment [1/s]
+    view_2d<Scalar> ed;
+    // Layer thickness [mb]
+    view_2d<Scalar> dp;
+    // Thickness between lcl and the maxi level [mb]
+    view_1d<Scalar> dsubcld;
+    // Cloud top level index of the convective core
+    view_1d<Scalar> jt;
+    // Parcel launch level index
+    view_1d<Scalar> maxg;
+    // Cloud liquid water [kg/kg]
+    view_2d<Scalar> ql;
+    // Reserved liquid (not yet in cldliq) for energy integrals [m/s]
+    view_1d<Scalar> rliq;
+    // Heating rate due to evaporation of precip [J/kg/s]
+    view_2d<Scalar> tend_s;
+    // Water vapor tendency due to evaporation of precip [kg/kg/s]
+    view_2d<Scalar> tend_q;
+    // Net precip production in layer [kg/kg/s]
+    view_2d<Scalar> ntprprd;
+    // Net snow production in layer [kg/kg/s]
+    view_2d<Scalar> ntsnprd;
+    // Convective-scale flux of precip at interfaces [kg/m2/s]
+    view_2d<Scalar> flxprec;
+    // Convective-scale flux of snow at interfaces [kg/m2/s]
+    view_2d<Scalar> flxsnow;
+    // Apparent force from the updraft pressure gradient, with layout (ncol,2,nlev) [m/s/mb/s]
+    view_3d<Scalar> pguall;
+    // Apparent force from the downdraft pressure gradient, with layout (ncol,2,nlev) [m/s/mb/s]
+    view_3d<Scalar> pgdall;
+    // In-cloud updraft winds, with layout (ncol,2,nlev) [m/s]
+    view_3d<Scalar> icwu;
+  };
+
+  //
+  // --------- Functions ---------
+  //
+
+  // Saturation vapor pressure w.r.t. liquid [Pa], as computed in zm_conv.F90
+  // (Flatau et al. 1992 polynomial).
+  KOKKOS_FUNCTION
+  static Scalar svp(const Scalar& t);
+
+  // Saturation specific humidity w.r.t. liquid, as computed by qsat in zm_conv.F90.
+  KOKKOS_FUNCTION
+  static Scalar qsat(const Scalar& t, const Scalar& p);
+
+  // Same as qsat, but with pressure and saturation vapor pressure in hPa.
+  KOKKOS_FUNCTION
+  static void qsat_hpa(const Scalar& t, const Scalar& p, Scalar& es, Scalar& qs);
+
+  // Entropy of moist air [J/kg/K] (Raymond and Blyth 1992), and its inverse,
+  // giving temperature and saturation specific humidity from the entropy.
+  KOKKOS_FUNCTION
+  static Scalar entropy(const Scalar& tk, const Scalar& p, const Scalar& qtot);
+
+  KOKKOS_FUNCTION
+  static void ientropy(
+    const Scalar& s,
+    const Scalar& p,
+    const Scalar& qt,
+    const Scalar& tfg,
+    Scalar&       t,
+    Scalar&       qst);
+
+  // Entraining parcel temperature and saturation specific humidity, from the
+  // launch level klaunch up. This and the routines below, up to q1q2_pjr,
+  // work on a single column and are meant to be called by a single thread.
+  KOKKOS_FUNCTION
+  static void parcel_dilute(
+    const Int&                    nlev,
+    const Int&                    msg,
+    const Int&                    klaunch,
+    const uview_1d<const Scalar>& p,
+    const uview_1d<const Scalar>& t,
+    const uview_1d<const Scalar>& q,
+    const Scalar&                 tpert,
+    const uview_1d<Scalar>&       tp,
+    const uview_1d<Scalar>&       tpv,
+    const uview_1d<Scalar>&       qstp,
+    Scalar&                       pl,
+    Scalar&                       tl,
+    Int&                          lcl,
+    const uview_1d<Scalar>&       tmix,
+    const uview_1d<Scalar>&       qtmix,
+    const uview_1d<Scalar>&       qsmix,
+    const uview_1d<Scalar>&       smix,
+    const uview_1d<Scalar>&       xsh2o,
+    const uview_1d<Scalar>&       ds_xsh2o,
+    const uview_1d<Scalar>&       ds_freeze);
+
+  // CAPE of the entraining parcel, with launch level (mx), lifting
+  // condensation level (lcl) and equilibrium level (lel).
+  KOKKOS_FUNCTION
+  static void buoyan_dilute(
+    const Int&                    nlev,
+    const Int&                    msg,
+    const uview_1d<const Scalar>& q,
+    const uview_1d<const Scalar>& t,
+    const uview_1d<const Scalar>& p,
+    const uview_1d<const Scalar>& z,
+    const uview_1d<const Scalar>& pf,
+    const Int&                    pblt,
+    const Scalar&                 tpert,
+    const uview_1d<Scalar>&       tp,
+    const uview_1d<Scalar>&       qstp,
+    Scalar&                       tl,
+    Scalar&                       cape,
+    Int&                          lcl,
+    Int&                          lel,
+    Int&                          mx,
+    const uview_1d<Scalar>&       tv,
+    const uview_1d<Scalar>&       tpv,
+    const uview_1d<Scalar>&       buoy,
+    const uview_1d<Scalar>&       tmix,
+    const uview_1d<Scalar>&       qtmix,
+    const uview_1d<Scalar>&       qsmix,
+    const uview_1d<Scalar>&       smix,
+    const uview_1d<Scalar>&       xsh2o,
+    const uview_1d<Scalar>&       ds_xsh2o,
+    const uview_1d<Scalar>&       ds_freeze);
+
+  // Updraft and downdraft properties, normalized by the cloud base mass flux.
+  // pflx has nlev+1 entries.
+  KOKKOS_FUNCTION
+  static void cldprp(
+    const Int&                    nlev,
+    const Int&                    msg,
+    const uview_1d<const Scalar>& q,
+    const uview_1d<const Scalar>& t,
+    const uview_1d<const Scalar>& p,
+    const uview_1d<const Scalar>& z,
+    const uview_1d<const Scalar>& s,
+    const uview_1d<const Scalar>& zf,
+    const uview_1d<const Scalar>& shat,
+    const Scalar&                 landfrac,
+    const Scalar&                 tpert,
+    const Int&                    mx,
+    const Int&                    lel,
+    const uview_1d<Scalar>&       mu,
+    const uview_1d<Scalar>&       eu,
+    const uview_1d<Scalar>&       du,
+    const uview_1d<Scalar>&       md,
+    const uview_1d<Scalar>&       ed,
+    const uview_1d<Scalar>&       sd,
+    const uview_1d<Scalar>&       qd,
+    const uview_1d<Scalar>&       mc,
+    const uview_1d<Scalar>&       qu,
+    const uview_1d<Scalar>&       su,
+    const uview_1d<Scalar>&       qst,
+    const uview_1d<Scalar>&       hmn,
+    const uview_1d<Scalar>&       hsat,
+    const uview_1d<Scalar>&       ql,
+    const uview_1d<Scalar>&       cmeg,
+    Int&                          jt,
+    Int&                          jlcl,
+    Int&                          j0,
+    Int&                          jd,
+    const uview_1d<Scalar>&       pflx,
+    const uview_1d<Scalar>&       evp,
+    const uview_1d<Scalar>&       cu,
+    const uview_1d<Scalar>&       rprd,
+    const uview_1d<Scalar>&       gamma,
+    const uview_1d<Scalar>&       hu,
+    const uview_1d<Scalar>&       hd,
+    const uview_1d<Scalar>&       eps,
+    const uview_1d<Scalar>&       f,
+    const uview_1d<Scalar>&       k1,
+    const uview_1d<Scalar>&       i2,
+    const uview_1d<Scalar>&       i3,
+    const uview_1d<Scalar>&       i4,
+    const uview_1d<Scalar>&       qsthat,
+    const uview_1d<Scalar>&       hsthat,
+    const uview_1d<Scalar>&       gamhat,
+    const uview_1d<Scalar>&       qds);
+
+  // Cloud base mass flux mb, from the CAPE consumption rate.
+  KOKKOS_FUNCTION
+  static void closure(
+    const Int&                    nlev,
+    const Int&                    msg,
+    const uview_1d<const Scalar>& q,
+    const uview_1d<const Scalar>& t,
+    const uview_1d<const Scalar>& p,
+    const uview_1d<const Scalar>& s,
+    const uview_1d<const Scalar>& tp,
+    const uview_1d<const Scalar>& qu,
+    const uview_1d<const Scalar>& su,
+    const uview_1d<const Scalar>& mc,
+    const uview_1d<const Scalar>& du,
+    const uview_1d<const Scalar>& mu,
+    const uview_1d<const Scalar>& md,
+    const uview_1d<const Scalar>& qd,
+    const uview_1d<const Scalar>& sd,
+    const uview_1d<const Scalar>& qhat,
+    const uview_1d<const Scalar>& shat,
+    const uview_1d<const Scalar>& dp,
+    const uview_1d<const Scalar>& qstp,
+    const uview_1d<const Scalar>& zf,
+    const uview_1d<const Scalar>& ql,
+    const Scalar&                 dsubcld,
+    const Scalar&                 cape,
+    const Scalar&                 tl,
+    const Int&                    lcl,
+    const Int&                    lel,
+    const Int&                    jt,
+    const Int&                    mx,
+    Scalar&                       mb);
+
+  // Temperature and moisture tendencies due to convection.
+  KOKKOS_FUNCTION
+  static void q1q2_pjr(
+    const Int&                    nlev,
+    const Int&                    msg,
+    const uview_1d<const Scalar>& qu,
+    const uview_1d<const Scalar>& su,
+    const uview_1d<const Scalar>& du,
+    const uview_1d<const Scalar>& qhat,
+    const uview_1d<const Scalar>& shat,
+    const uview_1d<const Scalar>& dp,
+    const uview_1d<const Scalar>& mu,
+    const uview_1d<const Scalar>& md,
+    const uview_1d<const Scalar>& sd,
+    const uview_1d<const Scalar>& qd,
+    const uview_1d<const Scalar>& ql,
+    const Scalar&                 dsubcld,
+    const Int&                    jt,
+    const Int&                    mx,
+    const uview_1d<const Scalar>& evp,
+    const uview_1d<const Scalar>& cu,
+    const uview_1d<Scalar>&       dqdt,
+    const uview_1d<Scalar>&       dsdt,
+    const uview_1d<Scalar>&       dl);
+
+  // Fraction of cloud water (fice) and of convective precip (fsnow) in ice phase.
+  // Both depend on temperature only.
+  KOKKOS_FUNCTION
+  static void cldfrc_fice(
+    const MemberType&             team,
+    const Int&                    nlev,
+    const uview_1d<const Scalar>& t,
+    const uview_1d<Scalar>&       fice,
+    const uview_1d<Scalar>&       fsnow);
+
+  // Evaporation of convective precip into the environment, using a
+  // Sundqvist-type algorithm, plus the latent heat of fusion for snow
+  // formation and melt (not handled in the ZM core).
+  KOKKOS_FUNCTION
+  static void zm_conv_evap(
+    const MemberType&             team,
+    const Int&                    nlev,
+    const Scalar&                 deltat,
+    const uview_1d<const Scalar>& t,
+    const uview_1d<const Scalar>& pmid,
+    const uview_1d<const Scalar>& pdel,
+    const uview_1d<const Scalar>& q,
+    const uview_1d<const Scalar>& prdprec,
+    const uview_1d<const Scalar>& cldfrc,
+    const Workspace&              workspace,
+    Scalar&                       prec,
+    Scalar&                       snow,
+    const uview_1d<Scalar>&       tend_s,
+    const uview_1d<Scalar>&       tend_q,
+    const uview_1d<Scalar>&       ntprprd,
+    const uview_1d<Scalar>&       ntsnprd,
+    const uview_1d<Scalar>&       flxprec,
+    const uview_1d<Scalar>&       flxsnow);
+
+  // Convective core of ZM: CAPE, cloud model and closure. Returns true if the
+  // column undergoes deep convection. mcon and pflx have nlev+1 entries.
+  KOKKOS_FUNCTION
+  static bool zm_convr(
+    const MemberType&             team,
+    const Int&                    nlev,
+    const Int&                    msg,
+    const bool&                   no_deep_pbl,
+    const Scalar&                 delt,
+    const uview_1d<const Scalar>& t,
+    const uview_1d<const Scalar>& qh,
+    const uview_1d<const Scalar>& pap,
+    const uview_1d<const Scalar>& paph,
+    const uview_1d<const Scalar>& dpp,
+    const uview_1d<const Scalar>& zm,
+    const uview_1d<const Scalar>& zi,
+    const Scalar&                 geos,
+    const Scalar&                 pblh,
+    const Scalar&                 tpert,
+    const Scalar&                 landfrac,
+    const Workspace&              workspace,
+    Scalar&                       prec,
+    Scalar&                       jctop,
+    Scalar&                       jcbot,
+    const uview_1d<Scalar>&       qtnd,
+    const uview_1d<Scalar>&       heat,
+    const uview_1d<Scalar>&       mcon,
+    const uview_1d<Scalar>&       cme,
+    Scalar&                       cape,
+    const uview_1d<Scalar>&       dlf,
+    const uview_1d<Scalar>&       pflx,
+    const uview_1d<Scalar>&       zdu,
+    const uview_1d<Scalar>&       rprd,
+    const uview_1d<Scalar>&       mu,
+    const uview_1d<Scalar>&       md,
+    const uview_1d<Scalar>&       du,
+    const uview_1d<Scalar>&       eu,
+    const uview_1d<Scalar>&       ed,
+    const uview_1d<Scalar>&       dp,
+    Scalar&                       dsubcld,
+    Scalar&                       jt,
+    Scalar&                       maxg,
+    const uview_1d<Scalar>&       ql,
+    Scalar&                       rliq);
+
+  // Convective transport of momentum. The winds (2,nlev) are updated in place.
+  KOKKOS_FUNCTION
+  static void momtran(
+    const MemberType&             team,
+    const Int&                    nlev,
+    const Int&                    jt,
+    const Int&                    mx,
+    const uview_1d<const Scalar>& mu,
+    const uview_1d<const Scalar>& md,
+    const uview_1d<const Scalar>& du,
+    const uview_1d<const Scalar>& eu,
+    const uview_1d<const Scalar>& ed,
+    const uview_1d<const Scalar>& dp,
+    const Scalar&                 dt,
+    const Workspace&              workspace,
+    const uview_2d<Scalar>&       wind,
+    const uview_2d<Scalar>&       pguall,
+    const uview_2d<Scalar>&       pgdall,
+    const uview_2d<Scalar>&       icwu,
+    const uview_1d<Scalar>&       seten);
+
+  // Convective transport of tracers. The tracers (ntrac,nlev) are updated in place.
+  KOKKOS_FUNCTION
+  static void convtran(
+    const MemberType&             team,
+    const Int&                    nlev,
+    const Int&                    jt,
+    const Int&                    mx,
+    const uview_1d<const Scalar>& mu,
+    const uview_1d<const Scalar>& md,
+    const uview_1d<const Scalar>& du,
+    const uview_1d<const Scalar>& eu,
+    const uview_1d<const Scalar>& ed,
+    const uview_1d<const Scalar>& dp,
+    const Scalar&                 dt,
+    const view_1d<const bool>&    doconvtran,
+    const Workspace&              workspace,
+    const uview_2d<Scalar>&       q);
+
+  // Main ZM column driver. Launches one team per column and returns
+  // the elapsed time in microseconds. The workspace manager must provide
+  // 41 slots of (at least) nlev+1 entries per team.
+  static Int zm_main(
+    const Int&           ncol,
+    const Int&           nlev,
+    const Int&           limcnv,
+    const bool&          no_deep_pbl,
+    const Scalar&        dtime,
+    WorkspaceMgr&        workspace_mgr,
+    const ZMInput&       zm_input,
+    const ZMInputOutput& zm_input_output,
+    const ZMOutput&      zm_output);
+
+}; // struct Functions
+
+} // namespace zm
+} // namespace scream
+
+// If a GPU build, without relocatable device code enabled, make all code available
+// to the translation unit; otherwise, ETI is used.
+#if defined(EAMXX_ENABLE_GPU) && !defined(KOKKOS_ENABLE_CUDA_RELOCATABLE_DEVICE_CODE)  \
+                                && !defined(KOKKOS_ENABLE_HIP_RELOCATABLE_DEVICE_CODE)
+
+# include "zm_qsat_impl.hpp"
+# include "zm_entropy_impl.hpp"
+# include "zm_buoyan_dilute_impl.hpp"
+# include "zm_cldprp_impl.hpp"
+# include "zm_closure_impl.hpp"
+# include "zm_q1q2_pjr_impl.hpp"
+# include "zm_cldfrc_fice_impl.hpp"
+# include "zm_conv_evap_impl.hpp"
+# include "zm_convr_impl.hpp"
+# include "zm_momtran_impl.hpp"
+# include "zm_convtran_impl.hpp"
+# include "zm_main_impl.hpp"
+#endif // GPU || !KOKKOS_ENABLE_*_RELOCATABLE_DEVICE_CODE
+
+#endif // ZM_FUNCTIONS_HPP
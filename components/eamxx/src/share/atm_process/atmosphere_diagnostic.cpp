@@ -19,6 +19,11 @@ Field AtmosphereDiagnostic::get_diagnostic () const {
 }
 
 void AtmosphereDiagnostic::compute_diagnostic (const double dt) {
+  copy_in_precision_copies ();
+  compute_output (dt);
+}
+
+void AtmosphereDiagnostic::compute_output (const double dt) {
   // Some diagnostics need the timestep, store in case.
   m_dt = dt;
 
@@ -45,7 +50,8 @@ void AtmosphereDiagnostic::compute_diagnostic (const double dt) {
 
 
 void AtmosphereDiagnostic::run_impl (const double dt) {
-  compute_diagnostic(dt);
+  // AtmosphereProcess::run already copied in the precision copies
+  compute_output(dt);
 }
 void AtmosphereDiagnostic::set_computed_field (const Field& /* f */) {
   EKAT_ERROR_MSG("Error! Diagnostics are not allowed to compute fields. See " + name() + ".\n");
@@ -54,11 +54,11 @@ public:
   void set_computed_field (const Field& f) final;
   void set_computed_group (const FieldGroup& group) final;
 
+  // Compute the diagnostic output. Precision copies (if any) are synced with
+  // the stored fields first, so the output always uses up to date inputs.
   void compute_diagnostic (const double dt = 0);
 protected:
 
-  virtual void compute_diagnostic_impl () = 0;
-
   // By default, diagnostic don't do any initialization/finalization stuff.
   // Derived classes can override, of course
   void initialize_impl (const RunType /*run_type*/) { /* Nothing to do */ }
@@ -70,6 +70,17 @@ protected:
 
   // Diagnostics are meant to return a field
   Field m_diagnostic_output;
+
+private:
+
+  // Compute the output, and update its time stamp. Callers must have copied
+  // in the precision copies.
+  void compute_output (const double dt);
+
+  // Derived classes compute the output here. Overrides can have any access, but
+  // the method is private here, so that it can only be reached via compute_diagnostic
+  // or run, which both copy in the precision copies.
+  virtual void compute_diagnostic_impl () = 0;
 };
 
 // A short name for the factory for atmosphere diagnostics
@@ -8,6 +8,7 @@
 #include <set>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 namespace scream
 {
@@ -67,9 +68,19 @@ void AtmosphereProcess::initialize (const TimeStamp& t0, const RunType run_type)
   if (this->type()!=AtmosphereProcessType::Group) {
     start_timer (m_timer_prefix + this->name() + "::init");
   }
+  // Copies not placed in the ATMBufferManager memory get their own allocation
+  for (auto& it : m_precision_copies) {
+    for (auto& it2 : it.second) {
+      if (not it2.second.copy.is_allocated()) {
+        it2.second.copy.allocate_view();
+      }
+    }
+  }
   set_fields_and_groups_pointers();
   m_time_stamp = t0;
+  copy_in_precision_copies();
   initialize_impl(run_type);
+  copy_out_precision_copies();
   if (this->type()!=AtmosphereProcessType::Group) {
     stop_timer (m_timer_prefix + this->name() + "::init");
   }
@@ -77,6 +88,12 @@ void AtmosphereProcess::initialize (const TimeStamp& t0, const RunType run_type)
 
 void AtmosphereProcess::run (const double dt) {
   start_timer (m_timer_prefix + this->name() + "::run");
+
+  // Fields requested with a different precision than stored are converted here.
+  // Note: copy in before the pre-condition checks, since checks added by this
+  //       process on its own fields act on the copies.
+  copy_in_precision_copies();
+
   if (m_params.get("enable_precondition_checks", true)) {
     // Run 'pre-condition' property checks stored in this AP
     run_precondition_checks();
@@ -101,6 +118,10 @@ void AtmosphereProcess::run (const double dt) {
     }
   }
 
+  // Note: copy out before the post-condition checks, since checks added by the
+  //       AD (e.g., NaN checks) act on the stored fields.
+  copy_out_precision_copies();
+
   if (m_params.get("enable_postcondition_checks", true)) {
     // Run 'post-condition' property checks stored in this AP
     run_postcondition_checks();
@@ -135,6 +156,13 @@ void AtmosphereProcess::set_required_field (const Field& f) {
   if (this->type()!=AtmosphereProcessType::Group) {
     // Add myself as customer to the field
     add_me_as_customer(f);
+
+    auto pc = get_precision_copy(f);
+    if (pc!=nullptr) {
+      m_precision_copies[f.name()][f.get_header().get_identifier().get_grid_name()].in = true;
+      set_required_field_impl (pc->get_const());
+      return;
+    }
   }
 
   set_required_field_impl (f);
@@ -157,11 +185,131 @@ void AtmosphereProcess::set_computed_field (const Field& f) {
   if (this->type()!=AtmosphereProcessType::Group) {
     // Add myself as provider for the field
     add_me_as_provider(f);
+
+    auto pc = get_precision_copy(f);
+    if (pc!=nullptr) {
+      auto& info = m_precision_copies[f.name()][f.get_header().get_identifier().get_grid_name()];
+      info.stored = f;
+      info.out = true;
+      set_computed_field_impl (*pc);
+      return;
+    }
   }
 
   set_computed_field_impl (f);
 }
 
+Field* AtmosphereProcess::get_precision_copy (const Field& f) {
+  const auto& fid = f.get_header().get_identifier();
+  const auto& name = fid.name();
+  const auto& grid_name = fid.get_grid_name();
+
+  // Find the data type we asked for, and all the pack sizes we need
+  std::vector<int> pack_sizes;
+  std::set<DataType> requested;
+  for (const auto& reqs : {&m_required_field_requests,&m_computed_field_requests}) {
+    for (const auto& req : *reqs) {
+      if (req.fid.name()==name && req.fid.get_grid_name()==grid_name) {
+        requested.insert(req.fid.data_type());
+        pack_sizes.push_back(req.pack_size);
+      }
+    }
+  }
+  EKAT_REQUIRE_MSG (requested.size()==1,
+      "Error! Field requested with different data types within the same atm process.\n"
+      "   field name: " + name + "\n"
+      "   grid name: " + grid_name + "\n"
+      "   atm process: " + this->name() + "\n");
+  const auto data_type = *requested.begin();
+  if (data_type==fid.data_type()) {
+    return nullptr;
+  }
+
+  auto& pc = m_precision_copies[name][grid_name];
+  if (not pc.copy.get_header_ptr()) {
+    pc.stored = f;
+    pc.copy = Field(FieldIdentifier(name,fid.get_layout(),fid.get_units(),grid_name,data_type));
+    auto& ap = pc.copy.get_header().get_alloc_properties();
+    for (auto ps : pack_sizes) {
+      ap.request_allocation(ps);
+    }
+    // Commit now, so that the size is known. The memory is set in
+    // init_precision_copies, or, failing that, in initialize.
+    ap.commit(pc.copy.get_header().get_identifier().get_layout_ptr());
+  }
+  return &pc.copy;
+}
+
+namespace {
+// Each copy starts at a 64 bytes boundary within the buffer
+size_t precision_copy_bytes (const Field& f) {
+  const size_t size = f.get_header().get_alloc_properties().get_alloc_size();
+  return (size + 63) / 64 * 64;
+}
+}
+
+size_t AtmosphereProcess::requested_precision_copies_bytes () const {
+  size_t bytes = 0;
+  for (const auto& it : m_precision_copies) {
+    for (const auto& it2 : it.second) {
+      bytes += precision_copy_bytes(it2.second.copy);
+    }
+  }
+  return bytes;
+}
+
+void AtmosphereProcess::
+init_precision_copies (const ATMBufferManager& buffer_manager, const size_t offset_bytes) {
+  EKAT_REQUIRE_MSG(buffer_manager.allocated_bytes() >= offset_bytes+requested_precision_copies_bytes(),
+      "Error! Buffers size not sufficient for the precision copies of " + this->name() + ".\n");
+
+  char* mem = reinterpret_cast<char*>(buffer_manager.get_memory()) + offset_bytes;
+  for (auto& it : m_precision_copies) {
+    for (auto& it2 : it.second) {
+      auto& copy = it2.second.copy;
+      copy.allocate_view(mem);
+      mem += precision_copy_bytes(copy);
+    }
+  }
+}
+
+void AtmosphereProcess::copy_in_precision_copies () {
+  for (auto& it : m_precision_copies) {
+    for (auto& it2 : it.second) {
+      auto& pc = it2.second;
+      // Copies do not retain data between calls, so computed fields are
+      // copied in as well, in case the process reads them.
+      if (pc.in || pc.out) {
+        pc.copy.deep_copy(pc.stored);
+        const auto& ts = pc.stored.get_header().get_tracking().get_time_stamp();
+        if (ts.is_valid()) {
+          pc.copy.get_header().get_tracking().update_time_stamp(ts);
+        }
+      }
+    }
+  }
+}
+
+bool AtmosphereProcess::has_precision_copies () const {
+  for (const auto& it : m_precision_copies) {
+    if (it.second.size()>0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void AtmosphereProcess::copy_out_precision_copies () {
+  for (auto& it : m_precision_copies) {
+    for (auto& it2 : it.second) {
+      auto& pc = it2.second;
+      if (pc.out) {
+        pc.stored.deep_copy(pc.copy);
+      }
+    }
+  }
+}
+
 void AtmosphereProcess::set_required_group (const FieldGroup& group) {
   // Sanity check
   EKAT_REQUIRE_MSG (has_required_group(group.m_info->m_group_name,group.grid_name()),
@@ -393,6 +541,13 @@ void AtmosphereProcess::update_time_stamps () {
   for (auto& f : m_fields_out) {
     f.get_header().get_tracking().update_time_stamp(t);
   }
+  for (auto& it : m_precision_copies) {
+    for (auto& it2 : it.second) {
+      if (it2.second.out) {
+        it2.second.copy.get_header().get_tracking().update_time_stamp(t);
+      }
+    }
+  }
   for (auto& g : m_groups_out) {
     if (g.m_bundle) {
       g.m_bundle->get_header().get_tracking().update_time_stamp(t);
@@ -619,6 +774,22 @@ void AtmosphereProcess::set_fields_and_groups_pointers () {
     const auto& fid = f.get_header().get_identifier();
     m_internal_fields_pointers[fid.name()][fid.get_grid_name()] = &f;
   }
+
+  // Fields requested with a different precision are accessed via their copy
+  for (auto& it : m_precision_copies) {
+    for (auto& it2 : it.second) {
+      auto& pc = it2.second;
+      if (pc.in) {
+        // Inputs are handed out read-only. Since pc.copy is also needed
+        // non-const for the copy-in, store a const alias of it.
+        m_precision_copies_in[it.first][it2.first] = pc.copy.get_const();
+        m_fields_in_pointers[it.first][it2.first] = &m_precision_copies_in[it.first][it2.first];
+      }
+      if (pc.out) {
+        m_fields_out_pointers[it.first][it2.first] = &pc.copy;
+      }
+    }
+  }
 }
 
 void AtmosphereProcess::
@@ -886,6 +1057,12 @@ void AtmosphereProcess
   rmf(m_fields_in, m_fields_in_pointers);
   rmf(m_fields_out, m_fields_out_pointers);
   rmf(m_internal_fields, m_internal_fields_pointers);
+  if (m_precision_copies.count(field_name)==1) {
+    m_precision_copies.at(field_name).erase(grid_name);
+  }
+  if (m_precision_copies_in.count(field_name)==1) {
+    m_precision_copies_in.at(field_name).erase(grid_name);
+  }
 }
 
 void AtmosphereProcess
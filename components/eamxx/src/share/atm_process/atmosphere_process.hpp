@@ -191,6 +191,16 @@ public:
         "   - Atm proc name: " + this->name() + "\n");
   }
 
+  // Bytes needed by the copies of fields requested with a precision different
+  // from the stored one. They are only used while this process runs, so their
+  // memory can also come from the ATMBufferManager (starting offset_bytes into
+  // it), aliasing other processes' memory. This is safe since run() copies them
+  // in before anything reads them, including this process' pre-condition checks.
+  // If init_precision_copies is not called, the copies are allocated separately
+  // in initialize.
+  size_t requested_precision_copies_bytes () const;
+  void init_precision_copies (const ATMBufferManager& buffer_manager, const size_t offset_bytes);
+
   // Convenience function to retrieve input/output fields from the field/group (and grid) name.
   // Note: the version without grid name only works if there is only one copy of the field/group.
   //       In that case, the single copy is returned, regardless of the associated grid name.
@@ -284,6 +294,15 @@ protected:
                   const std::list<std::string>& groups, const int ps = 1)
   { add_field<RT>(FieldIdentifier(name,layout,u,grid_name),groups,ps); }
 
+  // Request a field with a given precision (e.g., DataType::FloatType). If the
+  // field is stored with a different precision, this process will work on a copy
+  // with the requested one, synced at the boundaries of run().
+  template<RequestType RT>
+  void add_field (const std::string& name, const FieldLayout& layout,
+                  const ekat::units::Units& u, const std::string& grid_name,
+                  const DataType data_type, const int ps = 1)
+  { add_field<RT>(FieldIdentifier(name,layout,u,grid_name,data_type),ps); }
+
   template<RequestType RT>
   void add_field (const FieldIdentifier& fid, const std::string& group, const int ps = 1)
   { add_field<RT>(FieldRequest(fid,group,ps)); }
@@ -376,6 +395,14 @@ protected:
   void add_me_as_provider (const Field& f);
   void add_me_as_customer (const Field& f);
 
+  // Sync the copies of fields requested with a precision different from the
+  // stored one (see m_precision_copies) with the stored fields.
+  void copy_in_precision_copies ();
+  void copy_out_precision_copies ();
+
+  // Whether this process uses any precision copy
+  bool has_precision_copies () const;
+
   // The base class already registers the required/computed/updated fields/groups in
   // the set_required/computed_field and set_required/computed_group routines.
   // These impl methods provide a way for derived classes to add more specialized
@@ -458,6 +485,11 @@ private:
   FieldGroup& get_group_out_impl(const std::string& group_name, const std::string& grid_name) const;
   FieldGroup& get_group_out_impl(const std::string& group_name) const;
 
+  // If this process requested field f with a precision different from the one
+  // it is stored with, returns the converted copy used by this process
+  // (creating it, if needed). Otherwise, returns nullptr.
+  Field* get_precision_copy (const Field& f);
+
   // Compute/store data needed for this processes mass and energy conservation
   // check: dt, tolerance, current mass and energy value per column.
   void compute_column_conservation_checks_data (const int dt);
@@ -488,6 +520,26 @@ private:
   str_map<str_map<Field*>> m_fields_out_pointers;
   str_map<str_map<Field*>> m_internal_fields_pointers;
 
+  // A process can request a floating point field with a precision different
+  // from the one the FieldManager stores it with (e.g., a float field that
+  // other processes see as double). In that case, the process works on a copy
+  // with the requested precision, which is synced with the stored field at the
+  // boundaries of the initialize and run methods (copied in before, and out
+  // after, initialize_impl/run_impl). Since copies hold no data in between,
+  // they can share memory with other processes' copies and local variables.
+  // Note: m_fields_in/m_fields_out store the original fields, so that
+  //       dependencies, time stamps, and checks added by the AD are unaffected.
+  //       Checks added by the process itself, on the fields it gets, act on
+  //       the copies, so pre-condition checks run after the copy-in.
+  struct PrecisionCopy {
+    Field stored;     // The field in the FieldManager
+    Field copy;       // The field with the requested precision
+    bool  in  = false;
+    bool  out = false;
+  };
+  str_map<str_map<PrecisionCopy>> m_precision_copies;
+  str_map<str_map<Field>>         m_precision_copies_in;
+
   // The list of in/out field/group requests.
   std::set<FieldRequest>   m_required_field_requests;
   std::set<FieldRequest>   m_computed_field_requests;
@@ -357,6 +357,8 @@ add_nodes (const group_type& atm_procs)
       // Note: no need to add remappers for this process, because
       //       the sub-group will have its remappers taken care of
       add_nodes(*group);
+      // The sub-group added its own nodes
+      id = m_nodes.size();
     } else {
       // Create a node for the process
       // Node& node = m_nodes[proc->name()];
@@ -619,11 +619,23 @@ process_required_field (const FieldRequest& req) {
   }
 }
 
+namespace {
+// The precision copies of an atm proc start at a 64 bytes boundary
+// after its local variables
+size_t local_bytes (const AtmosphereProcess& atm_proc) {
+  return (atm_proc.requested_buffer_size_in_bytes() + 63) / 64 * 64;
+}
+}
+
 size_t AtmosphereProcessGroup::requested_buffer_size_in_bytes () const
 {
   size_t buf_size = 0;
   for (const auto& proc : m_atm_processes) {
-    buf_size = std::max(buf_size,proc->requested_buffer_size_in_bytes());
+    if (proc->type()==AtmosphereProcessType::Group) {
+      buf_size = std::max(buf_size,proc->requested_buffer_size_in_bytes());
+    } else {
+      buf_size = std::max(buf_size,local_bytes(*proc)+proc->requested_precision_copies_bytes());
+    }
   }
 
   return buf_size;
@@ -633,6 +645,9 @@ void AtmosphereProcessGroup::
 init_buffers(const ATMBufferManager& buffer_manager) {
   for (auto& atm_proc : m_atm_processes) {
     atm_proc->init_buffers(buffer_manager);
+    if (atm_proc->type()!=AtmosphereProcessType::Group) {
+      atm_proc->init_precision_copies(buffer_manager,local_bytes(*atm_proc));
+    }
   }
 }
 
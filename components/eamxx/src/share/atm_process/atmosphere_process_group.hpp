@@ -58,11 +58,13 @@ public:
 
   ScheduleType get_schedule_type () const { return m_group_schedule_type; }
 
-  // Computes total number of bytes needed for local variables
+  // Computes total number of bytes needed for local variables and precision
+  // copies. Atm procs run one at a time, so this is the max over the atm procs.
   size_t requested_buffer_size_in_bytes () const;
 
-  // Set local variables using memory provided by
-  // the ATMBufferManager
+  // Set local variables and precision copies using memory provided by
+  // the ATMBufferManager. Each atm proc gets the start of the buffer for its
+  // local variables, followed by its precision copies.
   void init_buffers(const ATMBufferManager& buffer_manager);
 
   // The APG class needs to perform special checks before establishing whether
@@ -0,0 +1,196 @@
+#include "share/atm_process/column_integral_diagnostic.hpp"
+#include "physics/share/physics_constants.hpp"
+
+#include "ekat/ekat_pack.hpp"
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+
+#include <map>
+
+namespace scream
+{
+
+namespace impl
+{
+
+// The partial sums of a group of column integrals, used as a team reduction value
+struct ColumnIntegralSums {
+  static constexpr int N = ColumnIntegralDiagnostic::max_group_size;
+
+  Real v[N];
+
+  KOKKOS_INLINE_FUNCTION
+  ColumnIntegralSums () {
+    for (int i=0; i<N; ++i) {
+      v[i] = 0;
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  ColumnIntegralSums& operator+= (const ColumnIntegralSums& rhs) {
+    for (int i=0; i<N; ++i) {
+      v[i] += rhs.v[i];
+    }
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator+= (const volatile ColumnIntegralSums& rhs) volatile {
+    for (int i=0; i<N; ++i) {
+      v[i] += rhs.v[i];
+    }
+  }
+};
+
+} // namespace impl
+} // namespace scream
+
+namespace Kokkos {
+template<>
+struct reduction_identity<scream::impl::ColumnIntegralSums> {
+  KOKKOS_FORCEINLINE_FUNCTION
+  static scream::impl::ColumnIntegralSums sum () {
+    return scream::impl::ColumnIntegralSums();
+  }
+};
+} // namespace Kokkos
+
+namespace scream
+{
+
+// =========================================================================================
+ColumnIntegralDiagnostic::
+ColumnIntegralDiagnostic (const ekat::Comm& comm, const ekat::ParameterList& params)
+  : AtmosphereDiagnostic(comm,params)
+{
+  // Nothing to do here
+}
+
+// =========================================================================================
+void ColumnIntegralDiagnostic::
+set_integrand (const std::vector<Factor>& factors, const std::string& weight_name)
+{
+  EKAT_REQUIRE_MSG (factors.size()==1 || factors.size()==2,
+      "Error! Column integrals support one or two factors.\n"
+      "  - Diag name: " + name() + "\n");
+  m_factors = factors;
+  m_weight_name = weight_name;
+}
+
+// =========================================================================================
+void ColumnIntegralDiagnostic::compute_diagnostic_impl ()
+{
+  if (m_precomputed) {
+    m_precomputed = false;
+    return;
+  }
+  compute_group({this});
+}
+
+// =========================================================================================
+void ColumnIntegralDiagnostic::
+compute_grouped (const std::vector<std::shared_ptr<ColumnIntegralDiagnostic>>& diags)
+{
+  // Group the integrals by weight field (which fixes the number of columns and levels).
+  // Integrals with precision copies are left out: their copies are only synced
+  // with the stored fields in compute_diagnostic, which computes them as usual.
+  // Integrals whose weight is not Real are left out as well, since the weight
+  // data pointer is used as the group key.
+  std::map<const Real*,std::vector<ColumnIntegralDiagnostic*>> groups;
+  std::vector<ColumnIntegralDiagnostic*> grouped;
+  for (const auto& d : diags) {
+    const auto& w = d->get_field_in(d->m_weight_name);
+    if (d->has_precision_copies() ||
+        w.data_type()!=field_valid_data_types().at<Real>()) {
+      continue;
+    }
+    auto& group = groups[w.get_internal_view_data<const Real>()];
+    group.push_back(d.get());
+    grouped.push_back(d.get());
+    if (group.size()==max_group_size) {
+      compute_group(group);
+      group.clear();
+    }
+  }
+  for (const auto& it : groups) {
+    if (it.second.size()>0) {
+      compute_group(it.second);
+    }
+  }
+
+  for (auto d : grouped) {
+    d->m_precomputed = true;
+  }
+}
+
+// =========================================================================================
+void ColumnIntegralDiagnostic::
+compute_group (const std::vector<ColumnIntegralDiagnostic*>& group)
+{
+  using PC         = scream::physics::Constants<Real>;
+  using Pack       = ekat::Pack<Real,SCREAM_PACK_SIZE>;
+  using KT         = KokkosTypes<DefaultDevice>;
+  using MemberType = typename KT::MemberType;
+  using in_view_t  = Field::get_view_type<const Pack**,Device>;
+  using out_view_t = Field::get_view_type<Real*,Device>;
+  using Sums       = impl::ColumnIntegralSums;
+  constexpr int N  = max_group_size;
+
+  const int n = group.size();
+  EKAT_REQUIRE_MSG (n>=1 && n<=N,
+      "Error! Invalid column integrals group size: " + std::to_string(n) + "\n");
+
+  const auto& d0 = *group[0];
+  const auto num_cols = d0.m_num_cols;
+  const auto num_levs = d0.m_num_levs;
+  const auto weight = d0.get_field_in(d0.m_weight_name).get_view<const Pack**>();
+
+  Kokkos::Array<in_view_t,N>  f1, f2;
+  Kokkos::Array<out_view_t,N> out;
+  Kokkos::Array<int,N>        nfactors;
+  for (int i=0; i<n; ++i) {
+    const auto& d = *group[i];
+    EKAT_REQUIRE_MSG (d.m_num_cols==num_cols && d.m_num_levs==num_levs,
+        "Error! Column integrals in the same group must have the same dimensions.\n"
+        "  - Diag names: " + d0.name() + ", " + d.name() + "\n");
+    const auto get_factor = [&] (const Factor& f) {
+      const auto& fld = d.get_field_in(f.name);
+      return f.component<0 ? fld.get_view<const Pack**>()
+                           : fld.subfield(1,f.component).get_view<const Pack**>();
+    };
+    nfactors[i] = d.m_factors.size();
+    f1[i] = get_factor(d.m_factors[0]);
+    if (nfactors[i]>1) {
+      f2[i] = get_factor(d.m_factors[1]);
+    }
+    out[i] = d.m_diagnostic_output.get_view<Real*>();
+  }
+
+  constexpr Real gravit = PC::gravit;
+  const auto npacks = ekat::npack<Pack>(num_levs);
+  const auto policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(num_cols, npacks);
+  Kokkos::parallel_for("ColumnIntegralDiagnostic",
+                       policy,
+                       KOKKOS_LAMBDA(const MemberType& team) {
+    const int icol = team.league_rank();
+    Sums sums;
+    Kokkos::parallel_reduce(Kokkos::TeamVectorRange(team, num_levs), [&] (const Int& idx, Sums& lsum) {
+      const int jpack = idx / Pack::n;
+      const int klev  = idx % Pack::n;
+      const Real w = weight(icol,jpack)[klev];
+      for (int i=0; i<n; ++i) {
+        Real val = f1[i](icol,jpack)[klev];
+        if (nfactors[i]>1) {
+          val *= f2[i](icol,jpack)[klev];
+        }
+        lsum.v[i] += val * w/gravit;
+      }
+    },sums);
+    Kokkos::single(Kokkos::PerTeam(team),[&] {
+      for (int i=0; i<n; ++i) {
+        out[i](icol) = sums.v[i];
+      }
+    });
+  });
+}
+// =========================================================================================
+} //namespace scream
@@ -0,0 +1,86 @@
+#ifndef SCREAM_COLUMN_INTEGRAL_DIAGNOSTIC_HPP
+#define SCREAM_COLUMN_INTEGRAL_DIAGNOSTIC_HPP
+
+#include "share/atm_process/atmosphere_diagnostic.hpp"
+
+namespace scream
+{
+
+/*
+ * A diagnostic computing a mass-weighted vertical integral
+ *
+ *   out(icol) = sum_k f_1(icol,k) * ... * f_n(icol,k) * w(icol,k) / g
+ *
+ * where w is a weight field (typically pseudo_density, so that w/g is the
+ * layer mass per unit area), and f_i are midpoint fields (or components of
+ * vector fields), e.g., water paths and vertically integrated vapor fluxes.
+ *
+ * Derived classes only declare their fields and integrand in set_grids.
+ *
+ * Several integrals sharing the same weight field can be computed together
+ * with compute_grouped, which reads the weight once for the whole group, using
+ * a multi-value team reduction. This is what AtmosphereOutput does for all the
+ * column integrals in an output stream.
+ */
+
+class ColumnIntegralDiagnostic : public AtmosphereDiagnostic
+{
+public:
+  // Max number of integrals computed in one kernel. Larger groups are split.
+  static constexpr int max_group_size = 8;
+
+  // A factor of the integrand: a field name and, for vector fields, the
+  // component to use (-1 for scalar fields).
+  struct Factor {
+    std::string name;
+    int         component;
+
+    Factor (const std::string& n, const int c = -1) : name(n), component(c) {}
+    Factor (const char* n, const int c = -1) : name(n), component(c) {}
+  };
+
+  // Constructors
+  ColumnIntegralDiagnostic (const ekat::Comm& comm, const ekat::ParameterList& params);
+
+  virtual ~ColumnIntegralDiagnostic () = default;
+
+  // Name of the weight field
+  const std::string& get_weight_name () const { return m_weight_name; }
+
+  // Compute all the given integrals, in one kernel for each set of integrals
+  // sharing the same weight field. The next call to compute_diagnostic on
+  // each of them will only update the time stamp of the output. Integrals
+  // using precision copies, or with a non-Real weight, are not computed here,
+  // and are computed by compute_diagnostic as usual.
+  static void compute_grouped (const std::vector<std::shared_ptr<ColumnIntegralDiagnostic>>& diags);
+
+protected:
+
+  // Set the integrand. Must be called by derived classes in set_grids,
+  // after the weight and factor fields have been added as required fields.
+  void set_integrand (const std::vector<Factor>& factors,
+                      const std::string& weight_name = "pseudo_density");
+
+  void compute_diagnostic_impl ();
+
+  // Keep track of field dimensions
+  Int m_num_cols;
+  Int m_num_levs;
+
+#ifdef KOKKOS_ENABLE_CUDA
+public:
+#endif
+  static void compute_group (const std::vector<ColumnIntegralDiagnostic*>& group);
+
+private:
+
+  std::vector<Factor>   m_factors;
+  std::string           m_weight_name;
+
+  // Whether the output has already been computed by compute_grouped
+  bool                  m_precomputed = false;
+};
+
+} //namespace scream
+
+#endif // SCREAM_COLUMN_INTEGRAL_DIAGNOSTIC_HPP
@@ -85,7 +85,7 @@ subfield (const std::string& sf_name, const ekat::units::Units& sf_units,
         "Error! Subview dimension index must be either 0 or 1.\n");
 
   // Create identifier for subfield
-  FieldIdentifier sf_id(sf_name,lt.strip_dim(idim),sf_units,id.get_grid_name());
+  FieldIdentifier sf_id(sf_name,lt.strip_dim(idim),sf_units,id.get_grid_name(),id.data_type());
 
   // Create empty subfield, then set header and views
   // Note: we can access protected members, since it's the same type
@@ -160,4 +160,25 @@ void Field::allocate_view ()
   m_data.h_view = Kokkos::create_mirror_view(m_data.d_view);
 }
 
+void Field::allocate_view (char* const memory)
+{
+  EKAT_REQUIRE_MSG(!is_allocated(), "Error! View was already allocated.\n");
+  EKAT_REQUIRE_MSG(memory!=nullptr, "Error! Invalid pointer to the field memory.\n");
+
+  // Short names
+  const auto& id     = m_header->get_identifier();
+  const auto& layout = id.get_layout_ptr();
+  auto& alloc_prop   = m_header->get_alloc_properties();
+
+  EKAT_REQUIRE_MSG(layout->are_dimensions_set(),
+      "Error! Cannot allocate the view until all the field's dimensions are set.\n");
+
+  alloc_prop.commit(layout);
+
+  // Unmanaged view: the memory is not freed when the field is destroyed
+  const auto view_dim = alloc_prop.get_alloc_size();
+  m_data.d_view = decltype(m_data.d_view)(memory,view_dim);
+  m_data.h_view = Kokkos::create_mirror_view(m_data.d_view);
+}
+
 } // namespace scream
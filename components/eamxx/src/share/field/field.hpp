@@ -180,7 +180,9 @@ public:
   template<typename T, HostOrDevice HD = Device>
   void deep_copy (const T value);
 
-  // Copy the data from one field to this field
+  // Copy the data from one field to this field.
+  // Floating point fields can be copied into each other regardless of their
+  // precision (float<->double), with values converted on the fly.
   template<HostOrDevice HD = Device>
   void deep_copy (const Field& field_src);
 
@@ -232,12 +234,16 @@ public:
   // Allocate the actual view
   void allocate_view ();
 
+  // Create the view on memory owned by someone else, which must be at least
+  // get_alloc_properties().get_alloc_size() bytes, and outlive this field.
+  void allocate_view (char* const memory);
+
 protected:
 
   template<typename ST, HostOrDevice HD = Device>
   void deep_copy_impl (const ST value);
 
-  template<typename ST, HostOrDevice HD = Device>
+  template<typename ST, typename SrcST, HostOrDevice HD = Device>
   void deep_copy_impl (const Field& field_src);
 
   template<HostOrDevice HD>
@@ -354,18 +360,30 @@ deep_copy (const Field& field_src) {
   EKAT_REQUIRE_MSG (not m_is_read_only,
       "Error! Cannot call deep_copy on read-only fields.\n");
 
-  EKAT_REQUIRE_MSG (data_type()==field_src.data_type(),
-      "Error! Cannot copy fields with different data type.\n");
+  const auto dt     = data_type();
+  const auto dt_src = field_src.data_type();
+  EKAT_REQUIRE_MSG (dt==dt_src || (dt!=DataType::IntType && dt_src!=DataType::IntType),
+      "Error! Cannot copy fields with different data type.\n"
+      "   - src field: " + field_src.name() + " (" + e2str(dt_src) + ")\n"
+      "   - tgt field: " + name() + " (" + e2str(dt) + ")\n");
 
-  switch (data_type()) {
+  switch (dt) {
     case DataType::IntType:
-      deep_copy_impl<int,HD>(field_src);
+      deep_copy_impl<int,int,HD>(field_src);
       break;
     case DataType::FloatType:
-      deep_copy_impl<float,HD>(field_src);
+      if (dt_src==DataType::FloatType) {
+        deep_copy_impl<float,float,HD>(field_src);
+      } else {
+        deep_copy_impl<float,double,HD>(field_src);
+      }
       break;
     case DataType::DoubleType:
-      deep_copy_impl<double,HD>(field_src);
+      if (dt_src==DataType::DoubleType) {
+        deep_copy_impl<double,double,HD>(field_src);
+      } else {
+        deep_copy_impl<double,float,HD>(field_src);
+      }
       break;
     default:
       EKAT_ERROR_MSG ("Error! Unrecognized field data type in Field::deep_copy.\n");
@@ -406,7 +424,7 @@ deep_copy (const ST value) {
   }
 }
 
-template<typename ST, HostOrDevice HD>
+template<typename ST, typename SrcST, HostOrDevice HD>
 void Field::
 deep_copy_impl (const Field& field_src) {
 
@@ -422,35 +440,35 @@ deep_copy_impl (const Field& field_src) {
     case 1:
       {
         auto v     = get_view<ST*,HD>();
-        auto v_src = field_src.get_view<const ST*,HD>();
+        auto v_src = field_src.get_view<const SrcST*,HD>();
         Kokkos::deep_copy(v,v_src);
       }
       break;
     case 2:
       {
         auto v     = get_view<ST**,HD>();
-        auto v_src = field_src.get_view<const ST**,HD>();
+        auto v_src = field_src.get_view<const SrcST**,HD>();
         Kokkos::deep_copy(v,v_src);
       }
       break;
     case 3:
       {
         auto v     = get_view<ST***,HD>();
-        auto v_src = field_src.get_view<const ST***,HD>();
+        auto v_src = field_src.get_view<const SrcST***,HD>();
         Kokkos::deep_copy(v,v_src);
       }
       break;
     case 4:
       {
         auto v     = get_view<ST****,HD>();
-        auto v_src = field_src.get_view<const ST****,HD>();
+        auto v_src = field_src.get_view<const SrcST****,HD>();
         Kokkos::deep_copy(v,v_src);
       }
       break;
     case 5:
       {
         auto v     = get_view<ST*****,HD>();
-        auto v_src = field_src.get_view<const ST*****,HD>();
+        auto v_src = field_src.get_view<const SrcST*****,HD>();
         Kokkos::deep_copy(v,v_src);
       }
       break;
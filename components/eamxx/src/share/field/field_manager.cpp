@@ -30,9 +30,6 @@ void FieldManager::register_field (const FieldRequest& req)
 
   // Get or create the new field
   if (!has_field(id.name())) {
-    EKAT_REQUIRE_MSG (id.data_type()==field_valid_data_types().at<Real>(),
-        "Error! While refactoring, we only allow the Field data type to be Real.\n"
-        "       If you're done with refactoring, go back and fix things.\n");
     m_fields[id.name()] = std::make_shared<Field>(id);
   } else {
     // Make sure the input field has the same layout and units as the field already stored.
@@ -51,6 +48,27 @@ void FieldManager::register_field (const FieldRequest& req)
         "         - input id:  " + id.get_id_string() + "\n"
         "         - stored id: " + id0.get_id_string() + "\n"
         "       Please, check and make sure all atmosphere processes use the same layout for a given field.\n");
+
+    // Floating point fields can be requested with different precisions. We store
+    // a single copy, with the highest requested precision, so that no customer
+    // sees less precision than it asked for. Customers that asked for a different
+    // precision get a converted copy at their boundary (see AtmosphereProcess).
+    // Hence, a field is stored in single precision only if all requests are float.
+    if (id.data_type()!=id0.data_type()) {
+      EKAT_REQUIRE_MSG(id.data_type()!=DataType::IntType && id0.data_type()!=DataType::IntType,
+          "Error! Field '" + id.name() + "' already registered with a different data type:\n"
+          "         - input id:  " + id.get_id_string() + "\n"
+          "         - stored id: " + id0.get_id_string() + "\n"
+          "       Only floating point fields can be requested with different precisions.\n");
+      if (get_type_size(id.data_type())>get_type_size(id0.data_type())) {
+        // Promote the stored field, preserving the allocation requests made so far.
+        const auto& ap0 = m_fields[id.name()]->get_header().get_alloc_properties();
+        auto f = std::make_shared<Field>(FieldIdentifier(id.name(),id.get_layout(),id0.get_units(),
+                                                         id.get_grid_name(),id.data_type()));
+        f->get_header().get_alloc_properties().request_allocation(ap0);
+        m_fields[id.name()] = f;
+      }
+    }
   }
 
   if (req.subview_info.dim_idx>=0) {
@@ -500,16 +518,23 @@ void FieldManager::registration_ends ()
       }
 
       // Figure out the layout of the fields in this cluster,
-      // and make sure they all have the same layout
+      // and make sure they all have the same layout and data type
       LayoutType lt = LayoutType::Invalid;
       std::shared_ptr<const FieldLayout> f_layout;
+      DataType c_data_type = DataType::RealType;
       for (const auto& fname : cluster_ordered_fields) {
         const auto& f = m_fields.at(fname);
         const auto& id = f->get_header().get_identifier();
         if (lt==LayoutType::Invalid) {
          f_layout = id.get_layout_ptr();
          lt = get_layout_type(f_layout->tags());
+         c_data_type = id.data_type();
         } else {
+          EKAT_REQUIRE_MSG (c_data_type==id.data_type(),
+              "Error! Found a group to bundle containing fields with different data types.\n"
+              "       Group name: " + cluster_name + "\n"
+              "       Data type 1: " + e2str(c_data_type) + "\n"
+              "       Data type 2: " + e2str(id.data_type()) + "\n");
           EKAT_REQUIRE_MSG (lt==get_layout_type(id.get_layout().tags()),
               "Error! Found a group to bundle containing fields with different layouts.\n"
               "       Group name: " + cluster_name + "\n"
@@ -533,7 +558,7 @@ void FieldManager::registration_ends ()
       auto nondim = ekat::units::Units::nondimensional();
 
       // Allocate cluster field
-      FieldIdentifier c_fid(cluster_name,c_layout,nondim,m_grid->name());
+      FieldIdentifier c_fid(cluster_name,c_layout,nondim,m_grid->name(),c_data_type);
       register_field(c_fid);
       const auto& C = m_fields.at(c_fid.name());
 
@@ -643,7 +668,8 @@ void FieldManager::registration_ends ()
       g_layout = m_grid->get_3d_vector_layout(mid,CMP,size);
     }
 
-    FieldIdentifier g_fid(gname,g_layout,nondim,m_grid->name());
+    FieldIdentifier g_fid(gname,g_layout,nondim,m_grid->name(),
+                          f1->get_header().get_identifier().data_type());
     register_field(g_fid);
     const auto& G = m_fields.at(g_fid.name());
 
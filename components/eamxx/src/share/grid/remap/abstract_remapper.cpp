@@ -37,6 +37,10 @@ register_field (const identifier_type& src, const identifier_type& tgt) {
 
   EKAT_REQUIRE_MSG(compatible_layouts(src.get_layout(),tgt.get_layout()),
                      "Error! Source and target layouts are not compatible.\n");
+  EKAT_REQUIRE_MSG(src.data_type()==tgt.data_type(),
+                     "Error! Source and target fields have different data types.\n"
+                     "  - src id: " + src.get_id_string() + "\n"
+                     "  - tgt id: " + tgt.get_id_string() + "\n");
 
   do_register_field (src,tgt);
 
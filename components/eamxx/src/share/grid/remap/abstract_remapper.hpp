@@ -120,7 +120,7 @@ public:
     const auto& layout = create_src_layout(tgt_fid.get_layout());
     const auto& units = tgt_fid.get_units();
 
-    return FieldIdentifier(name,layout,units,m_src_grid->name());
+    return FieldIdentifier(name,layout,units,m_src_grid->name(),tgt_fid.data_type());
   }
 
   FieldIdentifier create_tgt_fid (const FieldIdentifier& src_fid) const {
@@ -133,7 +133,7 @@ public:
     const auto& layout = create_tgt_layout(src_fid.get_layout());
     const auto& units = src_fid.get_units();
 
-    return FieldIdentifier(name,layout,units,m_tgt_grid->name());
+    return FieldIdentifier(name,layout,units,m_tgt_grid->name(),src_fid.data_type());
   }
 
   bool has_src_field (const identifier_type& fid) const {
@@ -280,6 +280,11 @@ do_register_field (const identifier_type& src, const identifier_type& tgt)
 {
   m_src_fields.push_back(field_type(src));
   m_tgt_fields.push_back(field_type(tgt));
+
+  // Note: scorpio IO stages fields with other precisions in Real copies before remapping
+  EKAT_REQUIRE_MSG (src.data_type()==field_valid_data_types().at<Real>(),
+      "Error! Coarsening remapper only works for Real data type.\n"
+      "  - field id: " + src.get_id_string() + "\n");
 }
 
 void CoarseningRemapper::
@@ -369,48 +374,16 @@ void CoarseningRemapper::do_remap_fwd ()
 
   // TODO: Add check that if there are mask values they are either 1's or 0's for unmasked/masked.
 
-  // Loop over each field
-  constexpr auto can_pack = SCREAM_PACK_SIZE>1;
-  for (int i=0; i<m_num_fields; ++i) {
-    // First, perform the local mat-vec. Recall that in these y=Ax products,
-    // x is the src field, and y is the overlapped tgt field.
-    const auto& f_src    = m_src_fields[i];
-    const auto& f_ov_tgt = m_ov_tgt_fields[i];
-
-    int mask_idx = -1;
-    if (m_track_mask) {
-      mask_idx = m_mask_map_src.at(f_src.name());
-    }
-
-    if (mask_idx != -1) {
-      // Pass the mask to the local_mat_vec routine
-      auto mask = m_mask_fields_src[mask_idx];
-      // Dispatch kernel with the largest possible pack size
-      const auto& src_ap = f_src.get_header().get_alloc_properties();
-      const auto& ov_tgt_ap = f_ov_tgt.get_header().get_alloc_properties();
-      if (can_pack && src_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>() &&
-                      ov_tgt_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>()) {
-        local_mat_vec<SCREAM_PACK_SIZE>(f_src,f_ov_tgt,&mask);
-      } else {
-        local_mat_vec<1>(f_src,f_ov_tgt,&mask);
-      }
-    } else {
-      // Dispatch kernel with the largest possible pack size
-      const auto& src_ap = f_src.get_header().get_alloc_properties();
-      const auto& ov_tgt_ap = f_ov_tgt.get_header().get_alloc_properties();
-      if (can_pack && src_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>() &&
-                      ov_tgt_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>()) {
-        local_mat_vec<SCREAM_PACK_SIZE>(f_src,f_ov_tgt);
-      } else {
-        local_mat_vec<1>(f_src,f_ov_tgt);
-      }
-    }
-  }
-
-  // Pack, then fire off the sends
+  // First, perform the local mat-vec for the rows that we need to send to other
+  // ranks, then pack and fire off the sends. Recall that in these y=Ax products,
+  // x is the src field, and y is the overlapped tgt field.
+  local_mat_vec (0,m_num_remote_ov_rows);
   pack_and_send ();
 
-  // Wait for all data to be received, then unpack
+  // While messages are in flight, compute the rows that we own
+  local_mat_vec (m_num_remote_ov_rows,m_ov_tgt_grid->get_num_local_dofs());
+
+  // Unpack what already arrived, then wait for the rest
   recv_and_unpack ();
 
   // Wait for all sends to be completed
@@ -422,6 +395,7 @@ void CoarseningRemapper::do_remap_fwd ()
   }
 
   // Rescale any fields that had the mask applied.
+  constexpr auto can_pack = SCREAM_PACK_SIZE>1;
   if (m_track_mask) {
     for (int i=0; i<m_num_fields; ++i) {
       const auto& f_tgt = m_tgt_fields[i];
@@ -530,9 +504,38 @@ rescale_masked_fields (const Field& x, const Field& mask) const
 
 }
 
+void CoarseningRemapper::
+local_mat_vec (const int rows_beg, const int rows_end) const
+{
+  // Loop over each field
+  constexpr auto can_pack = SCREAM_PACK_SIZE>1;
+  for (int i=0; i<m_num_fields; ++i) {
+    const auto& f_src    = m_src_fields[i];
+    const auto& f_ov_tgt = m_ov_tgt_fields[i];
+
+    int mask_idx = -1;
+    if (m_track_mask) {
+      mask_idx = m_mask_map_src.at(f_src.name());
+    }
+    const Field* mask = mask_idx==-1 ? nullptr : &m_mask_fields_src[mask_idx];
+
+    // Dispatch kernel with the largest possible pack size
+    const auto& src_ap = f_src.get_header().get_alloc_properties();
+    const auto& ov_tgt_ap = f_ov_tgt.get_header().get_alloc_properties();
+    if (can_pack && src_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>() &&
+                    ov_tgt_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>()) {
+      local_mat_vec<SCREAM_PACK_SIZE>(f_src,f_ov_tgt,rows_beg,rows_end,mask);
+    } else {
+      local_mat_vec<1>(f_src,f_ov_tgt,rows_beg,rows_end,mask);
+    }
+  }
+}
+
 template<int PackSize>
 void CoarseningRemapper::
-local_mat_vec (const Field& x, const Field& y, const Field* mask) const
+local_mat_vec (const Field& x, const Field& y,
+               const int rows_beg, const int rows_end,
+               const Field* mask) const
 {
   using RangePolicy = typename KT::RangePolicy;
   using MemberType  = typename KT::MemberType;
@@ -542,7 +545,11 @@ local_mat_vec (const Field& x, const Field& y, const Field* mask) const
 
   const auto& src_layout = x.get_header().get_identifier().get_layout();
   const int rank = src_layout.rank();
-  const int nrows = m_ov_tgt_grid->get_num_local_dofs();
+  const int nrows = rows_end - rows_beg;
+  if (nrows==0) {
+    return;
+  }
+  auto ov_rows = m_ov_rows;
   auto row_offsets = m_row_offsets;
   auto col_lids = m_col_lids;
   auto weights = m_weights;
@@ -559,7 +566,8 @@ local_mat_vec (const Field& x, const Field& y, const Field* mask) const
         mask_view = mask->get_view<Real*>();
       }
       Kokkos::parallel_for(RangePolicy(0,nrows),
-                           KOKKOS_LAMBDA(const int& row) {
+                           KOKKOS_LAMBDA(const int& irow) {
+        const auto row = ov_rows(rows_beg+irow);
         const auto beg = row_offsets(row);
         const auto end = row_offsets(row+1);
         if (mask != nullptr) {
@@ -588,7 +596,7 @@ local_mat_vec (const Field& x, const Field& y, const Field* mask) const
       auto policy = ESU::get_default_team_policy(nrows,dim1);
       Kokkos::parallel_for(policy,
                            KOKKOS_LAMBDA(const MemberType& team) {
-        const auto row = team.league_rank();
+        const auto row = ov_rows(rows_beg+team.league_rank());
 
         const auto beg = row_offsets(row);
         const auto end = row_offsets(row+1);
@@ -623,7 +631,7 @@ local_mat_vec (const Field& x, const Field& y, const Field* mask) const
       auto policy = ESU::get_default_team_policy(nrows,dim1*dim2);
       Kokkos::parallel_for(policy,
                            KOKKOS_LAMBDA(const MemberType& team) {
-        const auto row = team.league_rank();
+        const auto row = ov_rows(rows_beg+team.league_rank());
 
         const auto beg = row_offsets(row);
         const auto end = row_offsets(row+1);
@@ -664,6 +672,9 @@ void CoarseningRemapper::pack_and_send ()
   const auto lids_pids = m_send_lids_pids;
   const auto buf = m_send_buffer;
 
+  // Contributions to rows owned by this rank are not sent (see recv_and_unpack)
+  const int my_pid = m_comm.rank();
+
   for (int ifield=0; ifield<m_num_fields; ++ifield) {
     const auto& f  = m_ov_tgt_fields[ifield];
     const auto& fl = f.get_header().get_identifier().get_layout();
@@ -678,6 +689,9 @@ void CoarseningRemapper::pack_and_send ()
                              KOKKOS_LAMBDA(const int& i){
           const int lid = lids_pids(i,0);
           const int pid = lids_pids(i,1);
+          if (pid==my_pid) {
+            return;
+          }
           const int lidpos = i - pid_lid_start(pid);
           const int offset = f_pid_offsets(pid);
 
@@ -694,6 +708,9 @@ void CoarseningRemapper::pack_and_send ()
           const int i = team.league_rank();
           const int lid = lids_pids(i,0);
           const int pid = lids_pids(i,1);
+          if (pid==my_pid) {
+            return;
+          }
           const int lidpos = i - pid_lid_start(pid);
           const int offset = f_pid_offsets(pid);
 
@@ -713,6 +730,9 @@ void CoarseningRemapper::pack_and_send ()
           const int i = team.league_rank();
           const int lid = lids_pids(i,0);
           const int pid = lids_pids(i,1);
+          if (pid==my_pid) {
+            return;
+          }
           const int lidpos = i - pid_lid_start(pid);
           const int offset = f_pid_offsets(pid);
 
@@ -733,6 +753,9 @@ void CoarseningRemapper::pack_and_send ()
           const int i = team.league_rank();
           const int lid = lids_pids(i,0);
           const int pid = lids_pids(i,1);
+          if (pid==my_pid) {
+            return;
+          }
           const int lidpos = i - pid_lid_start(pid);
           const int offset = f_pid_offsets(pid);
 
@@ -767,54 +790,125 @@ void CoarseningRemapper::pack_and_send ()
 
 void CoarseningRemapper::recv_and_unpack ()
 {
-  if (not m_recv_req.empty()) {
-    int ierr = MPI_Waitall(m_recv_req.size(),m_recv_req.data(), MPI_STATUSES_IGNORE);
+  for (auto& f : m_tgt_fields) {
+    f.deep_copy(0);
+  }
+
+  // Each tgt dof accumulates contributions from all PIDs, in increasing PID order,
+  // so that the result does not depend on the order in which messages arrive.
+  // Each unpack call launches one kernel per field, so we unpack in (at most) two
+  // batches: first all PIDs up to the first one whose message has not arrived yet
+  // (without waiting), then, once all messages are in, the remaining PIDs.
+  // Note: this PID has no recv request, since its contributions are read
+  //       directly from the ov_tgt fields.
+  const int nreqs = m_recv_req.size();
+  std::vector<char> arrived(nreqs,0);
+
+  // If MPI does not use dev pointers, we need to deep copy from host to dev
+  auto copy_to_dev = [&](const int ireq) {
+    if (not MpiOnDev) {
+      const auto range = std::make_pair(m_recv_req_beg[ireq],m_recv_req_end[ireq]);
+      Kokkos::deep_copy (Kokkos::subview(m_recv_buffer,range),
+                         Kokkos::subview(m_mpi_recv_buffer,range));
+    }
+  };
+
+  int pid_beg = 0;
+  if (nreqs>0) {
+    std::vector<int> done(nreqs);
+    int ndone;
+    int ierr = MPI_Testsome(nreqs,m_recv_req.data(),&ndone,done.data(),MPI_STATUSES_IGNORE);
+    EKAT_REQUIRE_MSG (ierr==MPI_SUCCESS,
+        "Error! Something whent wrong while testing persistent recv requests.\n"
+        "  - recv rank: " + std::to_string(m_comm.rank()) + "\n");
+    if (ndone==MPI_UNDEFINED) {
+      ndone = 0;
+    }
+    for (int n=0; n<ndone; ++n) {
+      copy_to_dev(done[n]);
+      arrived[done[n]] = 1;
+    }
+
+    int next_req = 0;
+    while (next_req<nreqs && arrived[next_req]) {
+      ++next_req;
+    }
+    const int pid_end = next_req<nreqs ? m_recv_req_pids[next_req] : m_comm.size();
+    if (pid_end>pid_beg) {
+      unpack (pid_beg,pid_end);
+      pid_beg = pid_end;
+    }
+
+    ierr = MPI_Waitall(nreqs,m_recv_req.data(),MPI_STATUSES_IGNORE);
     EKAT_REQUIRE_MSG (ierr==MPI_SUCCESS,
         "Error! Something whent wrong while waiting on persistent recv requests.\n"
         "  - recv rank: " + std::to_string(m_comm.rank()) + "\n");
+    for (int ireq=next_req; ireq<nreqs; ++ireq) {
+      if (not arrived[ireq]) {
+        copy_to_dev(ireq);
+      }
+    }
   }
-  // If MPI does not use dev pointers, we need to deep copy from host to dev
-  if (not MpiOnDev) {
-    Kokkos::deep_copy (m_recv_buffer,m_mpi_recv_buffer);
+
+  // Remaining PIDs (possibly all of them, if we receive nothing)
+  if (pid_beg<m_comm.size()) {
+    unpack (pid_beg,m_comm.size());
   }
+}
 
+void CoarseningRemapper::unpack (const int pid_beg, const int pid_end)
+{
   using RangePolicy = typename KT::RangePolicy;
   using MemberType  = typename KT::MemberType;
   using ESU         = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
 
   const int num_tgt_dofs = m_tgt_grid->get_num_local_dofs();
 
+  // Contributions from this PID are read directly from the ov_tgt fields.
+  // The n-th dof we would send to ourselves is the ov_tgt lid send_lids_pids(self_beg+n,0)
+  const int my_pid = m_comm.rank();
+  const auto send_lids_pids = m_send_lids_pids;
+  const int self_beg = m_send_self_beg;
+
   const auto buf = m_recv_buffer;
   const auto recv_lids_beg = m_recv_lids_beg;
   const auto recv_lids_end = m_recv_lids_end;
   const auto recv_lids_pidpos = m_recv_lids_pidpos;
   for (int ifield=0; ifield<m_num_fields; ++ifield) {
           auto& f  = m_tgt_fields[ifield];
+    const auto& ov = m_ov_tgt_fields[ifield];
     const auto& fl = f.get_header().get_identifier().get_layout();
     const auto lt = get_layout_type(fl.tags());
     const auto f_pid_offsets = ekat::subview(m_recv_f_pid_offsets,ifield);
 
-
-    f.deep_copy(0);
     switch (lt) {
       case LayoutType::Scalar2D:
       {
         auto v = f.get_view<Real*>();
+        auto ov_v = ov.get_view<const Real*>();
         Kokkos::parallel_for(RangePolicy(0,num_tgt_dofs),
                              KOKKOS_LAMBDA(const int& lid){
           const int recv_beg = recv_lids_beg(lid);
           const int recv_end = recv_lids_end(lid);
           for (int irecv=recv_beg; irecv<recv_end; ++irecv) {
             const int pid = recv_lids_pidpos(irecv,0);
+            if (pid<pid_beg || pid>=pid_end) {
+              continue;
+            }
             const int lidpos = recv_lids_pidpos(irecv,1);
-            const int offset = f_pid_offsets(pid) + lidpos;
-            v(lid) += buf (offset);
+            if (pid==my_pid) {
+              v(lid) += ov_v(send_lids_pids(self_beg+lidpos,0));
+            } else {
+              const int offset = f_pid_offsets(pid) + lidpos;
+              v(lid) += buf (offset);
+            }
           }
         });
       } break;
       case LayoutType::Vector2D:
       {
         auto v = f.get_view<Real**>();
+        auto ov_v = ov.get_view<const Real**>();
         const int ndims = fl.dim(1);
         auto policy = ESU::get_default_team_policy(num_tgt_dofs,ndims);
         Kokkos::parallel_for(policy,
@@ -824,18 +918,30 @@ void CoarseningRemapper::recv_and_unpack ()
           const int recv_end = recv_lids_end(lid);
           for (int irecv=recv_beg; irecv<recv_end; ++irecv) {
             const int pid = recv_lids_pidpos(irecv,0);
+            if (pid<pid_beg || pid>=pid_end) {
+              continue;
+            }
             const int lidpos = recv_lids_pidpos(irecv,1);
-            const int offset = f_pid_offsets(pid)+lidpos*ndims;
-            Kokkos::parallel_for(Kokkos::TeamVectorRange(team,ndims),
-                                 [&](const int idim) {
-              v(lid,idim) += buf (offset + idim);
-            });
+            if (pid==my_pid) {
+              const int ov_lid = send_lids_pids(self_beg+lidpos,0);
+              Kokkos::parallel_for(Kokkos::TeamVectorRange(team,ndims),
+                                   [&](const int idim) {
+                v(lid,idim) += ov_v(ov_lid,idim);
+              });
+            } else {
+              const int offset = f_pid_offsets(pid)+lidpos*ndims;
+              Kokkos::parallel_for(Kokkos::TeamVectorRange(team,ndims),
+                                   [&](const int idim) {
+                v(lid,idim) += buf (offset + idim);
+              });
+            }
           }
         });
       } break;
       case LayoutType::Scalar3D:
       {
         auto v = f.get_view<Real**>();
+        auto ov_v = ov.get_view<const Real**>();
         const int nlevs = fl.dims().back();
         auto policy = ESU::get_default_team_policy(num_tgt_dofs,nlevs);
         Kokkos::parallel_for(policy,
@@ -845,19 +951,30 @@ void CoarseningRemapper::recv_and_unpack ()
           const int recv_end = recv_lids_end(lid);
           for (int irecv=recv_beg; irecv<recv_end; ++irecv) {
             const int pid = recv_lids_pidpos(irecv,0);
+            if (pid<pid_beg || pid>=pid_end) {
+              continue;
+            }
             const int lidpos = recv_lids_pidpos(irecv,1);
-            const int offset = f_pid_offsets(pid) + lidpos*nlevs;
-
-            Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nlevs),
-                                 [&](const int ilev) {
-              v(lid,ilev) += buf (offset + ilev);
-            });
+            if (pid==my_pid) {
+              const int ov_lid = send_lids_pids(self_beg+lidpos,0);
+              Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nlevs),
+                                   [&](const int ilev) {
+                v(lid,ilev) += ov_v(ov_lid,ilev);
+              });
+            } else {
+              const int offset = f_pid_offsets(pid) + lidpos*nlevs;
+              Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nlevs),
+                                   [&](const int ilev) {
+                v(lid,ilev) += buf (offset + ilev);
+              });
+            }
           }
         });
       } break;
       case LayoutType::Vector3D:
       {
         auto v = f.get_view<Real***>();
+        auto ov_v = ov.get_view<const Real***>();
         const int ndims = fl.dim(1);
         const int nlevs = fl.dims().back();
         auto policy = ESU::get_default_team_policy(num_tgt_dofs,nlevs*ndims);
@@ -868,21 +985,33 @@ void CoarseningRemapper::recv_and_unpack ()
           const int recv_end = recv_lids_end(lid);
           for (int irecv=recv_beg; irecv<recv_end; ++irecv) {
             const int pid = recv_lids_pidpos(irecv,0);
+            if (pid<pid_beg || pid>=pid_end) {
+              continue;
+            }
             const int lidpos = recv_lids_pidpos(irecv,1);
-            const int offset = f_pid_offsets(pid) + lidpos*ndims*nlevs;
-
-            Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nlevs*ndims),
-                                 [&](const int idx) {
-              const int idim = idx / nlevs;
-              const int ilev = idx % nlevs;
-              v(lid,idim,ilev) += buf (offset + idim*nlevs + ilev);
-            });
+            if (pid==my_pid) {
+              const int ov_lid = send_lids_pids(self_beg+lidpos,0);
+              Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nlevs*ndims),
+                                   [&](const int idx) {
+                const int idim = idx / nlevs;
+                const int ilev = idx % nlevs;
+                v(lid,idim,ilev) += ov_v(ov_lid,idim,ilev);
+              });
+            } else {
+              const int offset = f_pid_offsets(pid) + lidpos*ndims*nlevs;
+              Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nlevs*ndims),
+                                   [&](const int idx) {
+                const int idim = idx / nlevs;
+                const int ilev = idx % nlevs;
+                v(lid,idim,ilev) += buf (offset + idim*nlevs + ilev);
+              });
+            }
           }
         });
       } break;
 
       default:
-        EKAT_ERROR_MSG ("Unexpected field rank in CoarseningRemapper::pack.\n"
+        EKAT_ERROR_MSG ("Unexpected field rank in CoarseningRemapper::unpack.\n"
             "  - MPI rank  : " + std::to_string(m_comm.rank()) + "\n"
             "  - field rank: " + std::to_string(fl.rank()) + "\n");
     }
@@ -1143,6 +1272,24 @@ void CoarseningRemapper::setup_mpi_data_structures ()
   }
   Kokkos::deep_copy(m_send_lids_pids,send_lids_pids_h);
   Kokkos::deep_copy(m_send_pid_lids_start,send_pid_lids_start_h);
+  m_send_self_beg = send_pid_lids_start_h(m_comm.rank());
+
+  // Order the ov_tgt rows so that those to send to other pids come first
+  const auto& self_lids = pid2lids_send[m_comm.rank()];
+  m_num_remote_ov_rows = num_ov_gids - self_lids.size();
+  m_ov_rows = view_1d<int>("",num_ov_gids);
+  auto ov_rows_h = Kokkos::create_mirror_view(m_ov_rows);
+  for (int pid=0,pos=0; pid<m_comm.size(); ++pid) {
+    if (pid!=m_comm.rank()) {
+      for (auto lid : pid2lids_send[pid]) {
+        ov_rows_h(pos++) = lid;
+      }
+    }
+  }
+  for (int i=0; i<static_cast<int>(self_lids.size()); ++i) {
+    ov_rows_h(m_num_remote_ov_rows+i) = self_lids[i];
+  }
+  Kokkos::deep_copy(m_ov_rows,ov_rows_h);
 
   // 3. Compute offsets in send buffer for each pid/field pair
   m_send_f_pid_offsets = view_2d<int>("",m_num_fields,m_comm.size());
@@ -1176,6 +1323,10 @@ void CoarseningRemapper::setup_mpi_data_structures ()
     }
 
     const int pid = it.first;
+    if (pid==m_comm.rank()) {
+      // Contributions to our own dofs are read directly from the ov_tgt fields
+      continue;
+    }
     const auto send_ptr = m_mpi_send_buffer.data() + send_pid_offsets[pid];
 
     m_send_req.emplace_back();
@@ -1269,12 +1420,16 @@ void CoarseningRemapper::setup_mpi_data_structures ()
   for (int pid=0; pid<m_comm.size(); ++pid) {
     const int num_recv_gids = recv_pid_start[pid+1] - recv_pid_start[pid];
     const int n = num_recv_gids*sum_fields_col_sizes;
-    if (n==0) {
+    if (n==0 || pid==m_comm.rank()) {
       continue;
     }
 
     const auto recv_ptr = m_mpi_recv_buffer.data() + recv_pid_offsets[pid];
 
+    m_recv_req_pids.push_back(pid);
+    m_recv_req_beg.push_back(recv_pid_offsets[pid]);
+    m_recv_req_end.push_back(recv_pid_offsets[pid]+n);
+
     m_recv_req.emplace_back();
     auto& req = m_recv_req.back();
     MPI_Recv_init (recv_ptr, n, mpi_real, pid,
@@ -1296,8 +1451,12 @@ void CoarseningRemapper::clean_up ()
   m_recv_lids_pidpos    = view_2d<int>();
   m_recv_lids_beg       = view_1d<int>();
   m_recv_lids_end       = view_1d<int>();
+  m_ov_rows             = view_1d<int>();
   m_send_req.clear();
   m_recv_req.clear();
+  m_recv_req_pids.clear();
+  m_recv_req_beg.clear();
+  m_recv_req_end.clear();
 
   // Clear all fields
   m_src_fields.clear();
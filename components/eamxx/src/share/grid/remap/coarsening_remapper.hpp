@@ -146,12 +146,18 @@ protected:
 #ifdef KOKKOS_ENABLE_CUDA
 public:
 #endif
+  // Compute the rows m_ov_rows(rows_beg),...,m_ov_rows(rows_end-1) of y=Ax
   template<int N>
-  void local_mat_vec (const Field& f_src, const Field& f_tgt, const Field* mask = nullptr) const;
+  void local_mat_vec (const Field& f_src, const Field& f_tgt,
+                      const int rows_beg, const int rows_end,
+                      const Field* mask = nullptr) const;
+  void local_mat_vec (const int rows_beg, const int rows_end) const;
   template<int N>
   void rescale_masked_fields (const Field& f_tgt, const Field& f_mask) const;
   void pack_and_send ();
   void recv_and_unpack ();
+  // Add to the tgt fields the contributions coming from PIDs in [pid_beg,pid_end)
+  void unpack (const int pid_beg, const int pid_end);
 
 protected:
   ekat::Comm            m_comm;
@@ -186,6 +192,13 @@ protected:
   view_1d<int>    m_col_lids;
   view_1d<Real>   m_weights;
 
+  // The rows of the matrix, with the m_num_remote_ov_rows rows that must be sent to
+  // other PIDs first, followed by the rows owned by this PID. We compute the former
+  // first, so that we can start sending them, and compute the latter while the
+  // messages are in flight. The rows owned by this PID are not sent through MPI.
+  view_1d<int>    m_ov_rows;
+  int             m_num_remote_ov_rows;
+
   // ------- MPI data structures -------- //
 
   // The send/recv buf for pack/unpack
@@ -213,6 +226,7 @@ protected:
 
   // Store the start of lids to send to each PID in the view above
   view_1d<int>          m_send_pid_lids_start;
+  int                   m_send_self_beg;
 
   // Unlike the packing for sends, unpacking after the recv can cause
   // race conditions. Hence, we ||ize of tgt lids, and process separate
@@ -234,6 +248,12 @@ protected:
   // Send/recv requests
   std::vector<MPI_Request>  m_recv_req;
   std::vector<MPI_Request>  m_send_req;
+
+  // For each recv request, the PID it receives from (in increasing order),
+  // and the beg/end of the portion of the recv buffer it fills
+  std::vector<int>          m_recv_req_pids;
+  std::vector<int>          m_recv_req_beg;
+  std::vector<int>          m_recv_req_end;
 };
 
 } // namespace scream
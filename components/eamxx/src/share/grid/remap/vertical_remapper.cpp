@@ -208,6 +208,11 @@ do_register_field (const identifier_type& src, const identifier_type& tgt)
   m_src_fields.push_back(field_type(src));
   field_type tgt_f(tgt);
   m_tgt_fields.push_back(tgt_f);
+
+  // Note: scorpio IO stages fields with other precisions in Real copies before remapping
+  EKAT_REQUIRE_MSG (src.data_type()==field_valid_data_types().at<Real>(),
+      "Error! Vertical remapper only works for Real data type.\n"
+      "  - field id: " + src.get_id_string() + "\n");
 }
 
 void VerticalRemapper::
@@ -3,12 +3,52 @@
 #include "ekat/ekat_parameter_list.hpp"
 #include "share/io/scream_scorpio_interface.hpp"
 
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+
+#include <algorithm>
 #include <memory>
 #include <numeric>
 
 namespace scream
 {
 
+namespace {
+
+// Where a staged field lives in the staging buffer, and how to scatter it
+// into the field (possibly padded) device view. Fields are seen as 2d arrays
+// of size (outer_size, last_dim), with a stride of last_extent between rows.
+struct StagedFieldInfo {
+  Real* data;
+  long  offset;
+  long  outer_size;
+  long  last_dim;
+  long  last_extent;
+};
+
+// Copy each staged field from the staging buffer into its (possibly padded)
+// view, with one team per field.
+template<typename ExeSpace, typename InfoView, typename StagingView>
+void scatter_staged_fields (const InfoView& infos, const StagingView& staging)
+{
+  using MemberType = typename Kokkos::TeamPolicy<ExeSpace>::member_type;
+
+  const int nstaged = infos.extent(0);
+  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(nstaged,1);
+  Kokkos::parallel_for("AtmosphereInput::scatter_staged_fields",policy,
+                       KOKKOS_LAMBDA(const MemberType& team) {
+    const auto& info = infos(team.league_rank());
+    const long n = info.outer_size*info.last_dim;
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,n),[&](const long idx) {
+      const long i = idx / info.last_dim;
+      const long j = idx % info.last_dim;
+      info.data[i*info.last_extent+j] = staging(info.offset+idx);
+    });
+  });
+  Kokkos::fence();
+}
+
+} // anonymous namespace
+
 /* ---------------------------------------------------------- */
 AtmosphereInput::
 AtmosphereInput (const ekat::Comm& comm,
@@ -120,6 +160,24 @@ set_field_manager (const std::shared_ptr<const fm_type>& field_mgr,
 
   m_field_mgr = field_mgr;
 
+  // Fields with non-Real precision are read into Real copies, then converted
+  for (const auto& fname : m_fields_names) {
+    const auto f = m_field_mgr->get_field(fname);
+    const auto& fid = f.get_header().get_identifier();
+    if (fid.data_type()==DataType::RealType) {
+      continue;
+    }
+    EKAT_REQUIRE_MSG (fid.data_type()!=DataType::IntType,
+        "Error! I/O supports only floating point data, for now.\n"
+        "  - field id: " + fid.get_id_string() + "\n");
+
+    Field copy(FieldIdentifier(fname,fid.get_layout(),fid.get_units(),fid.get_grid_name()));
+    const auto& ap = f.get_header().get_alloc_properties();
+    copy.get_header().get_alloc_properties().request_allocation(ap.get_largest_pack_size());
+    copy.allocate_view();
+    m_real_copies.emplace(fname,std::make_pair(f,copy));
+  }
+
   std::shared_ptr<const grid_type> fm_grid, io_grid;
   io_grid = fm_grid = m_field_mgr->get_grid();
 
@@ -131,7 +189,8 @@ set_field_manager (const std::shared_ptr<const fm_type>& field_mgr,
     // Register all input fields in the remapper.
     m_remapper->registration_begins();
     for (const auto& fname : m_fields_names) {
-      auto f = m_field_mgr->get_field(fname);
+      auto f = m_real_copies.count(fname)==1 ? m_real_copies.at(fname).second
+                                             : m_field_mgr->get_field(fname);
       const auto& tgt_fid = f.get_header().get_identifier();
       EKAT_REQUIRE_MSG(tgt_fid.data_type()==DataType::RealType,
           "Error! I/O supports only Real data, for now.\n");
@@ -151,7 +210,8 @@ set_field_manager (const std::shared_ptr<const fm_type>& field_mgr,
     // Now that fields have been allocated on the io grid, we can bind them in the remapper
     for (const auto& fname : m_fields_names) {
       auto src = io_fm->get_field(fname);
-      auto tgt = m_field_mgr->get_field(fname);
+      auto tgt = m_real_copies.count(fname)==1 ? m_real_copies.at(fname).second
+                                               : m_field_mgr->get_field(fname);
       m_remapper->bind_field(src,tgt);
     }
 
@@ -174,28 +234,54 @@ set_field_manager (const std::shared_ptr<const fm_type>& field_mgr,
 
 void AtmosphereInput::
 register_fields_specs() {
+  // Stage all fields that are not subfields. We need the decomp tags
+  // (hence the io grid) in order to group fields by decomposition.
+  std::vector<std::pair<std::string,std::string>> staged;
   for (auto const& name : m_fields_names) {
-    auto f = m_field_mgr->get_field(name);
+    auto f = get_field(name);
     const auto& fh  = f.get_header();
-    const auto& fap = fh.get_alloc_properties();
     const auto& fid = fh.get_identifier();
     const auto& fl  = fid.get_layout();
 
     // Store the layout
     m_layouts.emplace(name,fl);
 
-    // If we can alias the field's host view, do it.
-    // Otherwise, create a temporary.
-    bool can_alias_field_view = fh.get_parent().expired() && fap.get_padding()==0;
-    if (can_alias_field_view) {
-      auto data = f.get_internal_view_data<Real,Host>();
-      m_host_views_1d[name] = view_1d_host(data,fl.size());
+    if (fh.get_parent().expired()) {
+      staged.emplace_back(get_io_decomp(fl),name);
     } else {
-      // We have padding, or the field is a subfield (or both).
-      // Either way, we need a temporary view.
+      // The field is a subfield, so we need a temporary view,
+      // which will be copied into the field on host.
       m_host_views_1d[name] = view_1d_host("",fl.size());
     }
   }
+
+  // Group staged fields by decomposition, preserving the input order otherwise
+  std::stable_sort(staged.begin(),staged.end(),
+      [](const std::pair<std::string,std::string>& a,
+         const std::pair<std::string,std::string>& b) {
+        return a.first<b.first;
+      });
+
+  // Split the staged fields (in read order) into chunks that fit in a staging
+  // buffer as large as the largest staged field. Big fields are then staged one
+  // at a time, while small ones (e.g., 2d fields) are still batched together.
+  m_staging_size = 0;
+  for (const auto& it : staged) {
+    m_staging_size = std::max<long>(m_staging_size,m_layouts.at(it.second).size());
+  }
+  long chunk_size = 0;
+  for (const auto& it : staged) {
+    const auto& name = it.second;
+    const long size = m_layouts.at(name).size();
+    if (m_staging_chunks.empty() || chunk_size+size>m_staging_size) {
+      m_staging_chunks.emplace_back();
+      chunk_size = 0;
+    }
+    m_staged_fields_names.push_back(name);
+    m_staging_chunks.back().push_back(name);
+    m_staging_offsets[name] = chunk_size;
+    chunk_size += size;
+  }
 }
 
 /* ---------------------------------------------------------- */
@@ -240,121 +326,191 @@ void AtmosphereInput::read_variables (const int time_index)
   EKAT_REQUIRE_MSG (m_inited_with_views || m_inited_with_fields,
       "Error! Scorpio structures not inited yet. Did you forget to call 'init(..)'?\n");
 
-  for (auto const& name : m_fields_names) {
+  // The staging buffer only lives for the duration of this call, so that it
+  // does not take memory in between reads. It is reused for all chunks.
+  view_1d_dev  staging_dev;
+  view_1d_host staging_host;
+  if (m_staging_size>0) {
+    staging_dev  = view_1d_dev("input_staging",m_staging_size);
+    staging_host = Kokkos::create_mirror_view(staging_dev);
+  }
+
+  for (const auto& chunk : m_staging_chunks) {
+    read_staged_chunk(chunk,time_index,staging_dev,staging_host);
+  }
 
-    // Read the data
+  // Other fields (e.g., subfields) are read in a host view. If we have a field
+  // manager, they are then copied into the field on host, and synced to device.
+  for (auto const& name : m_read_order) {
+    if (m_staging_offsets.count(name)==1) {
+      continue;
+    }
     auto v1d = m_host_views_1d.at(name);
     scorpio::grid_read_data_array(m_filename,name,time_index,v1d.data(),v1d.size());
-
-    // If we have a field manager, make sure the data is correctly
-    // synced to both host and device views of the field.
     if (m_field_mgr) {
-
-      auto f = m_field_mgr->get_field(name);
-      const auto& fh  = f.get_header();
-      const auto& fl  = fh.get_identifier().get_layout();
-      const auto& fap = fh.get_alloc_properties();
-
-      // Check if the stored 1d view is sharing the data ptr with the field
-      const bool can_alias_field_view = fh.get_parent().expired() && fap.get_padding()==0;
-
-      // If the 1d view is a simple reshape of the field's Host view data,
-      // then we're already done. Otherwise, we need to manually copy.
-      if (not can_alias_field_view) {
-        // Get the host view of the field properly reshaped, and deep copy
-        // from temp_view (properly reshaped as well).
-        auto rank = fl.rank();
-        auto view_1d = m_host_views_1d.at(name);
-        switch (rank) {
-          case 1:
-            {
-              // No reshape needed, simply copy
-              auto dst = f.get_view<Real*,Host>();
-              for (int i=0; i<fl.dim(0); ++i) {
-                dst(i) = view_1d(i);
-              }
-              break;
-            }
-          case 2:
-            {
-              // Reshape temp_view to a 2d view, then copy
-              auto dst = f.get_view<Real**,Host>();
-              auto src = view_Nd_host<2>(view_1d.data(),fl.dim(0),fl.dim(1));
-              for (int i=0; i<fl.dim(0); ++i) {
-                for (int j=0; j<fl.dim(1); ++j) {
-                  dst(i,j) = src(i,j);
-              }}
-              break;
-            }
-          case 3:
-            {
-              // Reshape temp_view to a 3d view, then copy
-              auto dst = f.get_view<Real***,Host>();
-              auto src = view_Nd_host<3>(view_1d.data(),fl.dim(0),fl.dim(1),fl.dim(2));
-              for (int i=0; i<fl.dim(0); ++i) {
-                for (int j=0; j<fl.dim(1); ++j) {
-                  for (int k=0; k<fl.dim(2); ++k) {
-                    dst(i,j,k) = src(i,j,k);
-              }}}
-              break;
-            }
-          case 4:
-            {
-              // Reshape temp_view to a 4d view, then copy
-              auto dst = f.get_view<Real****,Host>();
-              auto src = view_Nd_host<4>(view_1d.data(),fl.dim(0),fl.dim(1),fl.dim(2),fl.dim(3));
-              for (int i=0; i<fl.dim(0); ++i) {
-                for (int j=0; j<fl.dim(1); ++j) {
-                  for (int k=0; k<fl.dim(2); ++k) {
-                    for (int l=0; l<fl.dim(3); ++l) {
-                      dst(i,j,k,l) = src(i,j,k,l);
-              }}}}
-              break;
-            }
-          case 5:
-            {
-              // Reshape temp_view to a 5d view, then copy
-              auto dst = f.get_view<Real*****,Host>();
-              auto src = view_Nd_host<5>(view_1d.data(),fl.dim(0),fl.dim(1),fl.dim(2),fl.dim(3),fl.dim(4));
-              for (int i=0; i<fl.dim(0); ++i) {
-                for (int j=0; j<fl.dim(1); ++j) {
-                  for (int k=0; k<fl.dim(2); ++k) {
-                    for (int l=0; l<fl.dim(3); ++l) {
-                      for (int m=0; m<fl.dim(4); ++m) {
-                        dst(i,j,k,l,m) = src(i,j,k,l,m);
-              }}}}}
-              break;
-            }
-          case 6:
-            {
-              // Reshape temp_view to a 6d view, then copy
-              auto dst = f.get_view<Real******,Host>();
-              auto src = view_Nd_host<6>(view_1d.data(),fl.dim(0),fl.dim(1),fl.dim(2),fl.dim(3),fl.dim(4),fl.dim(5));
-              for (int i=0; i<fl.dim(0); ++i) {
-                for (int j=0; j<fl.dim(1); ++j) {
-                  for (int k=0; k<fl.dim(2); ++k) {
-                    for (int l=0; l<fl.dim(3); ++l) {
-                      for (int m=0; m<fl.dim(4); ++m) {
-                        for (int n=0; n<fl.dim(5); ++n) {
-                          dst(i,j,k,l,m,n) = src(i,j,k,l,m,n);
-              }}}}}}
-              break;
-            }
-          default:
-            EKAT_ERROR_MSG ("Error! Unexpected field rank (" + std::to_string(rank) + ").\n");
-        }
-      }
-
-      // Sync to device
-      f.sync_to_dev();
+      copy_to_field_host(name);
+      get_field(name).sync_to_dev();
     }
   }
 
   if (m_remapper) {
     m_remapper->remap(true);
   }
+
+  // Convert Real copies to the precision of the actual fields
+  for (auto& it : m_real_copies) {
+    it.second.first.deep_copy(it.second.second);
+  }
 } 
 
+/* ---------------------------------------------------------- */
+void AtmosphereInput::
+read_staged_chunk (const std::vector<std::string>& names, const int time_index,
+                   const view_1d_dev& staging_dev, const view_1d_host& staging_host)
+{
+  long chunk_size = 0;
+  for (const auto& name : names) {
+    const long size = m_layouts.at(name).size();
+    scorpio::grid_read_data_array(m_filename,name,time_index,
+                                  staging_host.data()+m_staging_offsets.at(name),size);
+    chunk_size += size;
+  }
+
+  // Upload the chunk at once, then scatter it into the fields. Also scatter it
+  // into the host views (if they are not the device ones), so that host views
+  // are up to date after the read, as for other fields.
+  const int nstaged = names.size();
+  using info_view_t = typename KT::template view_1d<StagedFieldInfo>;
+  info_view_t infos("staged_fields_infos",nstaged);
+  auto infos_h    = Kokkos::create_mirror_view(infos);
+  auto infos_host = Kokkos::create_mirror(infos);
+  for (int i=0; i<nstaged; ++i) {
+    const auto& name = names[i];
+    auto f = get_field(name);
+    const auto& fh  = f.get_header();
+    const auto& fl  = fh.get_identifier().get_layout();
+    const auto& fap = fh.get_alloc_properties();
+
+    auto& info = infos_h(i);
+    info.data        = f.get_internal_view_data<Real>();
+    info.offset      = m_staging_offsets.at(name);
+    info.last_dim    = fl.rank()==0 ? 1 : fl.dims().back();
+    info.outer_size  = fl.size() / info.last_dim;
+    info.last_extent = fl.rank()==0 ? 1 : fap.get_last_extent();
+
+    infos_host(i) = info;
+    infos_host(i).data = f.get_internal_view_data<Real,Host>();
+  }
+  Kokkos::deep_copy(infos,infos_h);
+
+  const std::pair<long,long> range(0,chunk_size);
+  Kokkos::deep_copy(Kokkos::subview(staging_dev,range),Kokkos::subview(staging_host,range));
+
+  scatter_staged_fields<typename KT::ExeSpace>(infos,staging_dev);
+  if (staging_host.data()!=staging_dev.data()) {
+    scatter_staged_fields<Kokkos::DefaultHostExecutionSpace>(infos_host,staging_host);
+  }
+}
+
+/* ---------------------------------------------------------- */
+Field AtmosphereInput::get_field (const std::string& name) const
+{
+  // If we remap, m_field_mgr is the (all Real) field manager on the io grid
+  if (m_remapper==nullptr && m_real_copies.count(name)==1) {
+    return m_real_copies.at(name).second;
+  }
+  return m_field_mgr->get_field(name);
+}
+
+/* ---------------------------------------------------------- */
+void AtmosphereInput::copy_to_field_host (const std::string& name)
+{
+  // Get the host view of the field properly reshaped, and deep copy
+  // from temp_view (properly reshaped as well).
+  auto f = get_field(name);
+  const auto& fl = f.get_header().get_identifier().get_layout();
+  auto rank = fl.rank();
+  auto view_1d = m_host_views_1d.at(name);
+  switch (rank) {
+    case 1:
+      {
+        // No reshape needed, simply copy
+        auto dst = f.get_view<Real*,Host>();
+        for (int i=0; i<fl.dim(0); ++i) {
+          dst(i) = view_1d(i);
+        }
+        break;
+      }
+    case 2:
+      {
+        // Reshape temp_view to a 2d view, then copy
+        auto dst = f.get_view<Real**,Host>();
+        auto src = view_Nd_host<2>(view_1d.data(),fl.dim(0),fl.dim(1));
+        for (int i=0; i<fl.dim(0); ++i) {
+          for (int j=0; j<fl.dim(1); ++j) {
+            dst(i,j) = src(i,j);
+        }}
+        break;
+      }
+    case 3:
+      {
+        // Reshape temp_view to a 3d view, then copy
+        auto dst = f.get_view<Real***,Host>();
+        auto src = view_Nd_host<3>(view_1d.data(),fl.dim(0),fl.dim(1),fl.dim(2));
+        for (int i=0; i<fl.dim(0); ++i) {
+          for (int j=0; j<fl.dim(1); ++j) {
+            for (int k=0; k<fl.dim(2); ++k) {
+              dst(i,j,k) = src(i,j,k);
+        }}}
+        break;
+      }
+    case 4:
+      {
+        // Reshape temp_view to a 4d view, then copy
+        auto dst = f.get_view<Real****,Host>();
+        auto src = view_Nd_host<4>(view_1d.data(),fl.dim(0),fl.dim(1),fl.dim(2),fl.dim(3));
+        for (int i=0; i<fl.dim(0); ++i) {
+          for (int j=0; j<fl.dim(1); ++j) {
+            for (int k=0; k<fl.dim(2); ++k) {
+              for (int l=0; l<fl.dim(3); ++l) {
+                dst(i,j,k,l) = src(i,j,k,l);
+        }}}}
+        break;
+      }
+    case 5:
+      {
+        // Reshape temp_view to a 5d view, then copy
+        auto dst = f.get_view<Real*****,Host>();
+        auto src = view_Nd_host<5>(view_1d.data(),fl.dim(0),fl.dim(1),fl.dim(2),fl.dim(3),fl.dim(4));
+        for (int i=0; i<fl.dim(0); ++i) {
+          for (int j=0; j<fl.dim(1); ++j) {
+            for (int k=0; k<fl.dim(2); ++k) {
+              for (int l=0; l<fl.dim(3); ++l) {
+                for (int m=0; m<fl.dim(4); ++m) {
+                  dst(i,j,k,l,m) = src(i,j,k,l,m);
+        }}}}}
+        break;
+      }
+    case 6:
+      {
+        // Reshape temp_view to a 6d view, then copy
+        auto dst = f.get_view<Real******,Host>();
+        auto src = view_Nd_host<6>(view_1d.data(),fl.dim(0),fl.dim(1),fl.dim(2),fl.dim(3),fl.dim(4),fl.dim(5));
+        for (int i=0; i<fl.dim(0); ++i) {
+          for (int j=0; j<fl.dim(1); ++j) {
+            for (int k=0; k<fl.dim(2); ++k) {
+              for (int l=0; l<fl.dim(3); ++l) {
+                for (int m=0; m<fl.dim(4); ++m) {
+                  for (int n=0; n<fl.dim(5); ++n) {
+                    dst(i,j,k,l,m,n) = src(i,j,k,l,m,n);
+        }}}}}}
+        break;
+      }
+    default:
+      EKAT_ERROR_MSG ("Error! Unexpected field rank (" + std::to_string(rank) + ").\n");
+  }
+}
+
 int AtmosphereInput::
 read_int_scalar (const std::string& name)
 {
@@ -401,6 +557,12 @@ void AtmosphereInput::finalize()
   m_host_views_1d.clear();
   m_layouts.clear();
 
+  m_staging_size = 0;
+  m_staging_offsets.clear();
+  m_staging_chunks.clear();
+  m_staged_fields_names.clear();
+  m_read_order.clear();
+
   m_inited_with_views = false;
   m_inited_with_fields = false;
 } // finalize
@@ -423,6 +585,16 @@ void AtmosphereInput::register_variables()
   // This allows SCORPIO to lookup vars in the nc file with the correct
   // dof decomposition across different ranks.
 
+  // Read fields grouped by decomposition, so that PIO can reuse the
+  // same rearranger setup for consecutive reads. Staged fields are
+  // already grouped; other fields are read after them.
+  m_read_order = m_staged_fields_names;
+  for (auto const& name : m_fields_names) {
+    if (m_staging_offsets.count(name)==0) {
+      m_read_order.push_back(name);
+    }
+  }
+
   // Cycle through all fields
   const auto& fp_precision = "real";
   for (auto const& name : m_fields_names) {
@@ -484,8 +656,15 @@ void AtmosphereInput::set_degrees_of_freedom()
 {
   // For each field, tell PIO the offset of each DOF to be read.
   // Here, offset is meant in the *global* array in the nc file.
+  // Fields with the same decomposition have the same offsets,
+  // so compute them only once per decomposition.
+  std::map<std::string,std::vector<scorpio::offset_t>> decomp_dofs;
   for (auto const& name : m_fields_names) {
-    auto var_dof = get_var_dof_offsets(m_layouts.at(name));
+    const auto& layout = m_layouts.at(name);
+    auto& var_dof = decomp_dofs[get_io_decomp(layout)];
+    if (var_dof.size()==0) {
+      var_dof = get_var_dof_offsets(layout);
+    }
     scorpio::set_dof(m_filename,name,var_dof.size(),var_dof.data());
   }
 } // set_degrees_of_freedom
@@ -49,6 +49,18 @@
  *    Fields:
  *      $GRID: [field_name1,...,field_name_N]
  *
+ *  When reading into FieldManager-owned fields, all fields that are not subfields
+ *  of another field are read through a host staging buffer, grouped by IO
+ *  decomposition (so that fields sharing a layout are read back to back with the
+ *  same PIO decomposition). The staging buffer is as large as the largest of these
+ *  fields, and fields are staged in chunks that fit in it: each chunk is uploaded
+ *  to device with a single deep copy, and scattered into the (possibly padded)
+ *  fields by a single kernel. Small fields are thus batched, while the extra memory
+ *  is bounded by the size of one field. The host views of the fields are updated
+ *  as well, so both host and device views are in sync after read_variables. The
+ *  staging buffer is only allocated during read_variables. Subfields are still
+ *  copied one at a time on host.
+ *
  *  TODO: add a rename option if variable names differ in file and field manager.
  *
  * --------------------------------------------------------------------------------
@@ -71,6 +83,7 @@ public:
   template<int N>
   using view_Nd_host = typename KT::template view_ND<Real,N>::HostMirror;
   using view_1d_host = view_Nd_host<1>;
+  using view_1d_dev  = typename KT::template view_1d<Real>;
 
   // --- Constructor(s) & Destructor --- //
   // Creates bare input. Will require a call to one of the two 'init' methods.
@@ -146,6 +159,13 @@ protected:
   void init_scorpio_structures ();
 
   void register_fields_specs ();
+  void copy_to_field_host (const std::string& name);
+  void read_staged_chunk (const std::vector<std::string>& names, const int time_index,
+                          const view_1d_dev& staging_dev, const view_1d_host& staging_host);
+
+  // The field data is read into: the Real copy of the field (see m_real_copies)
+  // if any, otherwise the field itself.
+  Field get_field (const std::string& name) const;
 
   void register_variables();
   void set_degrees_of_freedom();
@@ -162,13 +182,29 @@ protected:
   std::shared_ptr<const AbstractGrid>   m_io_grid;
   std::shared_ptr<remapper_type>        m_remapper;
 
+  // Fields stored with a precision other than Real, and the Real copies that
+  // are read (and remapped, if needed). Fields are updated at the end of read_variables.
+  std::map<std::string,std::pair<Field,Field>> m_real_copies;
+
   std::map<std::string, view_1d_host>   m_host_views_1d;
   std::map<std::string, FieldLayout>    m_layouts;
+
+  // Staging for batched reads (see class documentation). Fields in
+  // m_staged_fields_names are read, one chunk of m_staging_chunks at a time,
+  // into a staging buffer of m_staging_size Reals, at the offset (within
+  // their chunk) stored in m_staging_offsets.
+  long                                  m_staging_size = 0;
+  std::map<std::string, long>           m_staging_offsets;
+  std::vector<std::vector<std::string>> m_staging_chunks;
+  std::vector<std::string>              m_staged_fields_names;
   
   std::string               m_filename;
   std::string               m_io_grid_name;
   std::vector<std::string>  m_fields_names;
 
+  // Same as m_fields_names, but sorted by IO decomposition tag
+  std::vector<std::string>  m_read_order;
+
   bool m_inited_with_fields        = false;
   bool m_inited_with_views         = false;
 }; // Class AtmosphereInput
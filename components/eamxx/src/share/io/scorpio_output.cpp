@@ -11,6 +11,8 @@
 
 #include <numeric>
 #include <fstream>
+#include <limits>
+#include <set>
 
 namespace scream
 {
@@ -62,6 +64,7 @@ AtmosphereOutput (const ekat::Comm& comm,
   for (auto f : fields) {
     m_fields_names.push_back(f.name());
   }
+  create_real_copies (fm);
 
   set_grid (grid);
   set_field_manager (fm,"io");
@@ -129,6 +132,41 @@ AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
         "Error! Bad formatting of output yaml file. Missing 'Fields->$grid_name` sublist.\n");
   }
 
+  // Check if the user wants compressed output
+  if (params.isSublist("Compression")) {
+    const auto& c_pl = params.sublist("Compression");
+    if (c_pl.isParameter("Deflate Level")) {
+      m_deflate_level = c_pl.get<int>("Deflate Level");
+    }
+    if (c_pl.isParameter("Shuffle")) {
+      m_shuffle = c_pl.get<bool>("Shuffle");
+    }
+    EKAT_REQUIRE_MSG (m_deflate_level>=0 && m_deflate_level<=9,
+        "Error! Invalid deflate level. Valid range: [0,9].\n"
+        "  - Deflate Level: " + std::to_string(m_deflate_level) + "\n");
+
+    const int nsd = c_pl.isParameter("Significant Digits") ? c_pl.get<int>("Significant Digits") : 0;
+    for (const auto& name : m_fields_names) {
+      int field_nsd = nsd;
+      if (c_pl.isSublist("Fields Significant Digits")) {
+        const auto& nsd_pl = c_pl.sublist("Fields Significant Digits");
+        if (nsd_pl.isParameter(name)) {
+          field_nsd = nsd_pl.get<int>(name);
+        }
+      }
+      EKAT_REQUIRE_MSG (field_nsd>=0,
+          "Error! Number of significant digits cannot be negative.\n"
+          "  - field name: " + name + "\n"
+          "  - significant digits: " + std::to_string(field_nsd) + "\n");
+      if (field_nsd>0) {
+        m_significant_digits[name] = field_nsd;
+      }
+    }
+  }
+
+  // Fields with non-Real precision are read via Real copies
+  create_real_copies (field_mgr);
+
   // Check if remapping and if so create the appropriate remapper 
   // Note: We currently support three remappers
   //   - vertical remapping from file
@@ -312,10 +350,10 @@ void AtmosphereOutput::restart (const std::string& filename)
   AtmosphereInput hist_restart (res_params,m_io_grid,m_host_views_1d,m_layouts);
   hist_restart.read_variables();
   hist_restart.finalize();
-  for (auto& it : m_host_views_1d) {
+  for (auto& it : m_dev_views_1d) {
     const auto& name = it.first;
-    const auto& host = it.second;
-    const auto& dev  = m_dev_views_1d.at(name);
+    const auto& dev  = it.second;
+    const auto& host = m_host_views_1d.at(name);
     Kokkos::deep_copy(dev,host);
   }
 }
@@ -342,10 +380,16 @@ void AtmosphereOutput::run (const std::string& filename, const bool is_write_ste
 
   using namespace scream::scorpio;
 
+  // Update Real copies of fields stored with a different precision
+  update_real_copies();
+
   // Update all diagnostics, we need to do this before applying the remapper
   // to make sure that the remapped fields are the most up to date.
   // First we reset the diag computed map so that all diags are recomputed.
   m_diag_computed.clear();
+  if (m_column_integrals.size()>1) {
+    ColumnIntegralDiagnostic::compute_grouped(m_column_integrals);
+  }
   for (auto& it : m_diagnostics) {
     compute_diagnostic(it.first);
   }
@@ -378,6 +422,27 @@ void AtmosphereOutput::run (const std::string& filename, const bool is_write_ste
     stop_timer("EAMxx::IO::horiz_remap");
   }
 
+  // Fields with no running-tally view are synced to host (on write steps only).
+  // Subfields share the allocation of their parent, so we make sure to sync
+  // each allocation only once.
+  std::set<const Real*> synced_allocs;
+
+  // Quantize the host buffer (if requested, and if allowed for this file), then write.
+  const bool lossy = m_lossy_files.count(filename)==1;
+  // Note: masked entries (e.g., from vertical remap) hold a fill value, which must be preserved,
+  //       so we use the same default mask value as the remappers.
+  auto write_host_view = [&](const std::string& name, const Field& field, const view_1d_host& view_host) {
+    if (lossy && m_significant_digits.count(name)==1) {
+      const auto& extra = field.get_header().get_extra_data();
+      Real fill_value = std::numeric_limits<float>::max()/10.0;
+      if (extra.count("mask_value")) {
+        fill_value = ekat::any_cast<Real>(extra.at("mask_value"));
+      }
+      quantize_significant_digits(view_host.data(),view_host.size(),m_significant_digits.at(name),fill_value);
+    }
+    grid_write_data_array(filename,name,view_host.data(),view_host.size());
+  };
+
   // Take care of updating and possibly writing fields.
   for (auto const& name : m_fields_names) {
     // Get all the info for this field.
@@ -390,93 +455,98 @@ void AtmosphereOutput::run (const std::string& filename, const bool is_write_ste
     EKAT_REQUIRE_MSG (!m_add_time_dim || field.get_header().get_tracking().get_time_stamp().is_valid(),
         "Error! Time-dependent output field '" + name + "' has not been initialized yet\n.");
 
-    const bool is_diagnostic = (m_diagnostics.find(name) != m_diagnostics.end());
-    const bool is_aliasing_field_view =
-        m_avg_type==OutputAvgType::Instant &&
-        field.get_header().get_alloc_properties().get_padding()==0 &&
-        field.get_header().get_parent().expired() &&
-        not is_diagnostic;
+    // Instant output of non-diagnostic fields needs no running tally on device:
+    // we read straight from the field on write steps (see register_views).
+    if (m_dev_views_1d.count(name)==0) {
+      if (is_write_step) {
+        if (synced_allocs.insert(field.get_internal_view_data<const Real,Device>()).second) {
+          field.sync_to_host();
+        }
+        auto view_host = m_host_views_1d.at(name);
+        if (view_host.data()!=field.get_internal_view_data<const Real,Host>()) {
+          // Padded field or subfield: gather the strided data into the IO buffer
+          gather_field_host(name,field);
+        }
+        write_host_view(name,field,view_host);
+      }
+      continue;
+    }
 
     // Manually update the 'running-tally' views with data from the field,
     // by combining new data with current avg values.
-    // NOTE: this is skipped for instant output, if IO view is aliasing Field view.
     auto view_dev = m_dev_views_1d.at(name);
     auto data = view_dev.data();
     KT::RangePolicy policy(0,layout.size());
     const auto extents = layout.extents();
 
     auto avg_type = m_avg_type;
-    // If the dev_view_1d is aliasing the field device view (must be Instant output),
-    // then there's no point in copying from the field's view to dev_view
-    if (not is_aliasing_field_view) {
-      switch (rank) {
-        case 1:
-        {
-          auto new_view_1d = field.get_view<const Real*,Device>();
-          auto avg_view_1d = view_Nd_dev<1>(data,dims[0]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
-            combine(new_view_1d(i), avg_view_1d(i),avg_type);
-          });
-          break;
-        }
-        case 2:
-        {
-          auto new_view_2d = field.get_view<const Real**,Device>();
-          auto avg_view_2d = view_Nd_dev<2>(data,dims[0],dims[1]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j;
-            unflatten_idx(idx,extents,i,j);
-            combine(new_view_2d(i,j), avg_view_2d(i,j),avg_type);
-          });
-          break;
-        }
-        case 3:
-        {
-          auto new_view_3d = field.get_view<const Real***,Device>();
-          auto avg_view_3d = view_Nd_dev<3>(data,dims[0],dims[1],dims[2]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j,k;
-            unflatten_idx(idx,extents,i,j,k);
-            combine(new_view_3d(i,j,k), avg_view_3d(i,j,k),avg_type);
-          });
-          break;
-        }
-        case 4:
-        {
-          auto new_view_4d = field.get_view<const Real****,Device>();
-          auto avg_view_4d = view_Nd_dev<4>(data,dims[0],dims[1],dims[2],dims[3]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j,k,l;
-            unflatten_idx(idx,extents,i,j,k,l);
-            combine(new_view_4d(i,j,k,l), avg_view_4d(i,j,k,l),avg_type);
-          });
-          break;
-        }
-        case 5:
-        {
-          auto new_view_5d = field.get_view<const Real*****,Device>();
-          auto avg_view_5d = view_Nd_dev<5>(data,dims[0],dims[1],dims[2],dims[3],dims[4]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j,k,l,m;
-            unflatten_idx(idx,extents,i,j,k,l,m);
-            combine(new_view_5d(i,j,k,l,m), avg_view_5d(i,j,k,l,m),avg_type);
-          });
-          break;
-        }
-        case 6:
-        {
-          auto new_view_6d = field.get_view<const Real******,Device>();
-          auto avg_view_6d = view_Nd_dev<6>(data,dims[0],dims[1],dims[2],dims[3],dims[4],dims[5]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j,k,l,m,n;
-            unflatten_idx(idx,extents,i,j,k,l,m,n);
-            combine(new_view_6d(i,j,k,l,m,n), avg_view_6d(i,j,k,l,m,n),avg_type);
-          });
-          break;
-        }
-        default:
-          EKAT_ERROR_MSG ("Error! Field rank (" + std::to_string(rank) + ") not supported by AtmosphereOutput.\n");
+    switch (rank) {
+      case 1:
+      {
+        auto new_view_1d = field.get_view<const Real*,Device>();
+        auto avg_view_1d = view_Nd_dev<1>(data,dims[0]);
+        Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
+          combine(new_view_1d(i), avg_view_1d(i),avg_type);
+        });
+        break;
       }
+      case 2:
+      {
+        auto new_view_2d = field.get_view<const Real**,Device>();
+        auto avg_view_2d = view_Nd_dev<2>(data,dims[0],dims[1]);
+        Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
+          int i,j;
+          unflatten_idx(idx,extents,i,j);
+          combine(new_view_2d(i,j), avg_view_2d(i,j),avg_type);
+        });
+        break;
+      }
+      case 3:
+      {
+        auto new_view_3d = field.get_view<const Real***,Device>();
+        auto avg_view_3d = view_Nd_dev<3>(data,dims[0],dims[1],dims[2]);
+        Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
+          int i,j,k;
+          unflatten_idx(idx,extents,i,j,k);
+          combine(new_view_3d(i,j,k), avg_view_3d(i,j,k),avg_type);
+        });
+        break;
+      }
+      case 4:
+      {
+        auto new_view_4d = field.get_view<const Real****,Device>();
+        auto avg_view_4d = view_Nd_dev<4>(data,dims[0],dims[1],dims[2],dims[3]);
+        Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
+          int i,j,k,l;
+          unflatten_idx(idx,extents,i,j,k,l);
+          combine(new_view_4d(i,j,k,l), avg_view_4d(i,j,k,l),avg_type);
+        });
+        break;
+      }
+      case 5:
+      {
+        auto new_view_5d = field.get_view<const Real*****,Device>();
+        auto avg_view_5d = view_Nd_dev<5>(data,dims[0],dims[1],dims[2],dims[3],dims[4]);
+        Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
+          int i,j,k,l,m;
+          unflatten_idx(idx,extents,i,j,k,l,m);
+          combine(new_view_5d(i,j,k,l,m), avg_view_5d(i,j,k,l,m),avg_type);
+        });
+        break;
+      }
+      case 6:
+      {
+        auto new_view_6d = field.get_view<const Real******,Device>();
+        auto avg_view_6d = view_Nd_dev<6>(data,dims[0],dims[1],dims[2],dims[3],dims[4],dims[5]);
+        Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
+          int i,j,k,l,m,n;
+          unflatten_idx(idx,extents,i,j,k,l,m,n);
+          combine(new_view_6d(i,j,k,l,m,n), avg_view_6d(i,j,k,l,m,n),avg_type);
+        });
+        break;
+      }
+      default:
+        EKAT_ERROR_MSG ("Error! Field rank (" + std::to_string(rank) + ") not supported by AtmosphereOutput.\n");
     }
 
     if (is_write_step) {
@@ -489,7 +559,7 @@ void AtmosphereOutput::run (const std::string& filename, const bool is_write_ste
       // Bring data to host
       auto view_host = m_host_views_1d.at(name);
       Kokkos::deep_copy (view_host,view_dev);
-      grid_write_data_array(filename,name,view_host.data(),view_host.size());
+      write_host_view(name,field,view_host);
     }
   }
 } // run
@@ -522,17 +592,10 @@ res_dep_memory_footprint () const {
     }
   }
 
-  const auto io_field_mgr = get_field_manager("io");
-  for (const auto& fn : m_fields_names) {
-    bool is_diagnostic = (m_diagnostics.find(fn) != m_diagnostics.end());
-    bool can_alias_field_view =
-        m_avg_type==OutputAvgType::Instant && not is_diagnostic &&
-        io_field_mgr->get_field(fn).get_header().get_alloc_properties().get_padding()==0 &&
-        io_field_mgr->get_field(fn).get_header().get_parent().expired();
-
-    if (not can_alias_field_view) {
-      rdmf += m_dev_views_1d.size()*sizeof(Real);
-    }
+  // Only running-tally views are allocated on device. Host-only IO buffers
+  // (for padded/subfield Instant output) are not counted.
+  for (const auto& it : m_dev_views_1d) {
+    rdmf += it.second.size()*sizeof(Real);
   }
 
   return rdmf;
@@ -634,33 +697,37 @@ void AtmosphereOutput::register_views()
     auto field = get_field(name,"io");
     bool is_diagnostic = (m_diagnostics.find(name) != m_diagnostics.end());
 
-    // These local views are really only needed if the averaging time is not 'Instant',
-    // to store running tallies for the average operation. However, we create them
-    // also for Instant avg_type, for simplicity later on.
-
-    // If we have an 'Instant' avg type, we can alias the 1d views with the
-    // views of the field, provided that the field does not have padding,
-    // and that it is not a subfield of another field (or else the view
-    // would be strided).
+    // Device views are only needed if the averaging time is not 'Instant',
+    // to store running tallies for the average operation. For Instant output,
+    // we read directly from the field on write steps, so we only need a host
+    // buffer to hand to PIO. If the field has no padding, and it is not a
+    // subfield of another field, the buffer can alias the field host view;
+    // otherwise, the (strided) field data is gathered in a host-only buffer.
     //
     // We also don't want to alias to a diagnostic output since it could share memory
     // with another diagnostic.
-    bool can_alias_field_view =
-        m_avg_type==OutputAvgType::Instant &&
+    const bool needs_tally_view =
+        m_avg_type!=OutputAvgType::Instant || is_diagnostic;
+    //
+    // Quantized fields are rounded in place in the host buffer before writing,
+    // so they cannot alias the field host view either.
+    const bool can_alias_field_view =
+        not needs_tally_view &&
+        m_significant_digits.count(name)==0 &&
         field.get_header().get_alloc_properties().get_padding()==0 &&
-        field.get_header().get_parent().expired() &&
-        not is_diagnostic;
+        field.get_header().get_parent().expired();
 
     const auto size = m_layouts.at(name).size();
-    if (can_alias_field_view) {
-      // Alias field's data, to save storage.
-      m_dev_views_1d.emplace(name,view_1d_dev(field.get_internal_view_data<Real,Device>(),size));
-      m_host_views_1d.emplace(name,view_1d_host(field.get_internal_view_data<Real,Host>(),size));
-    } else {
+    if (needs_tally_view) {
       // Create a local view.
       m_dev_views_1d.emplace(name,view_1d_dev("",size));
       m_host_views_1d.emplace(name,Kokkos::create_mirror(m_dev_views_1d[name]));
-
+    } else if (can_alias_field_view) {
+      // Alias field's data, to save storage.
+      m_host_views_1d.emplace(name,view_1d_host(field.get_internal_view_data<Real,Host>(),size));
+    } else {
+      // Host-only buffer, filled on write steps.
+      m_host_views_1d.emplace(name,view_1d_host("",size));
     }
   }
   // Initialize the local views
@@ -668,23 +735,106 @@ void AtmosphereOutput::register_views()
 }
 /* ---------------------------------------------------------- */
 void AtmosphereOutput::
+gather_field_host (const std::string& name, const Field& field)
+{
+  // Copy the (possibly strided) field host view into the contiguous
+  // IO host buffer, reshaped to the field layout.
+  const auto& fl = m_layouts.at(name);
+  auto data = m_host_views_1d.at(name).data();
+  switch (fl.rank()) {
+    case 1:
+      {
+        auto src = field.get_view<const Real*,Host>();
+        auto dst = view_Nd_host<1>(data,fl.dim(0));
+        for (int i=0; i<fl.dim(0); ++i) {
+          dst(i) = src(i);
+        }
+        break;
+      }
+    case 2:
+      {
+        auto src = field.get_view<const Real**,Host>();
+        auto dst = view_Nd_host<2>(data,fl.dim(0),fl.dim(1));
+        for (int i=0; i<fl.dim(0); ++i) {
+          for (int j=0; j<fl.dim(1); ++j) {
+            dst(i,j) = src(i,j);
+        }}
+        break;
+      }
+    case 3:
+      {
+        auto src = field.get_view<const Real***,Host>();
+        auto dst = view_Nd_host<3>(data,fl.dim(0),fl.dim(1),fl.dim(2));
+        for (int i=0; i<fl.dim(0); ++i) {
+          for (int j=0; j<fl.dim(1); ++j) {
+            for (int k=0; k<fl.dim(2); ++k) {
+              dst(i,j,k) = src(i,j,k);
+        }}}
+        break;
+      }
+    case 4:
+      {
+        auto src = field.get_view<const Real****,Host>();
+        auto dst = view_Nd_host<4>(data,fl.dim(0),fl.dim(1),fl.dim(2),fl.dim(3));
+        for (int i=0; i<fl.dim(0); ++i) {
+          for (int j=0; j<fl.dim(1); ++j) {
+            for (int k=0; k<fl.dim(2); ++k) {
+              for (int l=0; l<fl.dim(3); ++l) {
+                dst(i,j,k,l) = src(i,j,k,l);
+        }}}}
+        break;
+      }
+    case 5:
+      {
+        auto src = field.get_view<const Real*****,Host>();
+        auto dst = view_Nd_host<5>(data,fl.dim(0),fl.dim(1),fl.dim(2),fl.dim(3),fl.dim(4));
+        for (int i=0; i<fl.dim(0); ++i) {
+          for (int j=0; j<fl.dim(1); ++j) {
+            for (int k=0; k<fl.dim(2); ++k) {
+              for (int l=0; l<fl.dim(3); ++l) {
+                for (int m=0; m<fl.dim(4); ++m) {
+                  dst(i,j,k,l,m) = src(i,j,k,l,m);
+        }}}}}
+        break;
+      }
+    case 6:
+      {
+        auto src = field.get_view<const Real******,Host>();
+        auto dst = view_Nd_host<6>(data,fl.dim(0),fl.dim(1),fl.dim(2),fl.dim(3),fl.dim(4),fl.dim(5));
+        for (int i=0; i<fl.dim(0); ++i) {
+          for (int j=0; j<fl.dim(1); ++j) {
+            for (int k=0; k<fl.dim(2); ++k) {
+              for (int l=0; l<fl.dim(3); ++l) {
+                for (int m=0; m<fl.dim(4); ++m) {
+                  for (int n=0; n<fl.dim(5); ++n) {
+                    dst(i,j,k,l,m,n) = src(i,j,k,l,m,n);
+        }}}}}}
+        break;
+      }
+    default:
+      EKAT_ERROR_MSG ("Error! Field rank (" + std::to_string(fl.rank()) + ") not supported by AtmosphereOutput.\n");
+  }
+}
+/* ---------------------------------------------------------- */
+void AtmosphereOutput::
 reset_dev_views()
 {
   // Reset the local device views depending on the averaging type
   // Init dev view with an "identity" for avg_type
-  for (auto const& name : m_fields_names) {
+  for (auto& it : m_dev_views_1d) {
+    auto& view_dev = it.second;
     switch (m_avg_type) {
       case OutputAvgType::Instant:
         // No averaging
         break;
       case OutputAvgType::Max:
-        Kokkos::deep_copy(m_dev_views_1d[name],-std::numeric_limits<Real>::infinity());
+        Kokkos::deep_copy(view_dev,-std::numeric_limits<Real>::infinity());
         break;
       case OutputAvgType::Min:
-        Kokkos::deep_copy(m_dev_views_1d[name],std::numeric_limits<Real>::infinity());
+        Kokkos::deep_copy(view_dev,std::numeric_limits<Real>::infinity());
         break;
       case OutputAvgType::Average:
-        Kokkos::deep_copy(m_dev_views_1d[name],0);
+        Kokkos::deep_copy(view_dev,0);
         break;
       default:
         EKAT_ERROR_MSG ("Unrecognized averaging type.\n");
@@ -740,6 +890,15 @@ register_variables(const std::string& filename,
 
     register_variable(filename, name, name, units, vec_of_dims,
                       "real",fp_precision, io_decomp_tag);
+
+    // Compression settings are per-variable in netcdf4 files
+    if (m_deflate_level>0) {
+      set_variable_compression(filename,name,m_shuffle,m_deflate_level);
+    }
+    if (m_lossy_files.count(filename)==1 && m_significant_digits.count(name)==1) {
+      set_variable_metadata(filename,name,"number_of_significant_digits",
+                            std::to_string(m_significant_digits.at(name)));
+    }
   }
 } // register_variables
 /* ---------------------------------------------------------- */
@@ -845,12 +1004,23 @@ void AtmosphereOutput::set_degrees_of_freedom(const std::string& filename)
   */
 } // set_degrees_of_freedom
 /* ---------------------------------------------------------- */
+void AtmosphereOutput::close_output_file (const std::string& filename)
+{
+  m_lossy_files.erase(filename);
+}
+/* ---------------------------------------------------------- */
 void AtmosphereOutput::
 setup_output_file(const std::string& filename,
-                  const std::string& fp_precision)
+                  const std::string& fp_precision,
+                  const bool allow_lossy_compression)
 {
   using namespace scream::scorpio;
 
+  // Quantization is only applied to files that allow it (i.e., not to restart files)
+  if (allow_lossy_compression && m_significant_digits.size()>0) {
+    m_lossy_files.insert(filename);
+  }
+
   // Register dimensions with netCDF file.
   for (auto it : m_dims) {
     register_dimension(filename,it.first,it.first,it.second.first,it.second.second);
@@ -893,6 +1063,9 @@ Field AtmosphereOutput::get_field(const std::string& name, const std::string mod
   const auto field_mgr = get_field_manager(mode);
   const auto sim_field_mgr = get_field_manager("sim");
   if (field_mgr->has_field(name)) {
+    if (field_mgr==sim_field_mgr && m_real_copies.count(name)==1) {
+      return m_real_copies.at(name).second;
+    }
     return field_mgr->get_field(name);
   } else if (m_diagnostics.find(name) != m_diagnostics.end() && field_mgr==sim_field_mgr) {
     const auto& diag = m_diagnostics.at(name);
@@ -904,6 +1077,43 @@ Field AtmosphereOutput::get_field(const std::string& name, const std::string mod
   }
 }
 /* ---------------------------------------------------------- */
+void AtmosphereOutput::
+create_real_copies (const std::shared_ptr<const fm_type>& field_mgr)
+{
+  for (const auto& fname : m_fields_names) {
+    if (not field_mgr->has_field(fname)) {
+      continue;
+    }
+    const auto f = field_mgr->get_field(fname);
+    const auto& fid = f.get_header().get_identifier();
+    if (fid.data_type()==DataType::RealType) {
+      continue;
+    }
+    EKAT_REQUIRE_MSG (fid.data_type()!=DataType::IntType,
+        "Error! I/O supports only floating point data, for now.\n"
+        "  - field id: " + fid.get_id_string() + "\n");
+
+    Field copy(FieldIdentifier(fname,fid.get_layout(),fid.get_units(),fid.get_grid_name()));
+    const auto& ap = f.get_header().get_alloc_properties();
+    copy.get_header().get_alloc_properties().request_allocation(ap.get_largest_pack_size());
+    copy.allocate_view();
+    m_real_copies.emplace(fname,std::make_pair(f,copy));
+  }
+}
+/* ---------------------------------------------------------- */
+void AtmosphereOutput::update_real_copies ()
+{
+  for (auto& it : m_real_copies) {
+    const auto& f = it.second.first;
+    auto& copy = it.second.second;
+    copy.deep_copy(f);
+    const auto& ts = f.get_header().get_tracking().get_time_stamp();
+    if (ts.is_valid()) {
+      copy.get_header().get_tracking().update_time_stamp(ts);
+    }
+  }
+}
+/* ---------------------------------------------------------- */
 void AtmosphereOutput::set_diagnostics()
 {
   const auto sim_field_mgr = get_field_manager("sim");
@@ -928,6 +1138,19 @@ void AtmosphereOutput::set_diagnostics()
     // Note: this inits with an invalid timestamp. If by any chance we try to
     //       output the diagnostic without computing it, we'll get an error.
     diag->initialize(util::TimeStamp(),RunType::Initial);
+
+    // Column integrals can be computed in groups, as long as their inputs are
+    // not themselves diagnostics (which may not be up to date yet).
+    auto col_int = std::dynamic_pointer_cast<ColumnIntegralDiagnostic>(diag);
+    if (col_int) {
+      bool inputs_are_sim_fields = true;
+      for (const auto& req : diag->get_required_field_requests()) {
+        inputs_are_sim_fields &= sim_field_mgr->has_field(req.fid.name());
+      }
+      if (inputs_are_sim_fields) {
+        m_column_integrals.push_back(col_int);
+      }
+    }
   }
 }
 
@@ -8,9 +8,12 @@
 #include "share/grid/grids_manager.hpp"
 #include "share/util//scream_time_stamp.hpp"
 #include "share/atm_process/atmosphere_diagnostic.hpp"
+#include "share/atm_process/column_integral_diagnostic.hpp"
 
 #include "ekat/ekat_parameter_list.hpp"
 #include "ekat/mpi/ekat_comm.hpp"
+
+#include <set>
 /*  The AtmosphereOutput class handles an output stream in SCREAM.
  *  Typical usage is to register an AtmosphereOutput object with the OutputManager (see scream_output_manager.hpp
  *
@@ -28,6 +31,7 @@
  *  Casename:                     STRING
  *  Averaging Type:               STRING
  *  Max Snapshots Per File:       INT                   (default: 1)
+ *  Staging Directory:            STRING                (default: "")
  *  Fields:
  *     GRID_NAME_1:
  *        Field Names:            ARRAY OF STRINGS
@@ -48,6 +52,13 @@
  *  Restart:
  *    Casename:                   STRING                (default: ${Casename})
  *    Perform Restart:            BOOL                  (default: true)
+ *  Compression:
+ *    Deflate Level:              INT                   (default: 0)
+ *    Shuffle:                    BOOL                  (default: true)
+ *    Significant Digits:         INT                   (default: 0)
+ *    Fields Significant Digits:
+ *      FIELD_NAME_1:             INT                   (default: ${Significant Digits})
+ *      ...
  *  -----
  *  The meaning of these parameters is the following:
  *  - Casename: the output filename root.
@@ -63,6 +74,11 @@
  *        - Field Names: names of fields defined on grid $grid_name that need to be outputed
  *        - IO Grid Name: if provided, remap fields to this grid before output (useful to remap
  *                        SEGrid fields to PointGrid fields on the fly, to save on output size)
+ *  - Staging Directory: if set, restart files (model restart and history restart) are first
+ *    written in this directory (e.g., a RAM disk), and copied to their final location in the
+ *    background once closed. The rpointer file is updated only after the copy completes, and
+ *    a restarted run reads the staged copy, if it is still valid. All IO tasks must see this
+ *    directory, so node-local storage can only be used if all IO tasks live on the same node.
  *  - Max Snapshots Per File: the maximum number of snapshots saved per file. After this many
  *  - Output: parameters for output control
  *    - Frequency: the frequency of output writes (in the units specified by ${Output frequency_units})
@@ -77,6 +93,14 @@
  *    - Perform Restart: if this is a restarted run, and Averaging Type is not Instant, this flag
  *      determines whether we want to restart the output history or start from scrach. That is,
  *      you can set this to false to force a fresh new history, even in a restarted run.
+ *  - Compression: parameters for compressed output (requires a netcdf4 PIO iotype)
+ *    - Deflate Level: zlib compression level, in [1,9]. A value of 0 disables compression.
+ *    - Shuffle: whether the byte shuffle filter is applied before deflate.
+ *    - Significant Digits: if positive, data is quantized before being written, keeping only
+ *      the mantissa bits needed for this many significant decimal digits. This is lossy, but
+ *      greatly improves the compression ratio. Quantization is never applied to restart
+ *      files (neither model restart nor history restart files). Compressed/quantized files are read back transparently by AtmosphereInput.
+ *    - Fields Significant Digits: per-field override of 'Significant Digits' (0 disables it).
 
  *  Notes:
  *   - you can specify lists with either of the two syntaxes:
@@ -146,8 +170,11 @@ public:
   void restart (const std::string& filename);
   void init();
   void reset_dev_views();
-  void setup_output_file (const std::string& filename, const std::string& fp_precision);
+  void setup_output_file (const std::string& filename, const std::string& fp_precision,
+                          const bool allow_lossy_compression = true);
   void run (const std::string& filename, const bool write, const int nsteps_since_last_output);
+  // Clear any per-file state, once the file has been closed
+  void close_output_file (const std::string& filename);
   void finalize() {}
 
   long long res_dep_memory_footprint () const;
@@ -171,7 +198,10 @@ protected:
   void set_degrees_of_freedom(const std::string& filename);
   std::vector<scorpio::offset_t> get_var_dof_offsets (const FieldLayout& layout);
   void register_views();
+  void gather_field_host (const std::string& name, const Field& field);
   Field get_field(const std::string& name, const std::string mode) const;
+  void create_real_copies (const std::shared_ptr<const fm_type>& field_mgr);
+  void update_real_copies ();
   void compute_diagnostic(const std::string& name);
   void set_diagnostics();
   void create_diagnostic (const std::string& diag_name);
@@ -202,10 +232,29 @@ protected:
   std::map<std::string,std::vector<std::string>>        m_diag_depends_on_diags;
   std::map<std::string,bool>                            m_diag_computed;
 
+  // Simulation fields stored with a precision other than Real (e.g., float fields
+  // in a double precision build), and the Real copies that IO reads instead.
+  // The copies are updated at the beginning of each run call, so that remappers,
+  // diagnostics, and IO buffers only need to handle Real data.
+  std::map<std::string,std::pair<Field,Field>>          m_real_copies;
+
+  // Diagnostics that are column integrals of simulation fields. They are computed
+  // together, one kernel per weight field (see ColumnIntegralDiagnostic).
+  std::vector<std::shared_ptr<ColumnIntegralDiagnostic>> m_column_integrals;
+
   // Local views of each field to be used for "averaging" output and writing to file.
+  // Device views are only allocated for fields that need a running tally (i.e.,
+  // non-Instant output, or diagnostics); all other fields are read directly
+  // from the field on write steps.
   std::map<std::string,view_1d_host>    m_host_views_1d;
   std::map<std::string,view_1d_dev>     m_dev_views_1d;
 
+  // Compression settings (see class documentation)
+  int                                   m_deflate_level = 0;
+  bool                                  m_shuffle       = true;
+  std::map<std::string,int>             m_significant_digits;
+  std::set<std::string>                 m_lossy_files;
+
   bool m_add_time_dim;
 };
 
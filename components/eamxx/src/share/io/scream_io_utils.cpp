@@ -1,10 +1,145 @@
 #include "share/io/scream_io_utils.hpp"
 #include "share/util/scream_utils.hpp"
 
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
 #include <fstream>
+#include <limits>
+
+#include <sys/stat.h>
 
 namespace scream {
 
+namespace {
+
+template<typename T, typename UInt>
+void bit_round (T* data, const int size, const int keep_bits, const T fill_value)
+{
+  static_assert (sizeof(T)==sizeof(UInt), "Error! Mismatching float/int sizes.\n");
+
+  constexpr int mantissa_bits = std::numeric_limits<T>::digits - 1;
+  if (keep_bits>=mantissa_bits) {
+    return;
+  }
+
+  const int drop_bits = mantissa_bits - keep_bits;
+  const UInt half_ulp = UInt(1) << (drop_bits-1);
+  const UInt mask     = ~((UInt(1) << drop_bits) - 1);
+  for (int i=0; i<size; ++i) {
+    if (not std::isfinite(data[i]) || data[i]==fill_value) {
+      continue;
+    }
+    UInt bits;
+    std::memcpy(&bits,&data[i],sizeof(T));
+    // Round to nearest, ties to even, then zero the dropped bits
+    bits += half_ulp - 1 + ((bits >> drop_bits) & 1);
+    bits &= mask;
+    std::memcpy(&data[i],&bits,sizeof(T));
+  }
+}
+
+} // anonymous namespace
+
+bool is_directory (const std::string& path)
+{
+  struct stat info;
+  return stat(path.c_str(),&info)==0 && S_ISDIR(info.st_mode);
+}
+
+long long get_file_size (const std::string& path)
+{
+  struct stat info;
+  if (stat(path.c_str(),&info)!=0) {
+    return -1;
+  }
+  return info.st_size;
+}
+
+bool copy_file (const std::string& src, const std::string& dst)
+{
+  if (is_directory(src)) {
+    return false;
+  }
+
+  const std::string tmp = dst + ".tmp";
+  bool ok;
+  {
+    std::ifstream in (src,std::ios::binary);
+    if (not in.is_open()) {
+      return false;
+    }
+    std::ofstream out (tmp,std::ios::binary | std::ios::trunc);
+    if (not out.is_open()) {
+      return false;
+    }
+    // Note: inserting an empty streambuf sets the failbit, so skip empty files
+    if (in.peek()!=std::ifstream::traits_type::eof()) {
+      out << in.rdbuf();
+    }
+    out.flush();
+    ok = not in.bad() && out.good();
+  }
+  ok = ok && std::rename(tmp.c_str(),dst.c_str())==0;
+  if (not ok) {
+    // Do not leave partial copies around
+    std::remove(tmp.c_str());
+  }
+  return ok;
+}
+
+std::string find_valid_staged_copy (
+    const std::string& filename,
+    const std::string& staging_dir,
+    const ekat::Comm& comm)
+{
+  if (staging_dir=="") {
+    return filename;
+  }
+
+  // Strip the path from the filename, since the staged copy lives in staging_dir
+  const auto pos = filename.find_last_of('/');
+  const auto basename = pos==std::string::npos ? filename : filename.substr(pos+1);
+  const auto staged = staging_dir + "/" + basename;
+
+  // The staged copy must be visible (and valid) on all ranks, since all
+  // IO tasks will read from it. The drained file is a copy of the staged one,
+  // so the staged copy is valid if it has the same size, and it was not
+  // modified after the drained file was written.
+  struct stat staged_info, drained_info;
+  const bool exist = stat(staged.c_str(),&staged_info)==0 &&
+                     stat(filename.c_str(),&drained_info)==0;
+  const int my_valid = exist &&
+                       staged_info.st_size==drained_info.st_size &&
+                       staged_info.st_mtime<=drained_info.st_mtime;
+  int valid;
+  comm.all_reduce(&my_valid,&valid,1,MPI_MIN);
+
+  return valid ? staged : filename;
+}
+
+int nsd_to_mantissa_bits (const int nsd)
+{
+  EKAT_REQUIRE_MSG (nsd>0,
+      "Error! Number of significant digits must be positive.\n"
+      "  - nsd: " + std::to_string(nsd) + "\n");
+
+  // log2(10) bits per decimal digit, plus one guard bit
+  return static_cast<int>(std::ceil(nsd*std::log2(10.0))) + 1;
+}
+
+void quantize_significant_digits (Real* data, const int size, const int nsd,
+                                  const Real fill_value)
+{
+  const int keep_bits = nsd_to_mantissa_bits(nsd);
+#if defined(SCREAM_DOUBLE_PRECISION)
+  bit_round<double,std::uint64_t>(data,size,keep_bits,fill_value);
+#else
+  bit_round<float,std::uint32_t>(data,size,keep_bits,fill_value);
+#endif
+}
+
 std::string find_filename_in_rpointer (
     const std::string& casename,
     const bool model_restart,
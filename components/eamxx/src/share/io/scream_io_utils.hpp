@@ -2,6 +2,7 @@
 #define SCREAM_IO_UTILS_HPP
 
 #include "share/util/scream_time_stamp.hpp"
+#include "share/scream_types.hpp"
 #include "ekat/util/ekat_string_utils.hpp"
 #include "ekat/mpi/ekat_comm.hpp"
 #include <string>
@@ -115,6 +116,9 @@ struct IOFileSpecs {
   bool filename_with_avg_type    = true;
   bool filename_with_frequency   = true;
   bool save_grid_data            = true;
+  // If the file is written in a staging directory, this is the final
+  // location where the file is drained to, once closed (empty otherwise).
+  std::string drain_target;
 };
 
 std::string find_filename_in_rpointer (
@@ -123,5 +127,39 @@ std::string find_filename_in_rpointer (
     const ekat::Comm& comm,
     const util::TimeStamp& run_t0);
 
+// Small file system helpers, used to stage restart files in a fast
+// (possibly node-local) directory, and drain them to their final location.
+//  - is_directory: whether the path exists, and is a directory
+//  - get_file_size: size of the file in bytes (-1 if the file does not exist)
+//  - copy_file: copies src into a temporary next to dst, then renames it
+//    to dst, so that dst is never seen half written. Returns false on failure,
+//    in which case the temporary is removed.
+bool is_directory (const std::string& path);
+long long get_file_size (const std::string& path);
+bool copy_file (const std::string& src, const std::string& dst);
+
+// If a staged copy of the given (drained) file exists in staging_dir, and
+// it is still valid on all ranks of the comm, return its path. Otherwise,
+// return filename. The staged copy is valid if it has the same size of the
+// drained file, and it was not modified after the drained file was written.
+std::string find_valid_staged_copy (
+    const std::string& filename,
+    const std::string& staging_dir,
+    const ekat::Comm& comm);
+
+// Number of mantissa bits needed to preserve nsd significant decimal digits
+int nsd_to_mantissa_bits (const int nsd);
+
+// Lossy quantization of output data, to improve the compression ratio of
+// the deflate filter: each entry is rounded (to nearest, ties to even) so
+// that only the mantissa bits needed to preserve nsd significant decimal
+// digits are kept, and all the trailing ones are zeroed.
+// Non-finite entries and entries equal to fill_value (e.g., the mask value
+// of remapped fields) are left untouched.
+// Note: the rounded values are exactly representable in single precision
+//       as long as nsd<=6, so this can be done before converting to float.
+void quantize_significant_digits (Real* data, const int size, const int nsd,
+                                  const Real fill_value);
+
 } // namespace scream
 #endif // SCREAM_IO_UTILS_HPP
@@ -8,6 +8,8 @@
 #include "ekat/mpi/ekat_comm.hpp"
 #include "ekat/util/ekat_string_utils.hpp"
 
+#include <chrono>
+#include <cstdio>
 #include <fstream>
 #include <memory>
 
@@ -55,6 +57,14 @@ setup (const ekat::Comm& io_comm, const ekat::ParameterList& params,
   // Check for model restart output
   set_params(params,field_mgrs);
 
+  // Check if restart files should be staged in a (fast) local directory first
+  m_staging_dir = m_params.get<std::string>("Staging Directory","");
+  if (m_staging_dir!="") {
+    EKAT_REQUIRE_MSG (is_directory(m_staging_dir),
+        "Error! Restart staging directory not found.\n"
+        "  - Staging Directory: " + m_staging_dir + "\n");
+  }
+
   // Output control
   EKAT_REQUIRE_MSG(m_params.isSublist("output_control"),"Error! The output control YAML file for " + m_casename + " is missing the sublist 'output_control'");
   auto& out_control_pl = m_params.sublist("output_control");
@@ -168,6 +178,7 @@ setup (const ekat::Comm& io_comm, const ekat::ParameterList& params,
       // If the type/freq of output needs restart data, we need to read in an output.
       if (has_restart_data && m_output_control.nsamples_since_last_write>0) {
         auto output_restart_filename = find_filename_in_rpointer(hist_restart_casename,false,m_io_comm,m_run_t0);
+        output_restart_filename = find_valid_staged_copy(output_restart_filename,m_staging_dir,m_io_comm);
 
         // Also restart each stream
         for (auto stream : m_output_streams) {
@@ -196,6 +207,10 @@ void OutputManager::run(const util::TimeStamp& timestamp)
 
   std::string timer_root = m_is_model_restart_output ? "EAMxx::IO::restart" : "EAMxx::IO::standard";
   start_timer(timer_root); 
+
+  // Check if some restart file finished draining from the staging directory
+  update_drains(false);
+
   // Check if we need to open a new file
   ++m_output_control.nsamples_since_last_write;
   ++m_checkpoint_control.nsamples_since_last_write;
@@ -223,8 +238,9 @@ void OutputManager::run(const util::TimeStamp& timestamp)
     // If we are going to write an output checkpoint file, or a model restart file,
     // we need to append to the filename ".rhist" or ".r" respectively, and add
     // the filename to the rpointer.atm file.
+    // If the file is staged, the rpointer is updated only once the file is drained.
     if (m_is_model_restart_output || is_checkpoint_step) {
-      if (m_io_comm.am_i_root()) {
+      if (m_io_comm.am_i_root() && filespecs.drain_target=="") {
         std::ofstream rpointer;
         rpointer.open("rpointer.atm",std::ofstream::app);  // Open rpointer file and append to it
         rpointer << filename << std::endl;
@@ -286,8 +302,13 @@ void OutputManager::run(const util::TimeStamp& timestamp)
     // Check if we need to close the output file
     if (filespecs.file_is_full()) {
       eam_pio_closefile(filename);
+      close_output_file(filename);
       filespecs.num_snapshots_in_file = 0;
       filespecs.is_open = false;
+
+      if (filespecs.drain_target!="") {
+        start_drain(filename,filespecs.drain_target);
+      }
     }
 
     // Whether we wrote an output or a checkpoint, the checkpoint counter needs to be reset
@@ -300,6 +321,18 @@ void OutputManager::run(const util::TimeStamp& timestamp)
 /*===============================================================================================*/
 void OutputManager::finalize()
 {
+  // Close any staged file that is still open, and wait for all drains to complete,
+  // so that the rpointer file is up to date when the run ends.
+  for (auto specs : {&m_output_file_specs, &m_checkpoint_file_specs}) {
+    if (specs->is_open && specs->drain_target!="") {
+      scorpio::eam_pio_closefile(specs->filename);
+      close_output_file(specs->filename);
+      specs->is_open = false;
+      start_drain(specs->filename,specs->drain_target);
+    }
+  }
+  update_drains(true);
+
   // Swapping with an empty mgr is the easiest way to cleanup.
   OutputManager other;
   std::swap(*this,other);
@@ -314,6 +347,66 @@ long long OutputManager::res_dep_memory_footprint () const {
   return mf;
 }
 
+void OutputManager::
+close_output_file (const std::string& filename)
+{
+  for (const auto& streams : {&m_output_streams, &m_geo_data_streams}) {
+    for (const auto& os : *streams) {
+      os->close_output_file(filename);
+    }
+  }
+}
+/*===============================================================================================*/
+void OutputManager::
+start_drain (const std::string& staged, const std::string& target)
+{
+  // Make sure all IO tasks are done with the file before copying it
+  m_io_comm.barrier();
+
+  // The copy is done by the root rank only, in a separate thread,
+  // so that the model can keep time stepping.
+  if (m_io_comm.am_i_root()) {
+    Drain d;
+    d.staged = staged;
+    d.target = target;
+    d.done   = std::async(std::launch::async,[staged,target]() {
+                 return copy_file(staged,target);
+               }).share();
+    m_pending_drains.push_back(d);
+  }
+}
+
+void OutputManager::
+update_drains (const bool wait)
+{
+  using namespace std::chrono_literals;
+
+  auto it = m_pending_drains.begin();
+  while (it!=m_pending_drains.end()) {
+    if (not wait && it->done.wait_for(0s)!=std::future_status::ready) {
+      // Drains complete in order, so no point in checking the others
+      break;
+    }
+    EKAT_REQUIRE_MSG (it->done.get(),
+        "Error! Could not drain restart file from staging directory.\n"
+        "  - staged file: " + it->staged + "\n"
+        "  - target file: " + it->target + "\n");
+
+    // Now that the file is in its final location, we can add it to the rpointer file
+    std::ofstream rpointer;
+    rpointer.open("rpointer.atm",std::ofstream::app);  // Open rpointer file and append to it
+    rpointer << it->target << std::endl;
+
+    // Keep only the most recent staged copy, which can be used for a fast restart
+    if (m_last_drained_staged_file!="") {
+      std::remove(m_last_drained_staged_file.c_str());
+    }
+    m_last_drained_staged_file = it->staged;
+
+    it = m_pending_drains.erase(it);
+  }
+}
+
 std::string OutputManager::
 compute_filename (const IOControl& control,
                   const IOFileSpecs& file_specs,
@@ -407,6 +500,15 @@ setup_file (      IOFileSpecs& filespecs, const IOControl& control,
                        : (m_is_model_restart_output ? ".r" : "");
   filename = compute_filename (control,filespecs,suffix,timestamp);
 
+  // Restart files can be written in the staging directory first, and drained
+  // to their final location once closed (see start_drain).
+  filespecs.drain_target = "";
+  if (m_staging_dir!="" && (m_is_model_restart_output || is_checkpoint_step)) {
+    const auto pos = filename.find_last_of('/');
+    filespecs.drain_target = filename;
+    filename = m_staging_dir + "/" + (pos==std::string::npos ? filename : filename.substr(pos+1));
+  }
+
   // Register new netCDF file for output. First, check no other output managers
   // are trying to write on the same file
   EKAT_REQUIRE_MSG (not is_file_open_c2f(filename.c_str(),Write),
@@ -432,8 +534,10 @@ setup_file (      IOFileSpecs& filespecs, const IOControl& control,
                            : m_params.get<std::string>("Floating Point Precision");
 
   // Make all output streams register their dims/vars
+  // Note: restart files (.r and .rhist) must be bit-for-bit, so no lossy compression there
+  const bool is_restart_file = m_is_model_restart_output || is_checkpoint_step;
   for (auto& it : m_output_streams) {
-    it->setup_output_file(filename,fp_precision);
+    it->setup_output_file(filename,fp_precision,not is_restart_file);
   }
 
   if (filespecs.save_grid_data) {
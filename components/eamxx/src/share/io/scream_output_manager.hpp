@@ -13,6 +13,9 @@
 #include "ekat/ekat_parameter_list.hpp"
 #include "ekat/ekat_parse_yaml_file.hpp"
 
+#include <future>
+#include <list>
+
 namespace scream
 {
 
@@ -126,6 +129,15 @@ protected:
                    const IOControl& control,
                    const util::TimeStamp& timestamp);
 
+  // Let the output streams release their per-file state, once the file is closed
+  void close_output_file (const std::string& filename);
+
+  // Asynchronously copy a closed staged file to its final location, and
+  // check on pending copies (possibly waiting for all of them to complete).
+  // The rpointer file is updated only once a copy completes.
+  void start_drain (const std::string& staged, const std::string& target);
+  void update_drains (const bool wait);
+
   using output_type     = AtmosphereOutput;
   using output_ptr_type = std::shared_ptr<output_type>;
 
@@ -165,6 +177,20 @@ protected:
   // restart happens, and the latter being the start time of the *original* run.
   util::TimeStamp   m_case_t0;
   util::TimeStamp   m_run_t0;
+
+  // If not empty, restart files (model restart and history restart) are written
+  // in this directory (e.g., node-local storage or a RAM disk), and drained to
+  // their final location in the background, once closed.
+  // Note: all IO tasks must see the same directory, so node-local storage is
+  //       only viable if all the PIO IO tasks live on the same node.
+  struct Drain {
+    std::string       staged;
+    std::string       target;
+    std::shared_future<bool> done;
+  };
+  std::string       m_staging_dir;
+  std::list<Drain>  m_pending_drains;
+  std::string       m_last_drained_staged_file;
 };
 
 } // namespace scream
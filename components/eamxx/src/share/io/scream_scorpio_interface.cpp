@@ -34,6 +34,7 @@ extern "C" {
                              const char*&& units, const int numdims, const char** var_dimensions,
                              const int dtype, const int nc_dtype, const char*&& pio_decomp_tag);
   void set_variable_metadata_c2f (const char*&& filename, const char*&& varname, const char*&& meta_name, const char*&& meta_val);
+  void set_variable_compression_c2f (const char*&& filename, const char*&& varname, const bool shuffle, const int deflate_level);
   void get_variable_c2f(const char*&& filename,const char*&& shortname, const char*&& longname,
                         const int numdims, const char** var_dimensions,
                         const int dtype, const char*&& pio_decomp_tag);
@@ -140,6 +141,10 @@ void set_variable_metadata (const std::string& filename, const std::string& varn
   set_variable_metadata_c2f(filename.c_str(),varname.c_str(),meta_name.c_str(),meta_val.c_str());
 }
 /* ----------------------------------------------------------------- */
+void set_variable_compression (const std::string& filename, const std::string& varname, const bool shuffle, const int deflate_level) {
+  set_variable_compression_c2f(filename.c_str(),varname.c_str(),shuffle,deflate_level);
+}
+/* ----------------------------------------------------------------- */
 void eam_pio_enddef(const std::string &filename) {
   eam_pio_enddef_c2f(filename.c_str());
 }
@@ -39,6 +39,8 @@ namespace scorpio {
                          const std::string& units, const std::vector<std::string>& var_dimensions,
                          const std::string& dtype, const std::string& nc_dtype, const std::string& pio_decomp_tag);
   void set_variable_metadata (const std::string& filename, const std::string& varname, const std::string& meta_name, const std::string& meta_val);
+  /* Enable shuffle+deflate compression for a variable. Must be called before eam_pio_enddef, and requires a netcdf4 iotype. */
+  void set_variable_compression (const std::string& filename, const std::string& varname, const bool shuffle, const int deflate_level);
   /* Register a variable with a file.  Called during the file setup, for an input stream. */
   void get_variable(const std::string& filename,const std::string& shortname, const std::string& longname,
                     const std::vector<std::string>& var_dimensions,
@@ -1,5 +1,6 @@
 #include <catch2/catch.hpp>
 #include <memory>
+#include <cmath>
 
 #include "share/io/scream_output_manager.hpp"
 #include "share/io/scorpio_output.hpp"
@@ -487,18 +488,18 @@ void run(const std::string& output_type,const std::string& output_freq_units) {
   auto f3_bot_host = f3_bot.get_view<Real*,Host>();
   auto f3_lev_2_host = f3_lev_2.get_view<Real*,Host>();
 
+  // Reset the fields, on both host and device, so that we can check that
+  // read_variables updates both (f4 is padded, and all of them are read
+  // through the staging buffer).
+  for (auto f : {f1,f2,f3,f4,f3_tom,f3_bot,f3_lev_2}) {
+    f.deep_copy(0);
+    f.sync_to_host();
+  }
+
   // Read data
   AtmosphereInput test_input(input_params,field_manager);
   test_input.read_variables();
   test_input.finalize();
-  // Check instant output
-  f1.sync_to_host();
-  f2.sync_to_host();
-  f3.sync_to_host();
-  f4.sync_to_host();
-  f3_tom.sync_to_host();
-  f3_bot.sync_to_host();
-  f3_lev_2.sync_to_host();
 
   if (output_type == "instant") {
     // The diagnostic is not present in the field manager.  So we can't use the scorpio_input class
@@ -521,20 +522,31 @@ void run(const std::string& output_type,const std::string& output_freq_units) {
     REQUIRE(time_val==time_in_days);
   }
   // Check values
-  for (int ii=0;ii<num_lcols;++ii) {
-    REQUIRE(std::abs(f1_host(ii)-check_data_xy(current_t,dt,ii,0,output_type))<tol);
+  auto check_values = [&]() {
+    for (int ii=0;ii<num_lcols;++ii) {
+      REQUIRE(std::abs(f1_host(ii)-check_data_xy(current_t,dt,ii,0,output_type))<tol);
+      for (int jj=0;jj<num_levs;++jj) {
+        REQUIRE(std::abs(f3_host(ii,jj)-check_data_xy(current_t,dt,ii,jj,output_type))<tol);
+        REQUIRE(std::abs(f4_host(ii,jj)-check_data_xy(current_t,dt,ii,jj,output_type))<tol);
+      }
+
+      REQUIRE (f3_tom_host(ii)==f3_host(ii,0));
+      REQUIRE (f3_bot_host(ii)==f3_host(ii,num_levs-1));
+      REQUIRE (f3_lev_2_host(ii)==f3_host(ii,2));
+    }
     for (int jj=0;jj<num_levs;++jj) {
-      REQUIRE(std::abs(f3_host(ii,jj)-check_data_xy(current_t,dt,ii,jj,output_type))<tol);
-      REQUIRE(std::abs(f4_host(ii,jj)-check_data_xy(current_t,dt,ii,jj,output_type))<tol);
+      REQUIRE(std::abs(f2_host(jj)-check_data_xy(current_t,dt,0,jj,output_type))<tol);
     }
+  };
 
-    REQUIRE (f3_tom_host(ii)==f3_host(ii,0));
-    REQUIRE (f3_bot_host(ii)==f3_host(ii,num_levs-1));
-    REQUIRE (f3_lev_2_host(ii)==f3_host(ii,2));
-  }
-  for (int jj=0;jj<num_levs;++jj) {
-    REQUIRE(std::abs(f2_host(jj)-check_data_xy(current_t,dt,0,jj,output_type))<tol);
+  // Host views must be up to date right after the read...
+  check_values();
+
+  // ...and so must the device views
+  for (auto f : {f1,f2,f3,f4,f3_tom,f3_bot,f3_lev_2}) {
+    f.sync_to_host();
   }
+  check_values();
   // All Done 
   scorpio::eam_pio_finalize();
 } // end function run()
@@ -772,4 +784,35 @@ TEST_CASE("input_output_basic","io")
     }
   }
 }
+/*========================================================================================================*/
+TEST_CASE("quantize_significant_digits","io")
+{
+  // A fill value whose mantissa would be changed by rounding
+  const Real fill_value = 1.2345678901234e20;
+  const std::vector<Real> data = {
+    1, -3.14159265358979, 1234.56789, 1e-20, 0,
+    std::numeric_limits<Real>::infinity(), fill_value
+  };
+
+  for (int nsd : {2,3,5}) {
+    auto q = data;
+    quantize_significant_digits(q.data(),q.size(),nsd,fill_value);
+
+    // The relative error must be below the requested number of digits,
+    // while fill values and non-finite entries are untouched
+    const Real tol = std::pow(10.0,-nsd);
+    for (size_t i=0; i<data.size(); ++i) {
+      if (std::isfinite(data[i]) && data[i]!=fill_value) {
+        REQUIRE (std::abs(q[i]-data[i])<=tol*std::abs(data[i]));
+      } else {
+        REQUIRE (q[i]==data[i]);
+      }
+    }
+
+    // Quantizing twice is a no-op
+    auto qq = q;
+    quantize_significant_digits(qq.data(),qq.size(),nsd,fill_value);
+    REQUIRE (qq==q);
+  }
+}
 } // anonymous namespace
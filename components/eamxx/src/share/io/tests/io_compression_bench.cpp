@@ -0,0 +1,198 @@
+#include "share/io/scream_io_utils.hpp"
+#include "share/scream_types.hpp"
+
+#include "ekat/util/ekat_test_utils.hpp"
+#include "ekat/util/ekat_string_utils.hpp"
+#include "ekat/ekat_assert.hpp"
+
+#include <zlib.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+using namespace scream;
+
+/*
+ * io_compression_bench measures the trade-off between throughput and
+ * compression ratio of the output compression options (see the 'Compression'
+ * sublist in scorpio_output.hpp). For each number of significant digits and
+ * each deflate level, a synthetic 3d field is quantized, byte-shuffled and
+ * deflated with zlib, which are the same steps netCDF4/HDF5 perform when
+ * writing a variable with the shuffle and deflate filters.
+ *
+ * For each case we report
+ *  - quantize MB/s: throughput of quantize_significant_digits;
+ *  - deflate MB/s: throughput of shuffle+deflate (uncompressed bytes per second);
+ *  - ratio: uncompressed over compressed size.
+ * A number of significant digits of 0 means no quantization (lossless only).
+ *
+ * The field mimics a temperature-like state: a smooth vertical profile, with
+ * large-scale horizontal variability and a small amount of noise, which is
+ * what makes bit-rounding effective: the noise lives in the trailing bits.
+ */
+
+using clock_type = std::chrono::steady_clock;
+
+double seconds_since (const clock_type::time_point& t0) {
+  return std::chrono::duration<double>(clock_type::now()-t0).count();
+}
+
+std::vector<Real> make_field (const int ncols, const int nlevs) {
+  std::mt19937_64 engine(1234);
+  std::normal_distribution<Real> noise(0,0.01);
+  std::vector<Real> data(static_cast<size_t>(ncols)*nlevs);
+  for (int icol=0; icol<ncols; ++icol) {
+    const Real x = Real(icol)/ncols;
+    for (int ilev=0; ilev<nlevs; ++ilev) {
+      data[static_cast<size_t>(icol)*nlevs+ilev] =
+        200 + 100*Real(ilev)/nlevs + 10*std::sin(8*M_PI*x) + noise(engine);
+    }
+  }
+  return data;
+}
+
+// Same as the HDF5 shuffle filter: group the i-th byte of all entries together
+void byte_shuffle (const std::vector<Real>& in, std::vector<unsigned char>& out) {
+  const size_t n = in.size();
+  const auto bytes = reinterpret_cast<const unsigned char*>(in.data());
+  for (size_t i=0; i<n; ++i) {
+    for (size_t b=0; b<sizeof(Real); ++b) {
+      out[b*n+i] = bytes[i*sizeof(Real)+b];
+    }
+  }
+}
+
+struct Result {
+  double quantize_mbs;
+  double deflate_mbs;
+  double ratio;
+};
+
+Result run_case (const std::vector<Real>& field, const int nsd, const int level,
+                 const bool shuffle, const int repeat)
+{
+  const size_t nbytes = field.size()*sizeof(Real);
+  const double mb = nbytes/1e6;
+  const Real fill_value = std::numeric_limits<float>::max()/10.0;
+
+  std::vector<Real> data;
+  std::vector<unsigned char> shuffled(nbytes);
+  std::vector<Bytef> compressed(compressBound(nbytes));
+  uLongf compressed_size = 0;
+
+  double t_quantize = 0, t_deflate = 0;
+  for (int r=0; r<repeat; ++r) {
+    data = field;
+
+    auto t0 = clock_type::now();
+    if (nsd>0) {
+      quantize_significant_digits(data.data(),data.size(),nsd,fill_value);
+    }
+    t_quantize += seconds_since(t0);
+
+    t0 = clock_type::now();
+    const Bytef* src = reinterpret_cast<const Bytef*>(data.data());
+    if (shuffle) {
+      byte_shuffle(data,shuffled);
+      src = shuffled.data();
+    }
+    compressed_size = compressed.size();
+    const int err = compress2(compressed.data(),&compressed_size,src,nbytes,level);
+    EKAT_REQUIRE_MSG (err==Z_OK, "Error! zlib compress2 failed with error code " + std::to_string(err) + ".\n");
+    t_deflate += seconds_since(t0);
+  }
+
+  Result res;
+  res.quantize_mbs = nsd>0 ? repeat*mb/t_quantize : 0;
+  res.deflate_mbs  = repeat*mb/t_deflate;
+  res.ratio        = double(nbytes)/compressed_size;
+  return res;
+}
+
+void expect_another_arg (int i, int argc) {
+  EKAT_REQUIRE_MSG(i != argc-1, "Expected another cmd-line arg.");
+}
+
+} // anonymous namespace
+
+int main (int argc, char** argv) {
+  if (argc > 1 && ekat::argv_matches(argv[1], "-h", "--help")) {
+    std::cout <<
+      argv[0] << " [options]\n"
+      "Options:\n"
+      "  -i <cols>      Number of columns. Default=21600.\n"
+      "  -k <nlev>      Number of vertical levels. Default=72.\n"
+      "  -d <nsds>      Comma-separated list of significant digits (0=no quantization). Default=0,7,5,3.\n"
+      "  -l <levels>    Comma-separated list of deflate levels. Default=1,4,9.\n"
+      "  -s <shuffle>   yes|no. Default=yes.\n"
+      "  -r <repeat>    Number of timed repetitions. Default=5.\n";
+    return 0;
+  }
+
+  int ncols = 21600;
+  int nlevs = 72;
+  int repeat = 5;
+  bool shuffle = true;
+  std::vector<int> nsds = {0, 7, 5, 3};
+  std::vector<int> levels = {1, 4, 9};
+  for (int i = 1; i < argc; ++i) {
+    if (ekat::argv_matches(argv[i], "-i", "--ncol")) {
+      expect_another_arg(i, argc);
+      ++i;
+      ncols = std::atoi(argv[i]);
+    }
+    if (ekat::argv_matches(argv[i], "-k", "--nlev")) {
+      expect_another_arg(i, argc);
+      ++i;
+      nlevs = std::atoi(argv[i]);
+    }
+    if (ekat::argv_matches(argv[i], "-d", "--nsd")) {
+      expect_another_arg(i, argc);
+      ++i;
+      nsds.clear();
+      for (const auto& s : ekat::split(std::string(argv[i]),',')) {
+        nsds.push_back(std::stoi(s));
+      }
+    }
+    if (ekat::argv_matches(argv[i], "-l", "--level")) {
+      expect_another_arg(i, argc);
+      ++i;
+      levels.clear();
+      for (const auto& s : ekat::split(std::string(argv[i]),',')) {
+        levels.push_back(std::stoi(s));
+      }
+    }
+    if (ekat::argv_matches(argv[i], "-s", "--shuffle")) {
+      expect_another_arg(i, argc);
+      ++i;
+      const std::string v = argv[i];
+      EKAT_REQUIRE_MSG(v == "yes" || v == "no", "Shuffle option value must be one of yes|no");
+      shuffle = v == "yes";
+    }
+    if (ekat::argv_matches(argv[i], "-r", "--repeat")) {
+      expect_another_arg(i, argc);
+      ++i;
+      repeat = std::atoi(argv[i]);
+    }
+  }
+
+  const auto field = make_field(ncols,nlevs);
+  std::cout << "IO compression benchmark: ncol=" << ncols << ", nlev=" << nlevs
+            << ", sizeof(Real)=" << sizeof(Real) << ", shuffle=" << shuffle
+            << ", repeat=" << repeat << "\n";
+  std::printf("%5s %7s %15s %14s %8s\n", "nsd", "deflate", "quantize MB/s", "deflate MB/s", "ratio");
+  for (const int nsd : nsds) {
+    for (const int level : levels) {
+      const auto res = run_case(field,nsd,level,shuffle,repeat);
+      std::printf("%5d %7d %15.1f %14.1f %8.2f\n", nsd, level, res.quantize_mbs, res.deflate_mbs, res.ratio);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,177 @@
+#include <catch2/catch.hpp>
+
+#include "share/io/scream_output_manager.hpp"
+#include "share/io/scorpio_input.hpp"
+#include "share/io/scream_scorpio_interface.hpp"
+
+#include "share/grid/mesh_free_grids_manager.hpp"
+
+#include "share/field/field_identifier.hpp"
+#include "share/field/field.hpp"
+#include "share/field/field_manager.hpp"
+
+#include "share/util/scream_time_stamp.hpp"
+#include "share/scream_types.hpp"
+
+#include "ekat/util/ekat_units.hpp"
+#include "ekat/ekat_parameter_list.hpp"
+#include "ekat/ekat_scalar_traits.hpp"
+
+namespace {
+
+using namespace scream;
+using namespace ekat::units;
+
+// Fields stored in single and double precision. Whatever Real is, one of them
+// is not Real, and goes through the Real copies of the scorpio classes.
+const std::vector<std::string> fnames = {"field_real", "field_float", "field_double"};
+
+std::shared_ptr<FieldManager>
+get_test_fm(const std::shared_ptr<const AbstractGrid>& grid,
+            const util::TimeStamp& t0, const bool fill);
+
+std::shared_ptr<GridsManager>
+get_test_gm(const ekat::Comm& io_comm, const int num_gcols, const int num_levs);
+
+template<typename ST>
+void check_field (const Field& f0, const Field& f1) {
+  // Data is written in Real precision, so values go through Real
+  const auto v0 = f0.get_view<const ST**,Host>();
+  const auto v1 = f1.get_view<const ST**,Host>();
+  for (int i=0; i<v0.extent_int(0); ++i) {
+    for (int k=0; k<v0.extent_int(1); ++k) {
+      REQUIRE (v1(i,k)==static_cast<ST>(static_cast<Real>(v0(i,k))));
+    }
+  }
+}
+
+TEST_CASE("precision_io")
+{
+  ekat::Comm io_comm(MPI_COMM_WORLD);
+
+  const int num_gcols = 2*io_comm.size();
+  const int num_levs = 2 + SCREAM_PACK_SIZE;
+
+  // Initialize the pio_subsystem for this test:
+  MPI_Fint fcomm = MPI_Comm_c2f(io_comm.mpi_comm());
+  scorpio::eam_init_pio_subsystem(fcomm);
+
+  auto gm = get_test_gm(io_comm,num_gcols,num_levs);
+  auto grid = gm->get_grid("Point Grid");
+
+  // Construct a timestamp
+  util::TimeStamp t0 ({2000,1,1},{0,0,0});
+
+  // Write the fields
+  auto fm0 = get_test_fm(grid,t0,true);
+  REQUIRE (fm0->get_field("field_float").data_type()==DataType::FloatType);
+  REQUIRE (fm0->get_field("field_double").data_type()==DataType::DoubleType);
+
+  ekat::ParameterList params;
+  params.set<std::string>("Casename","io_test_precision");
+  params.set<std::string>("Averaging Type","Instant");
+  params.set<int>("Max Snapshots Per File",1);
+  params.set("Field Names",fnames);
+  params.set<std::string>("Floating Point Precision","real");
+  auto& ctrl = params.sublist("output_control");
+  ctrl.set<bool>("MPI Ranks in Filename",true);
+  ctrl.set<int>("Frequency",1);
+  ctrl.set<std::string>("frequency_units","nsteps");
+
+  OutputManager om;
+  om.setup(io_comm,params,fm0,gm,t0,t0,false);
+  om.run(t0);
+  om.finalize();
+
+  // Read them back in a fresh field manager
+  auto fm1 = get_test_fm(grid,t0,false);
+
+  ekat::ParameterList in_params("Input Parameters");
+  in_params.set<std::string>("Filename","io_test_precision.INSTANT.nsteps_x1.np"
+                                        + std::to_string(io_comm.size())
+                                        + "." + t0.to_string() + ".nc");
+  in_params.set("Field Names",fnames);
+  in_params.set<std::string>("Floating Point Precision","real");
+  AtmosphereInput input(in_params,fm1);
+  input.read_variables();
+  input.finalize();
+
+  for (const auto& fname : fnames) {
+    auto f0 = fm0->get_field(fname);
+    auto f1 = fm1->get_field(fname);
+    f1.sync_to_host();
+    if (f0.data_type()==DataType::FloatType) {
+      check_field<float>(f0,f1);
+    } else {
+      check_field<double>(f0,f1);
+    }
+  }
+
+  // All Done
+  scorpio::eam_pio_finalize();
+}
+
+/*===================================================================================================*/
+template<typename ST>
+void fill_field (Field& f, const int offset) {
+  auto v = f.get_view<ST**,Host>();
+  for (int i=0; i<v.extent_int(0); ++i) {
+    for (int k=0; k<v.extent_int(1); ++k) {
+      // Not exactly representable in single precision
+      v(i,k) = offset + (i*v.extent_int(1) + k + 1)/ST(3);
+    }
+  }
+  f.sync_to_dev();
+}
+
+std::shared_ptr<FieldManager>
+get_test_fm(const std::shared_ptr<const AbstractGrid>& grid,
+            const util::TimeStamp& t0, const bool fill)
+{
+  using FR = FieldRequest;
+
+  auto fm = std::make_shared<FieldManager>(grid);
+
+  const auto lt = grid->get_3d_scalar_layout(true);
+  const std::string& gn = grid->name();
+  const int offset = grid->get_comm().rank()*1000;
+
+  fm->registration_begins();
+  fm->register_field(FR{FieldIdentifier("field_real",  lt,kg,gn)});
+  fm->register_field(FR{FieldIdentifier("field_float", lt,kg,gn,DataType::FloatType)});
+  fm->register_field(FR{FieldIdentifier("field_double",lt,kg,gn,DataType::DoubleType)});
+  fm->registration_ends();
+
+  for (const auto& fname : fnames) {
+    auto f = fm->get_field(fname);
+    if (not fill) {
+      if (f.data_type()==DataType::FloatType) {
+        f.deep_copy(ekat::ScalarTraits<float>::invalid());
+      } else {
+        f.deep_copy(ekat::ScalarTraits<double>::invalid());
+      }
+    } else if (f.data_type()==DataType::FloatType) {
+      fill_field<float>(f,offset);
+    } else {
+      fill_field<double>(f,offset);
+    }
+    f.get_header().get_tracking().update_time_stamp(t0);
+  }
+
+  return fm;
+}
+/*==========================================================================================================*/
+std::shared_ptr<GridsManager>
+get_test_gm(const ekat::Comm& io_comm, const int num_gcols, const int num_levs)
+{
+  ekat::ParameterList gm_params;
+  gm_params.set("number_of_global_columns",num_gcols);
+  gm_params.set("number_of_vertical_levels",num_levs);
+
+  auto gm = create_mesh_free_grids_manager(io_comm,gm_params);
+  gm->build_grids();
+
+  return gm;
+}
+
+} // anonymous namespace
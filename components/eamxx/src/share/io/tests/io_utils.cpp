@@ -0,0 +1,123 @@
+#include <catch2/catch.hpp>
+
+#include "share/io/scream_io_utils.hpp"
+
+#include "ekat/mpi/ekat_comm.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <sys/stat.h>
+#include <utime.h>
+
+namespace {
+
+using namespace scream;
+
+void write_file (const std::string& path, const std::string& content) {
+  std::ofstream out (path,std::ios::binary | std::ios::trunc);
+  out << content;
+}
+
+std::string read_file (const std::string& path) {
+  std::ifstream in (path,std::ios::binary);
+  std::stringstream ss;
+  ss << in.rdbuf();
+  return ss.str();
+}
+
+void set_mtime (const std::string& path, const time_t t) {
+  utimbuf times;
+  times.actime  = t;
+  times.modtime = t;
+  REQUIRE (utime(path.c_str(),&times)==0);
+}
+
+TEST_CASE("file_system_utils","io")
+{
+  const std::string dir  = "io_utils_dir";
+  const std::string file = "io_utils_file.txt";
+  mkdir(dir.c_str(),0755);
+  write_file(file,"0123456789");
+
+  SECTION ("is_directory") {
+    REQUIRE (is_directory(dir));
+    REQUIRE (is_directory("."));
+    REQUIRE (not is_directory(file));
+    REQUIRE (not is_directory("io_utils_missing"));
+  }
+
+  SECTION ("get_file_size") {
+    REQUIRE (get_file_size(file)==10);
+    write_file("io_utils_empty.txt","");
+    REQUIRE (get_file_size("io_utils_empty.txt")==0);
+    REQUIRE (get_file_size("io_utils_missing")==-1);
+  }
+
+  SECTION ("copy_file") {
+    // Successful copies, including an empty file, leave no temporary around
+    const std::string dst = dir + "/copy.txt";
+    REQUIRE (copy_file(file,dst));
+    REQUIRE (read_file(dst)=="0123456789");
+    REQUIRE (get_file_size(dst+".tmp")==-1);
+
+    write_file("io_utils_empty.txt","");
+    REQUIRE (copy_file("io_utils_empty.txt",dst));
+    REQUIRE (get_file_size(dst)==0);
+
+    // Missing src, or src is a directory
+    REQUIRE (not copy_file("io_utils_missing",dst));
+    REQUIRE (not copy_file(dir,dst));
+    REQUIRE (get_file_size(dst+".tmp")==-1);
+
+    // Cannot create the temporary in a missing directory
+    REQUIRE (not copy_file(file,"io_utils_missing/copy.txt"));
+
+    // The final rename fails (dst is a non-empty directory): the temporary is removed
+    REQUIRE (not copy_file(file,dir));
+    REQUIRE (get_file_size(dir+".tmp")==-1);
+    REQUIRE (is_directory(dir));
+  }
+}
+
+TEST_CASE("find_valid_staged_copy","io")
+{
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // Each rank works on its own files
+  const std::string rank   = std::to_string(comm.rank());
+  const std::string stage  = "io_utils_staging_" + rank;
+  const std::string name   = "io_utils_restart_" + rank + ".nc";
+  const std::string staged = stage + "/" + name;
+  const std::string drained = "drained_" + rank + "/" + name;
+  mkdir(stage.c_str(),0755);
+  mkdir(("drained_" + rank).c_str(),0755);
+  std::remove(staged.c_str());
+
+  // No staging dir: always use the drained file
+  write_file(drained,"restart data");
+  REQUIRE (find_valid_staged_copy(drained,"",comm)==drained);
+
+  // No staged copy
+  REQUIRE (find_valid_staged_copy(drained,stage,comm)==drained);
+
+  // Valid staged copy: same size, and not modified after the drain
+  write_file(staged,"restart data");
+  set_mtime(staged,1000);
+  set_mtime(drained,2000);
+  REQUIRE (find_valid_staged_copy(drained,stage,comm)==staged);
+
+  // The staged copy was overwritten after the drain, even if with the same size
+  write_file(staged,"RESTART DATA");
+  set_mtime(staged,3000);
+  REQUIRE (find_valid_staged_copy(drained,stage,comm)==drained);
+
+  // Different size
+  write_file(staged,"restart");
+  set_mtime(staged,1000);
+  REQUIRE (find_valid_staged_copy(drained,stage,comm)==drained);
+}
+
+} // anonymous namespace
@@ -66,6 +66,13 @@ MassAndEnergyColumnConservationCheck (const std::shared_ptr<const AbstractGrid>&
                    "Error! If a process adds this check, it must define all "
                    "boundary fluxes. Fluxes which are not relevant to a "
                    "certain process should be set to 0.\n");
+
+  for (const auto& it : m_fields) {
+    EKAT_REQUIRE_MSG(it.second->data_type()==DataType::RealType,
+                     "Error! Mass and energy conservation check only supports "
+                     "fields with Real data type.\n"
+                     "  - field id: " + it.second->get_header().get_identifier().get_id_string() + "\n");
+  }
 }
 
 void MassAndEnergyColumnConservationCheck::compute_current_mass ()
@@ -214,11 +214,23 @@ public:
   {
     m_name = params.name();
     m_grid_name = params.get<std::string> ("Grid Name");
+    m_buffer_bytes = params.get<int>("buffer_bytes",0);
   }
 
   // Return some sort of name, linked to PType
   std::string name () const { return m_name; }
 
+  // Optional local memory, from the ATMBufferManager
+  size_t requested_buffer_size_in_bytes () const { return m_buffer_bytes; }
+  void init_buffers (const ATMBufferManager& buffer_manager) {
+    EKAT_REQUIRE (buffer_manager.allocated_bytes()>=m_buffer_bytes);
+    m_buffer = buffer_manager.get_memory();
+    m_buffer_size = m_buffer_bytes/sizeof(Real);
+  }
+
+  Real*  m_buffer = nullptr;
+  size_t m_buffer_size = 0;
+
 protected:
 
   // The initialization method should prepare all stuff needed to import/export from/to
@@ -234,6 +246,7 @@ protected:
 
   std::string m_name;
   std::string m_grid_name;
+  size_t m_buffer_bytes;
 };
 
 class Foo : public DummyProcess
@@ -338,6 +351,58 @@ protected:
   }
 };
 
+// Updates Field A as a*A+b, working with scalar type ST. Checks that A>=1 on input.
+template<typename ST>
+class Affine : public DummyProcess
+{
+public:
+  Affine (const ekat::Comm& comm,const ekat::ParameterList& params)
+   : DummyProcess(comm,params)
+  {
+    m_a = params.get<double>("a");
+    m_b = params.get<double>("b");
+  }
+
+  // The type of the atm proc
+  AtmosphereProcessType type () const { return AtmosphereProcessType::Physics; }
+
+  void set_grids (const std::shared_ptr<const GridsManager> gm) {
+    using namespace ekat::units;
+
+    m_grid = gm->get_grid(m_grid_name);
+    const auto lt = m_grid->get_2d_scalar_layout ();
+
+    add_field<Updated>("Field A",lt,K,m_grid_name,field_valid_data_types().at<ST>());
+  }
+
+  // The time stamp of Field A seen by the last run
+  util::TimeStamp m_ts_in;
+
+protected:
+  void initialize_impl (const RunType /* run_type */) {
+    add_precondition_check<FieldLowerBoundCheck>(get_field_in("Field A"),m_grid,1,false);
+  }
+
+  void run_impl (const double /* dt */) {
+    m_ts_in = get_field_in("Field A").get_header().get_tracking().get_time_stamp();
+
+    auto& f = get_field_out("Field A");
+    f.sync_to_host();
+    auto v = f.get_view<ST*,Host>();
+    for (int i=0; i<v.extent_int(0); ++i) {
+      v[i] = static_cast<ST>(m_a)*v[i] + static_cast<ST>(m_b);
+    }
+    f.sync_to_dev();
+
+    // Local memory holds no data between runs, so scribble on it
+    using view_1d = Kokkos::View<Real*,Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+    Kokkos::deep_copy(view_1d(m_buffer,m_buffer_size),-1);
+  }
+
+  double m_a, m_b;
+  std::shared_ptr<const AbstractGrid> m_grid;
+};
+
 // ================================ TESTS ============================== //
 
 TEST_CASE("process_factory", "") {
@@ -690,4 +755,186 @@ TEST_CASE ("diagnostics") {
   }
 }
 
+TEST_CASE ("precision_copies") {
+  using namespace scream;
+
+  // A world comm
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // A time stamp
+  util::TimeStamp t0 ({2022,1,1},{0,0,0});
+
+  // Create a grids manager
+  auto gm = create_gm(comm);
+  auto grid = gm->get_grid("Point Grid");
+
+  // Two processes updating Field A, one in single and one in double precision
+  ekat::ParameterList params_f("AffineFloat"), params_d("AffineDouble");
+  params_f.set<std::string>("Grid Name", "Point Grid");
+  params_f.set<double>("a", 2.0);
+  params_f.set<double>("b", 0.0);
+  params_d.set<std::string>("Grid Name", "Point Grid");
+  params_d.set<double>("a", 1.0);
+  params_d.set<double>("b", 0.5);
+  auto ap_f = std::make_shared<Affine<float>>(comm,params_f);
+  auto ap_d = std::make_shared<Affine<double>>(comm,params_d);
+  ap_f->set_grids(gm);
+  ap_d->set_grids(gm);
+
+  // As in the FieldManager, the field is stored in the widest precision requested.
+  // Use values that are not representable in single precision.
+  const auto lt = grid->get_2d_scalar_layout();
+  Field f(FieldIdentifier("Field A",lt,ekat::units::K,"Point Grid",DataType::DoubleType));
+  f.allocate_view();
+  auto v = f.get_view<double*,Host>();
+  std::vector<double> expected(v.size());
+  for (size_t i=0; i<v.size(); ++i) {
+    v[i] = expected[i] = 1 + 0.1*i;
+  }
+  f.sync_to_dev();
+  f.get_header().get_tracking().update_time_stamp(t0);
+
+  ap_f->set_computed_field(f);
+  ap_f->set_required_field(f.get_const());
+  ap_d->set_computed_field(f);
+  ap_d->set_required_field(f.get_const());
+  ap_f->initialize(t0,RunType::Initial);
+  ap_d->initialize(t0,RunType::Initial);
+
+  // The float process works on a converted copy, the double one on the stored field,
+  // while the stored field is what both processes expose to the DAG
+  REQUIRE (ap_f->get_field_in("Field A").data_type()==DataType::FloatType);
+  REQUIRE (ap_f->get_field_out("Field A").data_type()==DataType::FloatType);
+  REQUIRE (ap_d->get_field_out("Field A").data_type()==DataType::DoubleType);
+  REQUIRE (ap_f->get_fields_in().front().data_type()==DataType::DoubleType);
+  REQUIRE (ap_f->get_fields_out().front().data_type()==DataType::DoubleType);
+
+  const int dt = 10;
+  for (int step=0; step<3; ++step) {
+    const auto t_beg = t0 + step*dt;
+    const auto t_end = t0 + (step+1)*dt;
+
+    // The copy-in converts the current values, and brings the time stamp along
+    ap_f->run(dt);
+    for (auto& e : expected) {
+      e = 2.0f*static_cast<float>(e);
+    }
+    f.sync_to_host();
+    for (size_t i=0; i<v.size(); ++i) {
+      REQUIRE (v[i]==expected[i]);
+    }
+    REQUIRE (ap_f->m_ts_in==t_beg);
+
+    // Both the stored field and the copy of an Updated field get the new time stamp
+    REQUIRE (f.get_header().get_tracking().get_time_stamp()==t_end);
+    REQUIRE (ap_f->get_field_out("Field A").get_header().get_tracking().get_time_stamp()==t_end);
+
+    // The double process sees the values copied out by the float one
+    ap_d->run(dt);
+    for (auto& e : expected) {
+      e = e + 0.5;
+    }
+    f.sync_to_host();
+    for (size_t i=0; i<v.size(); ++i) {
+      REQUIRE (v[i]==expected[i]);
+    }
+    REQUIRE (ap_d->m_ts_in==t_end);
+  }
+
+  // The pre-condition check of the float process acts on its copy, which must
+  // hold the current values when the check runs, not the ones of the last run.
+  f.deep_copy(0.0);
+  REQUIRE_THROWS (ap_f->run(dt));
+}
+
+TEST_CASE ("group_buffers") {
+  using namespace scream;
+
+  // A world comm
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // A time stamp
+  util::TimeStamp t0 ({2022,1,1},{0,0,0});
+
+  // Create a grids manager
+  auto gm = create_gm(comm);
+  auto grid = gm->get_grid("Point Grid");
+
+  auto& factory = AtmosphereProcessFactory::instance();
+  factory.register_product("AffineFloat",&create_atmosphere_process<Affine<float>>);
+  factory.register_product("AffineDouble",&create_atmosphere_process<Affine<double>>);
+  factory.register_product("grouP",&create_atmosphere_process<AtmosphereProcessGroup>);
+
+  // A nested group, (AD1,(AD2,AF)), where AF works on a float copy of Field A
+  ekat::ParameterList params ("Atmosphere Processes");
+  params.set<std::string>("schedule_type","Sequential");
+  params.set<std::string>("atm_procs_list","(AD1,Inner)");
+  auto set_proc_params = [](ekat::ParameterList& p, const std::string& type,
+                            const int buffer_bytes, const double b) {
+    p.set<std::string>("Type", type);
+    p.set<std::string>("Grid Name", "Point Grid");
+    p.set<int>("buffer_bytes", buffer_bytes);
+    p.set<double>("a", 1.0);
+    p.set<double>("b", b);
+  };
+  set_proc_params(params.sublist("AD1"),"AffineDouble",1000,0.5);
+  auto& inner = params.sublist("Inner");
+  inner.set<std::string>("Type", "Group");
+  inner.set<std::string>("schedule_type","Sequential");
+  inner.set<std::string>("atm_procs_list","(AD2,AF)");
+  set_proc_params(inner.sublist("AD2"),"AffineDouble",3000,0.25);
+  set_proc_params(inner.sublist("AF"),"AffineFloat",500,0.5);
+
+  auto group = std::dynamic_pointer_cast<AtmosphereProcessGroup>(
+      std::shared_ptr<AtmosphereProcess>(factory.create("group",comm,params)));
+  group->set_grids(gm);
+
+  // Field A is stored in double precision
+  Field f(FieldIdentifier("Field A",grid->get_2d_scalar_layout(),ekat::units::K,
+                          "Point Grid",DataType::DoubleType));
+  f.allocate_view();
+  f.deep_copy(1.0);
+  f.get_header().get_tracking().update_time_stamp(t0);
+  group->set_computed_field(f);
+  group->set_required_field(f.get_const());
+
+  ATMBufferManager bm;
+  bm.request_bytes(group->requested_buffer_size_in_bytes());
+  bm.allocate();
+  group->init_buffers(bm);
+
+  // Procs run one at a time, so they all get the start of the buffer for their
+  // local memory, followed by their precision copies. Only AF has precision copies.
+  auto inner_group = std::dynamic_pointer_cast<const AtmosphereProcessGroup>(group->get_process(1));
+  const std::vector<std::shared_ptr<const AtmosphereProcess>> procs =
+    {group->get_process(0), inner_group->get_process(0), inner_group->get_process(1)};
+  for (const auto& ap : procs) {
+    auto dp = std::dynamic_pointer_cast<const DummyProcess>(ap);
+    REQUIRE (dp->m_buffer==bm.get_memory());
+  }
+  auto af = procs[2];
+  REQUIRE (procs[0]->requested_precision_copies_bytes()==0);
+  REQUIRE (procs[1]->requested_precision_copies_bytes()==0);
+  REQUIRE (af->requested_precision_copies_bytes()>0);
+
+  // AF's copy starts after its local memory (500 bytes, padded to 512)
+  const auto af_copy = af->get_field_out("Field A").get_internal_view_data<const float>();
+  REQUIRE (reinterpret_cast<const char*>(af_copy)==reinterpret_cast<const char*>(bm.get_memory())+512);
+
+  // The buffer is as large as the largest proc needs, and no larger
+  const size_t af_bytes = 512 + af->requested_precision_copies_bytes();
+  REQUIRE (bm.allocated_bytes()==std::max<size_t>(af_bytes,3008));
+  REQUIRE (inner_group->requested_buffer_size_in_bytes()==bm.allocated_bytes());
+
+  // Run: AD2 scribbles on its memory, which aliases AF's copy. AF's
+  // pre-condition check (Field A>=1) must see the copied-in values.
+  group->initialize(t0,RunType::Initial);
+  REQUIRE_NOTHROW (group->run(10));
+  f.sync_to_host();
+  auto v = f.get_view<const double*,Host>();
+  for (int i=0; i<v.extent_int(0); ++i) {
+    REQUIRE (v[i]==2.25);
+  }
+}
+
 } // empty namespace
@@ -200,6 +200,42 @@ TEST_CASE("field", "") {
     }
   }
 
+  SECTION ("deep_copy_precision") {
+    FieldIdentifier fid_f("f",fid.get_layout(),m/s,"some_grid",DataType::FloatType);
+    FieldIdentifier fid_d("d",fid.get_layout(),m/s,"some_grid",DataType::DoubleType);
+    FieldIdentifier fid_i("i",fid.get_layout(),m/s,"some_grid",DataType::IntType);
+
+    Field ff(fid_f), fd(fid_d), fi(fid_i);
+    ff.allocate_view();
+    fd.allocate_view();
+    fi.allocate_view();
+
+    fd.deep_copy(0.5);
+    ff.deep_copy(fd);
+    ff.sync_to_host();
+    auto vf = ff.get_view<float**,Host>();
+    for (int i=0; i<dims[0]; ++i)
+      for (int j=0; j<dims[1]; ++j) {
+        REQUIRE (vf(i,j)==0.5f);
+      }
+
+    ff.deep_copy(0.25f);
+    fd.deep_copy(ff);
+    fd.sync_to_host();
+    auto vd = fd.get_view<double**,Host>();
+    for (int i=0; i<dims[0]; ++i)
+      for (int j=0; j<dims[1]; ++j) {
+        REQUIRE (vd(i,j)==0.25);
+      }
+
+    // Can't convert between int and floating point fields
+    REQUIRE_THROWS (fi.deep_copy(fd));
+    REQUIRE_THROWS (ff.deep_copy(fi));
+
+    // Subfields keep the data type of the parent
+    REQUIRE (ff.subfield(0,1).data_type()==DataType::FloatType);
+  }
+
   // Subfields
   SECTION ("subfield") {
     std::vector<FieldTag> t1 = {COL,CMP,CMP,LEV};
@@ -522,6 +558,56 @@ TEST_CASE("field_mgr", "") {
   REQUIRE (views_are_equal(f4_sf,f4.get_component(subview_slice)));
 }
 
+TEST_CASE("field_mgr_precision", "") {
+  using namespace scream;
+  using namespace ekat::units;
+  using namespace ShortFieldTagsNames;
+  using FID = FieldIdentifier;
+  using FR  = FieldRequest;
+
+  const int ncols = 4;
+  const int nlevs = 7;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+  auto pg = create_point_grid("phys",ncols*comm.size(),nlevs,comm);
+  const auto layout = pg->get_3d_scalar_layout(true);
+
+  FID a_f("a", layout, m/s, "phys", DataType::FloatType);
+  FID b_f("b", layout, m/s, "phys", DataType::FloatType);
+  FID b_d("b", layout, m/s, "phys", DataType::DoubleType);
+  FID c_i("c", layout, m/s, "phys", DataType::IntType);
+  FID c_f("c", layout, m/s, "phys", DataType::FloatType);
+
+  FieldManager field_mgr(pg);
+  field_mgr.registration_begins();
+
+  // A field requested only as float is stored as float
+  field_mgr.register_field(FR(a_f));
+  field_mgr.register_field(FR(a_f,4));
+
+  // A field requested as float and double is stored as double,
+  // and keeps the allocation requests made before the promotion
+  field_mgr.register_field(FR(b_f,16));
+  field_mgr.register_field(FR(b_d));
+
+  // Int fields cannot be requested as floating point
+  field_mgr.register_field(FR(c_i));
+  REQUIRE_THROWS (field_mgr.register_field(FR(c_f)));
+
+  field_mgr.registration_ends();
+
+  auto a = field_mgr.get_field("a");
+  auto b = field_mgr.get_field("b");
+  REQUIRE (a.data_type()==DataType::FloatType);
+  REQUIRE (b.data_type()==DataType::DoubleType);
+  REQUIRE (b.get_header().get_alloc_properties().get_padding()==ekat::PackInfo<16>::padding(nlevs));
+
+  // Fields can be retrieved by name, but an identifier with a different
+  // precision does not match the stored field
+  REQUIRE (field_mgr.has_field(b_d));
+  REQUIRE (not field_mgr.has_field(b_f));
+}
+
 TEST_CASE("tracers_bundle", "") {
   using namespace scream;
   using namespace ekat::units;
@@ -1,7 +1,14 @@
 #include "share/util/scream_timing.hpp"
+#include "share/util/scream_utils.hpp"
+
+#include <ekat/ekat_assert.hpp>
 
 #include <gptl.h>
 
+#include <algorithm>
+#include <set>
+#include <sstream>
+
 namespace scream {
 
 void init_gptl (bool& was_already_inited) {
@@ -28,4 +35,162 @@ void write_timers_to_file (const ekat::Comm& comm, const std::string& fname) {
   GPTLpr_summary_file (comm.mpi_comm(),fname.c_str());
 }
 
+namespace {
+// Names of all the timers that exist on this rank (master thread only)
+std::set<std::string> get_local_timers_names () {
+  std::set<std::string> names;
+  int nregions = 0;
+  if (GPTLget_nregions(0,&nregions)!=0) {
+    return names;
+  }
+  constexpr int max_chars = 128;
+  char name[max_chars+1];
+  for (int i=0; i<nregions; ++i) {
+    if (GPTLget_regionname(0,i,name,max_chars)==0) {
+      name[max_chars] = '\0';
+      names.insert(name);
+    }
+  }
+  return names;
+}
+} // anonymous namespace
+
+TimerSnapshots::
+TimerSnapshots (const ekat::Comm& comm, const std::string& fname,
+                const bool per_rank_files)
+ : m_comm (comm)
+ , m_fname (fname)
+ , m_per_rank_files (per_rank_files)
+{
+  EKAT_REQUIRE_MSG (fname!="",
+      "Error! Invalid (empty) file name for timer snapshots.\n");
+}
+
+void TimerSnapshots::setup_files ()
+{
+  if (m_comm.am_i_root()) {
+    m_summary_file.reset(new std::ofstream(m_fname));
+    EKAT_REQUIRE_MSG (m_summary_file->good(),
+        "Error! Could not open timer snapshots file '" + m_fname + "'.\n");
+    *m_summary_file << "step,timer,count_max,wall_min,wall_max,wall_mean\n";
+  }
+  if (m_per_rank_files) {
+    const auto rank_fname = m_fname + ".rank" + std::to_string(m_comm.rank()) + ".csv";
+    m_rank_file.reset(new std::ofstream(rank_fname));
+    EKAT_REQUIRE_MSG (m_rank_file->good(),
+        "Error! Could not open timer snapshots file '" + rank_fname + "'.\n");
+    *m_rank_file << "step,timer,count,wall\n";
+  }
+  m_files_set = true;
+}
+
+void TimerSnapshots::sync_timers ()
+{
+  // Rank 0 decides which timers are tracked. Timers are only ever added, so
+  // rank 0 only needs to share the names it did not track yet.
+  const auto local_names = get_local_timers_names();
+  std::string new_names;
+  if (m_comm.am_i_root()) {
+    for (const auto& n : local_names) {
+      if (std::find(m_names.begin(),m_names.end(),n)==m_names.end()) {
+        new_names += n + "\n";
+      }
+    }
+  }
+  broadcast_string(new_names,m_comm,m_comm.root_rank());
+
+  std::istringstream iss (new_names);
+  std::string n;
+  while (std::getline(iss,n)) {
+    m_names.push_back(n);
+  }
+
+  // Timers may also appear on this rank after they appeared on rank 0
+  const int num_timers = m_names.size();
+  m_available.resize(num_timers);
+  for (int i=0; i<num_timers; ++i) {
+    m_available[i] = local_names.count(m_names[i])==1;
+  }
+  m_last_wall.resize(num_timers,0);
+  m_last_count.resize(num_timers,0);
+}
+
+namespace {
+// Each timer contributes a tuple (wall_min, wall_max, wall_sum, count_max),
+// so that a single reduction computes all the stats.
+constexpr int num_stats = 4;
+void reduce_timer_stats (void* in, void* inout, int* len, MPI_Datatype* /* dtype */) {
+  const double* a = reinterpret_cast<const double*>(in);
+  double* b = reinterpret_cast<double*>(inout);
+  for (int i=0; i<*len; ++i, a+=num_stats, b+=num_stats) {
+    b[0] = std::min(a[0],b[0]);
+    b[1] = std::max(a[1],b[1]);
+    b[2] += a[2];
+    b[3] = std::max(a[3],b[3]);
+  }
+}
+} // anonymous namespace
+
+void TimerSnapshots::snapshot (const int step)
+{
+  if (not m_files_set) {
+    setup_files();
+  }
+  sync_timers();
+
+  const int num_timers = m_names.size();
+  std::vector<double> wall(num_timers,0);
+  std::vector<int> count(num_timers,0);
+  for (int i=0; i<num_timers; ++i) {
+    if (not m_available[i]) {
+      continue;
+    }
+    int cnt, onflg;
+    double wallclock, usr, sys;
+    if (GPTLquery(m_names[i].c_str(),0,&cnt,&onflg,&wallclock,&usr,&sys,nullptr,0)!=0) {
+      continue;
+    }
+    wall[i]  = wallclock - m_last_wall[i];
+    count[i] = cnt - m_last_count[i];
+    m_last_wall[i]  = wallclock;
+    m_last_count[i] = cnt;
+  }
+
+  if (m_rank_file) {
+    for (int i=0; i<num_timers; ++i) {
+      *m_rank_file << step << "," << m_names[i] << "," << count[i] << "," << wall[i] << "\n";
+    }
+    m_rank_file->flush();
+  }
+
+  // Pack the stats of all timers, and reduce them onto root in one go.
+  // Unlike all_reduce, this does not sync all ranks.
+  std::vector<double> local(num_stats*num_timers), global(num_stats*num_timers);
+  for (int i=0; i<num_timers; ++i) {
+    local[num_stats*i+0] = wall[i];
+    local[num_stats*i+1] = wall[i];
+    local[num_stats*i+2] = wall[i];
+    local[num_stats*i+3] = count[i];
+  }
+  MPI_Datatype stats_type;
+  MPI_Op stats_op;
+  MPI_Type_contiguous(num_stats,MPI_DOUBLE,&stats_type);
+  MPI_Type_commit(&stats_type);
+  MPI_Op_create(&reduce_timer_stats,1,&stats_op);
+  MPI_Reduce(local.data(),global.data(),num_timers,stats_type,stats_op,
+             m_comm.root_rank(),m_comm.mpi_comm());
+  MPI_Op_free(&stats_op);
+  MPI_Type_free(&stats_type);
+
+  if (m_summary_file) {
+    const double size = m_comm.size();
+    for (int i=0; i<num_timers; ++i) {
+      const double* stats = global.data() + num_stats*i;
+      *m_summary_file << step << "," << m_names[i] << "," << static_cast<int>(stats[3]) << ","
+                      << stats[0] << "," << stats[1] << "," << stats[2]/size << "\n";
+    }
+    m_summary_file->flush();
+  }
+}
+
 } // namespace scream
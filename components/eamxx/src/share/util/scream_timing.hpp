@@ -4,6 +4,9 @@
 #include <ekat/mpi/ekat_comm.hpp>
 
 #include <string>
+#include <vector>
+#include <fstream>
+#include <memory>
 
 namespace scream {
 
@@ -17,6 +20,52 @@ void stop_timer (const std::string& name);
 
 void write_timers_to_file (const ekat::Comm& comm, const std::string& fname);
 
+// Periodic snapshots of the GPTL timers, to monitor performance during the run
+// (rather than only via the cumulative totals printed at finalization).
+// Each call to snapshot computes, for every timer, the wall time and number of
+// calls accumulated since the previous snapshot. These deltas are then reduced
+// across ranks (min/max/mean of wall time, max of count) onto rank 0, which
+// appends one line per timer to the csv file
+//   step,timer,count_max,wall_min,wall_max,wall_mean
+// If per_rank_files=true, each rank also appends its own deltas to
+// <fname>.rank<N>.csv, with lines
+//   step,timer,count,wall
+// Notes:
+//  - the set of timers is the one present on rank 0, and it is updated at each
+//    snapshot, so timers created during the run are tracked from the first
+//    snapshot after their creation. Timers missing on a rank count as zero on
+//    that rank.
+//  - the stats of all timers are packed in a single buffer, and reduced with
+//    a single MPI_Reduce.
+//  - only the master thread timers are queried.
+//  - snapshot is collective over comm, but it only involves reductions to
+//    rank 0 (no barrier), and it is meant to be called every N steps.
+class TimerSnapshots {
+public:
+  TimerSnapshots (const ekat::Comm& comm, const std::string& fname,
+                  const bool per_rank_files = false);
+
+  void snapshot (const int step);
+
+protected:
+
+  void setup_files ();
+  void sync_timers ();
+
+  ekat::Comm    m_comm;
+  std::string   m_fname;
+  bool          m_per_rank_files;
+  bool          m_files_set = false;
+
+  std::vector<std::string>  m_names;
+  std::vector<char>         m_available;  // Whether the timer exists on this rank
+  std::vector<double>       m_last_wall;
+  std::vector<int>          m_last_count;
+
+  std::unique_ptr<std::ofstream>  m_summary_file;
+  std::unique_ptr<std::ofstream>  m_rank_file;
+};
+
 } // namespace scream
 
 #endif // SCREAM_TIMING_HPP
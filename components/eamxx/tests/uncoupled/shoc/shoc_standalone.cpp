@@ -9,6 +9,7 @@
 #include "share/atm_process/atmosphere_process.hpp"
 
 #include "ekat/ekat_parse_yaml_file.hpp"
+#include "ekat/util/ekat_test_utils.hpp"
 
 #include <iomanip>
 
@@ -22,7 +23,8 @@ TEST_CASE("shoc-stand-alone", "") {
   ekat::Comm atm_comm (MPI_COMM_WORLD);
 
   // Load ad parameter list
-  std::string fname = "input.yaml";
+  const auto& session = ekat::TestSession::get();
+  std::string fname = session.params.at("ifile");
   ekat::ParameterList ad_params("Atmosphere Driver");
   
   #ifndef KOKKOS_ENABLE_HIP
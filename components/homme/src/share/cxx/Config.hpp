@@ -43,6 +43,12 @@
 # define HOMMEXX_CUDA_MAX_WARP_PER_TEAM 1
 #endif
 
+// The shared memory halo exchange writes directly into the peers' buffers from
+// the pack kernels, so it requires the execution space memory to be host memory.
+#if defined HOMMEXX_MPI_SHM_EXCHANGE && defined HOMMEXX_ENABLE_GPU
+# undef HOMMEXX_MPI_SHM_EXCHANGE
+#endif
+
 #if defined KOKKOS_COMPILER_GNU
 // See https://github.com/kokkos/kokkos-kernels/issues/129
 # define ConstExceptGnu
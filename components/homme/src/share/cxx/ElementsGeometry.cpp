@@ -37,7 +37,7 @@ void ElementsGeometry::init(const int num_elems, const bool consthv, const bool
   m_rspheremp = ExecViewManaged<Real * [NP][NP]>("RSPHEREMP", m_num_elems);
 
   // Metric
-  m_metinv = ExecViewManaged<Real * [2][2][NP][NP]>("METINV", m_num_elems);
+  m_metinv = ExecViewManaged<GeoReal * [2][2][NP][NP]>("METINV", m_num_elems);
   m_metdet = ExecViewManaged<Real * [NP][NP]>("METDET", m_num_elems);
 
   if(!consthv){
@@ -48,8 +48,8 @@ void ElementsGeometry::init(const int num_elems, const bool consthv, const bool
   m_phis     = ExecViewManaged<Real *    [NP][NP]>("PHIS",          m_num_elems);
 
   //matrix D and its derivatives 
-  m_d    = ExecViewManaged<Real * [2][2][NP][NP]>("matrix D",                   m_num_elems);
-  m_dinv = ExecViewManaged<Real * [2][2][NP][NP]>("DInv - inverse of matrix D", m_num_elems);
+  m_d    = ExecViewManaged<GeoReal * [2][2][NP][NP]>("matrix D",                   m_num_elems);
+  m_dinv = ExecViewManaged<GeoReal * [2][2][NP][NP]>("DInv - inverse of matrix D", m_num_elems);
 
   if (alloc_gradphis) {
     m_gradphis = decltype(m_gradphis) ("gradient of geopotential at surface", m_num_elems);
@@ -76,6 +76,7 @@ set_elem_data (const int ie,
 
   using ScalarView   = ExecViewUnmanaged<Real [NP][NP]>;
   using TensorView   = ExecViewUnmanaged<Real [2][2][NP][NP]>;
+  using GeoTensorView = ExecViewUnmanaged<GeoReal [2][2][NP][NP]>;
   using Tensor23View = ExecViewUnmanaged<Real [2][3][NP][NP]>;
 
   using ScalarViewF90   = HostViewUnmanaged<const Real [NP][NP]>;
@@ -86,9 +87,9 @@ set_elem_data (const int ie,
   ScalarView::HostMirror h_metdet    = Kokkos::create_mirror_view(Homme::subview(m_metdet,ie));
   ScalarView::HostMirror h_spheremp  = Kokkos::create_mirror_view(Homme::subview(m_spheremp,ie));
   ScalarView::HostMirror h_rspheremp = Kokkos::create_mirror_view(Homme::subview(m_rspheremp,ie));
-  TensorView::HostMirror h_metinv    = Kokkos::create_mirror_view(Homme::subview(m_metinv,ie));
-  TensorView::HostMirror h_d         = Kokkos::create_mirror_view(Homme::subview(m_d,ie));
-  TensorView::HostMirror h_dinv      = Kokkos::create_mirror_view(Homme::subview(m_dinv,ie));
+  GeoTensorView::HostMirror h_metinv = Kokkos::create_mirror_view(Homme::subview(m_metinv,ie));
+  GeoTensorView::HostMirror h_d      = Kokkos::create_mirror_view(Homme::subview(m_d,ie));
+  GeoTensorView::HostMirror h_dinv   = Kokkos::create_mirror_view(Homme::subview(m_dinv,ie));
 
   TensorView::HostMirror h_tensorvisc;
   Tensor23View::HostMirror h_vec_sph2cart;
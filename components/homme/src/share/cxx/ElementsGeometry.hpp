@@ -28,7 +28,7 @@ public:
   // Quadrature weights and metric tensor
   ExecViewManaged<Real * [NP][NP]>        m_spheremp;
   ExecViewManaged<Real * [NP][NP]>        m_rspheremp;
-  ExecViewManaged<Real * [2][2][NP][NP]>  m_metinv;
+  ExecViewManaged<GeoReal * [2][2][NP][NP]> m_metinv;
   ExecViewManaged<Real * [NP][NP]>        m_metdet;
   ExecViewManaged<Real * [2][2][NP][NP]>  m_tensorvisc;
   ExecViewManaged<Real * [2][3][NP][NP]>  m_vec_sph2cart;
@@ -37,9 +37,10 @@ public:
   ExecViewManaged<Real *    [NP][NP]> m_phis;
   ExecViewManaged<Real * [2][NP][NP]> m_gradphis;
 
-  // D (map for covariant coordinates) and D^{-1}
-  ExecViewManaged<Real * [2][2][NP][NP]> m_d;
-  ExecViewManaged<Real * [2][2][NP][NP]> m_dinv;
+  // D (map for covariant coordinates) and D^{-1}.
+  // Like m_metinv, they are stored as GeoReal (see Types.hpp).
+  ExecViewManaged<GeoReal * [2][2][NP][NP]> m_d;
+  ExecViewManaged<GeoReal * [2][2][NP][NP]> m_dinv;
 
   // (x,y,z) points of GLL nodes
   ExecViewManaged<Real * [NP][NP][3]> m_sphere_cart;
@@ -18,6 +18,7 @@
 #include "HybridVCoord.hpp"
 #include "SimulationParams.hpp"
 #include "SphereOperators.hpp"
+#include "TeamPolicyTuner.hpp"
 #include "Tracers.hpp"
 #include "profiling.hpp"
 #include "mpi/BoundaryExchange.hpp"
@@ -110,6 +111,9 @@ class EulerStepFunctorImpl {
 
   ThreadPreferences m_tpref;
 
+  // Picks (#threads,#vectors) for the num_elems*qsize policies (and m_tu_ne_qsize)
+  TeamPolicyTuner m_tuner;
+
   std::shared_ptr<BoundaryExchange> m_mm_be, m_mmqb_be;
   Kokkos::Array<std::shared_ptr<BoundaryExchange>, 3*Q_NUM_TIME_LEVELS> m_bes;
 
@@ -195,6 +199,11 @@ public:
       m_tu_ne_qsize = TeamUtils<ExecSpace>(tp_ne_qsize);
 
       m_sphere_ops.allocate_buffers(m_tu_ne_qsize);
+
+      // If a tuned configuration is cached, use it right away.
+      m_tuner.init<ExecSpace>("euler_step", m_geometry.num_elems(), m_data.qsize,
+                              num_parallel_iterations, m_tpref);
+      m_tu_ne_qsize = TeamUtils<ExecSpace>(m_tuner.make_policy<ExecSpace>(num_parallel_iterations));
     }
   }
 
@@ -301,12 +310,12 @@ public:
     m_data.rhs_viss = 3.0;
 
     if(m_data.nu_p > 0){
-    Kokkos::parallel_for(Homme::get_default_team_policy<ExecSpace, BIHPreNup>(
-                           m_geometry.num_elems() * m_data.qsize, m_tpref),
+    Kokkos::parallel_for(m_tuner.make_policy<ExecSpace, BIHPreNup>(
+                           m_geometry.num_elems() * m_data.qsize),
                          *this);
     }else{
-    Kokkos::parallel_for(Homme::get_default_team_policy<ExecSpace, BIHPreNoNup>(
-                           m_geometry.num_elems() * m_data.qsize, m_tpref),
+    Kokkos::parallel_for(m_tuner.make_policy<ExecSpace, BIHPreNoNup>(
+                           m_geometry.num_elems() * m_data.qsize),
                          *this);
 
     }
@@ -320,12 +329,12 @@ public:
     assert(m_data.rhs_multiplier == 2.0);
 
     if(m_data.consthv){
-    Kokkos::parallel_for(Homme::get_default_team_policy<ExecSpace, BIHPostConstHV>(
-                           m_geometry.num_elems() * m_data.qsize, m_tpref),
+    Kokkos::parallel_for(m_tuner.make_policy<ExecSpace, BIHPostConstHV>(
+                           m_geometry.num_elems() * m_data.qsize),
                          *this);
     }else{
-    Kokkos::parallel_for(Homme::get_default_team_policy<ExecSpace, BIHPostTensorHV>(
-                           m_geometry.num_elems() * m_data.qsize, m_tpref),
+    Kokkos::parallel_for(m_tuner.make_policy<ExecSpace, BIHPostTensorHV>(
+                           m_geometry.num_elems() * m_data.qsize),
                          *this);
     }
     Kokkos::fence();
@@ -423,13 +432,21 @@ public:
       *this);
     Kokkos::fence();
     m_kernel_will_run_limiters = true;
+    const bool tuning = m_tuner.tuning();
+    if (tuning) {
+      m_tuner.start();
+    }
     Kokkos::parallel_for(
       //to play with launch bounds
-      //Homme::get_default_team_policy<ExecSpace, AALTracerPhase, Kokkos::LaunchBounds<128,1> >(
-      Homme::get_default_team_policy<ExecSpace, AALTracerPhase >(
-        m_geometry.num_elems() * m_data.qsize, m_tpref),
+      //m_tuner.make_policy<ExecSpace, AALTracerPhase, Kokkos::LaunchBounds<128,1> >(
+      m_tuner.make_policy<ExecSpace, AALTracerPhase >(
+        m_geometry.num_elems() * m_data.qsize),
       *this);
     Kokkos::fence();
+    if (tuning && m_tuner.stop()) {
+      m_tu_ne_qsize = TeamUtils<ExecSpace>(
+        m_tuner.make_policy<ExecSpace>(m_geometry.num_elems() * m_data.qsize));
+    }
     m_kernel_will_run_limiters = false;
     profiling_pause();
   }
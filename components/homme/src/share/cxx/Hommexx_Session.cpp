@@ -51,6 +51,13 @@ void print_homme_config_settings () {
     std::cout << "HOMMEXX CUDA_SHARE_BUFFER: on\n";
 #else
     std::cout << "HOMMEXX CUDA_SHARE_BUFFER: off\n";
+#endif
+#ifdef HOMMEXX_GEOMETRY_SINGLE_PRECISION
+    std::cout << "HOMMEXX GEOMETRY_SINGLE_PRECISION: on ("
+              << 3*4*NP*NP*(sizeof(Real)-sizeof(GeoReal))
+              << " bytes saved per element)\n";
+#else
+    std::cout << "HOMMEXX GEOMETRY_SINGLE_PRECISION: off\n";
 #endif
     std::cout << "HOMMEXX CUDA_(MIN/MAX)_WARP_PER_TEAM: " << HOMMEXX_CUDA_MIN_WARP_PER_TEAM
               << " / " << HOMMEXX_CUDA_MAX_WARP_PER_TEAM << "\n";
@@ -50,6 +50,24 @@ class SphereOperators
 
   template<int NUM_LEVELS>
   using DefaultProvider = ExecViewUnmanaged<const Scalar [NP][NP][NUM_LEVELS]>;
+
+  // The metric tensors are stored as GeoReal (see Types.hpp). This thin wrapper
+  // promotes each entry to Real as it is loaded, so that all the arithmetic in
+  // the operators is still done in Real. If GeoReal==Real, it is a no-op.
+  using GeoTensor = ExecViewUnmanaged<const GeoReal [2][2][NP][NP]>;
+  struct PromotedGeoTensor {
+    GeoTensor v;
+    KOKKOS_INLINE_FUNCTION
+    Real operator() (const int i, const int j, const int igp, const int jgp) const {
+      return static_cast<Real>(v(i,j,igp,jgp));
+    }
+  };
+
+  KOKKOS_INLINE_FUNCTION
+  static PromotedGeoTensor geo_subview (const ExecViewManaged<const GeoReal * [2][2][NP][NP]>& t,
+                                        const int ie) {
+    return PromotedGeoTensor{Homme::subview(t,ie)};
+  }
 public:
 
 
@@ -111,9 +129,9 @@ public:
 
   // This one is used in the unit tests
   void set_views (const ExecViewManaged<const Real         [NP][NP]>  dvv_in,
-                  const ExecViewManaged<const Real * [2][2][NP][NP]>  d,
-                  const ExecViewManaged<const Real * [2][2][NP][NP]>  dinv,
-                  const ExecViewManaged<const Real * [2][2][NP][NP]>  metinv,
+                  const ExecViewManaged<const GeoReal * [2][2][NP][NP]>  d,
+                  const ExecViewManaged<const GeoReal * [2][2][NP][NP]>  dinv,
+                  const ExecViewManaged<const GeoReal * [2][2][NP][NP]>  metinv,
                   const ExecViewManaged<const Real *       [NP][NP]>  metdet,
                   const ExecViewManaged<const Real *       [NP][NP]>  spheremp,
                   const ExecViewManaged<const Real         [NP][NP]>  mp)
@@ -137,7 +155,7 @@ public:
     // Make sure the buffers have been created
     assert (vector_buf_sl.size()>0);
 
-    const auto& D_inv = Homme::subview(m_dinv,kv.ie);
+    const auto& D_inv = geo_subview(m_dinv,kv.ie);
     const auto& temp_v_buf = Homme::subview(vector_buf_sl,kv.team_idx,0);
     constexpr int np_squared = NP * NP;
     // TODO: Use scratch space for this
@@ -176,7 +194,7 @@ public:
     assert (vector_buf_sl.size()>0);
 
     constexpr int np_squared = NP * NP;
-    const auto& D_inv = Homme::subview(m_dinv,kv.ie);
+    const auto& D_inv = geo_subview(m_dinv,kv.ie);
     const auto& temp_v_buf = Homme::subview(vector_buf_sl,kv.team_idx,0);
     Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, np_squared),
                          [&](const int loop_idx) {
@@ -214,7 +232,7 @@ public:
     assert (vector_buf_sl.size()>0);
 
     const auto& metdet = Homme::subview(m_metdet,kv.ie);
-    const auto& D_inv = Homme::subview(m_dinv,kv.ie);
+    const auto& D_inv = geo_subview(m_dinv,kv.ie);
     const auto& gv_buf = Homme::subview(vector_buf_sl,kv.team_idx,0);
     constexpr int np_squared = NP * NP;
     Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, np_squared),
@@ -252,7 +270,7 @@ public:
     // Make sure the buffers have been created
     assert (vector_buf_sl.size()>0);
 
-    const auto& D_inv = Homme::subview(m_dinv,kv.ie);
+    const auto& D_inv = geo_subview(m_dinv,kv.ie);
     const auto& spheremp = Homme::subview(m_spheremp,kv.ie);
     const auto& gv_buf = Homme::subview(vector_buf_sl,kv.team_idx,0);
 
@@ -307,7 +325,7 @@ public:
     // Make sure the buffers have been created
     assert (vector_buf_sl.size()>0);
 
-    const auto& D = Homme::subview(m_d,kv.ie);
+    const auto& D = geo_subview(m_d,kv.ie);
     const auto& metdet = Homme::subview(m_metdet,kv.ie);
     const auto& vcov_buf = Homme::subview(vector_buf_sl,kv.team_idx,0);
 
@@ -389,7 +407,7 @@ public:
     // Make sure the buffers have been created
     assert (vector_buf_ml.size()>0);
 
-    const auto& D_inv = Homme::subview(m_dinv, kv.ie);
+    const auto& D_inv = geo_subview(m_dinv,kv.ie);
 
     constexpr int np_squared = NP * NP;
     Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, np_squared),
@@ -436,7 +454,7 @@ public:
     // Make sure the buffers have been created
     assert (vector_buf_ml.size()>0);
 
-    const auto& D_inv = Homme::subview(m_dinv, kv.ie);
+    const auto& D_inv = geo_subview(m_dinv,kv.ie);
     constexpr int np_squared = NP * NP;
     Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, np_squared),
                          [&](const int loop_idx) {
@@ -499,7 +517,7 @@ public:
     // Make sure the buffers have been created
     assert (vector_buf_ml.size()>0);
 
-    const auto& D_inv = Homme::subview(m_dinv, kv.ie);
+    const auto& D_inv = geo_subview(m_dinv,kv.ie);
     const auto& metdet = Homme::subview(m_metdet, kv.ie);
     vector_buf<NUM_LEV_OUT> gv_buf(Homme::subview(vector_buf_ml,kv.team_idx, 0).data());
     constexpr int np_squared = NP * NP;
@@ -566,7 +584,7 @@ public:
     // Make sure the buffers have been created
     assert (vector_buf_ml.size()>0);
 
-    const auto& D_inv = Homme::subview(m_dinv, kv.ie);
+    const auto& D_inv = geo_subview(m_dinv,kv.ie);
     const auto& metdet = Homme::subview(m_metdet, kv.ie);
     vector_buf<NUM_LEV_REQUEST> gv(Homme::subview(vector_buf_ml,kv.team_idx,0).data());
     constexpr int np_squared = NP * NP;
@@ -618,7 +636,7 @@ public:
     // Make sure the buffers have been created
     assert (vector_buf_ml.size()>0);
 
-    const auto& D = Homme::subview(m_d, kv.ie);
+    const auto& D = geo_subview(m_d,kv.ie);
     const auto& metdet = Homme::subview(m_metdet, kv.ie);
     vector_buf<NUM_LEV_REQUEST> vcov_buf(Homme::subview(vector_buf_ml,kv.team_idx,0).data());
     constexpr int np_squared = NP * NP;
@@ -667,7 +685,7 @@ public:
     // Make sure the buffers have been created
     assert (vector_buf_ml.size()>0);
 
-    const auto& D = Homme::subview(m_d, kv.ie);
+    const auto& D = geo_subview(m_d,kv.ie);
     const auto& metdet = Homme::subview(m_metdet, kv.ie);
     vector_buf<NUM_LEV_OUT> sphere_buf(Homme::subview(vector_buf_ml,kv.team_idx,0).data());
     constexpr int np_squared = NP * NP;
@@ -731,7 +749,7 @@ public:
     // Make sure the buffers have been created
     assert (vector_buf_ml.size()>0);
 
-    const auto& D_inv = Homme::subview(m_dinv, kv.ie);
+    const auto& D_inv = geo_subview(m_dinv,kv.ie);
     const auto& spheremp = Homme::subview(m_spheremp, kv.ie);
     constexpr int np_squared = NP * NP;
     Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, np_squared),
@@ -864,7 +882,7 @@ public:
     // Make sure the buffers have been created
     assert (vector_buf_ml.size()>0);
 
-    const auto& D = Homme::subview(m_d, kv.ie);
+    const auto& D = geo_subview(m_d,kv.ie);
     vector_buf<NUM_LEV_OUT> sphere_buf(Homme::subview(vector_buf_ml,kv.team_idx,0).data());
     constexpr int np_squared = NP * NP;
     Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, np_squared), [&](const int loop_idx) {
@@ -924,7 +942,7 @@ public:
     // Make sure the buffers have been created
     assert (vector_buf_ml.size()>0);
 
-    const auto& D = Homme::subview(m_d, kv.ie);
+    const auto& D = geo_subview(m_d,kv.ie);
     constexpr int np_squared = NP * NP;
     Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, np_squared), [&](const int loop_idx) {
       const int ngp = loop_idx / NP;
@@ -973,8 +991,8 @@ public:
     // Make sure the buffers have been created
     assert (vector_buf_ml.size()>0);
 
-    const auto& D = Homme::subview(m_d, kv.ie);
-    const auto& metinv = Homme::subview(m_metinv, kv.ie);
+    const auto& D = geo_subview(m_d,kv.ie);
+    const auto& metinv = geo_subview(m_metinv,kv.ie);
     const auto& metdet = Homme::subview(m_metdet, kv.ie);
     constexpr int np_squared = NP * NP;
     Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, np_squared), [&](const int loop_idx) {
@@ -1168,10 +1186,10 @@ public:
 
   ExecViewManaged<const Real * [NP][NP]>        m_spheremp;
   ExecViewManaged<const Real * [NP][NP]>        m_rspheremp;
-  ExecViewManaged<const Real * [2][2][NP][NP]>  m_metinv;
+  ExecViewManaged<const GeoReal * [2][2][NP][NP]> m_metinv;
   ExecViewManaged<const Real * [NP][NP]>        m_metdet;
-  ExecViewManaged<const Real * [2][2][NP][NP]>  m_d;
-  ExecViewManaged<const Real * [2][2][NP][NP]>  m_dinv;
+  ExecViewManaged<const GeoReal * [2][2][NP][NP]> m_d;
+  ExecViewManaged<const GeoReal * [2][2][NP][NP]> m_dinv;
 
   Real m_scale_factor_inv, m_laplacian_rigid_factor;
 };
@@ -0,0 +1,150 @@
+/********************************************************************************
+ * HOMMEXX 1.0: Copyright of Sandia Corporation
+ * This software is released under the BSD license
+ * See the file 'COPYRIGHT' in the HOMMEXX/src/share/cxx directory
+ *******************************************************************************/
+
+#include "TeamPolicyTuner.hpp"
+#include "Context.hpp"
+#include "mpi/Comm.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <sstream>
+
+namespace Homme {
+
+namespace {
+
+using ThreadsVectors = TeamPolicyTuner::ThreadsVectors;
+
+// The cache file, or an empty string if tuning is disabled
+const std::string& cache_file () {
+  static const std::string file = [] {
+    const char* f = std::getenv("HOMMEXX_TEAM_POLICY_TUNING");
+    return std::string(f==nullptr ? "" : f);
+  }();
+  return file;
+}
+
+// The cached winners, loaded from the cache file on first use.
+TeamPolicyTuner::Cache& cache () {
+  static TeamPolicyTuner::Cache c = TeamPolicyTuner::read_cache(cache_file());
+  return c;
+}
+
+bool has_comm () {
+  return Context::singleton().has<Comm>();
+}
+
+} // anonymous namespace
+
+TeamPolicyTuner::Cache TeamPolicyTuner::read_cache (const std::string& file)
+{
+  Cache c;
+  std::ifstream in(file);
+  std::string line;
+  while (std::getline(in,line)) {
+    std::istringstream ss(line);
+    std::string name;
+    int nelemd, qsize, concurrency;
+    ThreadsVectors tv;
+    if (ss >> name >> nelemd >> qsize >> concurrency >> tv.first >> tv.second) {
+      std::ostringstream key;
+      key << name << " " << nelemd << " " << qsize << " " << concurrency;
+      c[key.str()] = tv;
+    }
+  }
+  return c;
+}
+
+void TeamPolicyTuner::write_cache (const std::string& file, const Cache& c)
+{
+  std::ofstream out(file);
+  for (const auto& it : c) {
+    out << it.first << " " << it.second.first << " " << it.second.second << "\n";
+  }
+}
+
+int TeamPolicyTuner::select_winner (const std::vector<double>& times)
+{
+  return std::min_element(times.begin(),times.end()) - times.begin();
+}
+
+void TeamPolicyTuner::setup (const std::string& name, const int nelemd, const int qsize,
+                             const int concurrency, const ThreadsVectors& default_tv,
+                             const std::vector<ThreadsVectors>& candidates)
+{
+  m_current = default_tv;
+  m_candidates.clear();
+  m_icand = m_itrial = 0;
+  if (cache_file()=="") {
+    return;
+  }
+
+  // Key on the largest nelemd over ranks, so all ranks agree on the key.
+  int max_nelemd = nelemd;
+  if (has_comm()) {
+    MPI_Allreduce(&nelemd,&max_nelemd,1,MPI_INT,MPI_MAX,
+                  Context::singleton().get<Comm>().mpi_comm());
+  }
+  std::ostringstream key;
+  key << name << " " << max_nelemd << " " << qsize << " " << concurrency;
+  m_key = key.str();
+
+  const auto it = cache().find(m_key);
+  if (it!=cache().end()) {
+    m_current = it->second;
+    return;
+  }
+
+  m_candidates = candidates;
+  m_times.assign(m_candidates.size(),std::numeric_limits<double>::max());
+  m_current = m_candidates[0];
+}
+
+void TeamPolicyTuner::start ()
+{
+  Kokkos::fence();
+  m_timer.reset();
+}
+
+bool TeamPolicyTuner::stop ()
+{
+  Kokkos::fence();
+  m_times[m_icand] = std::min(m_times[m_icand],m_timer.seconds());
+  if (++m_itrial<num_trials) {
+    return false;
+  }
+
+  m_itrial = 0;
+  ++m_icand;
+  if (tuning()) {
+    m_current = m_candidates[m_icand];
+    return true;
+  }
+
+  // All candidates timed. The slowest rank sets the pace, so use max times.
+  const int n = m_times.size();
+  if (has_comm()) {
+    const auto& comm = Context::singleton().get<Comm>();
+    MPI_Allreduce(MPI_IN_PLACE,m_times.data(),n,MPI_DOUBLE,MPI_MAX,comm.mpi_comm());
+  }
+  const int best = select_winner(m_times);
+  m_current = m_candidates[best];
+  cache()[m_key] = m_current;
+
+  const bool root = !has_comm() || Context::singleton().get<Comm>().root();
+  if (root) {
+    std::cout << "TeamPolicyTuner: " << m_key << " -> threads=" << m_current.first
+              << ", vectors=" << m_current.second << " ("
+              << m_times[best] << "s vs " << m_times[0] << "s for the default)\n";
+    write_cache(cache_file(),cache());
+  }
+  return true;
+}
+
+} // namespace Homme
@@ -0,0 +1,165 @@
+/********************************************************************************
+ * HOMMEXX 1.0: Copyright of Sandia Corporation
+ * This software is released under the BSD license
+ * See the file 'COPYRIGHT' in the HOMMEXX/src/share/cxx directory
+ *******************************************************************************/
+
+#ifndef HOMMEXX_TEAM_POLICY_TUNER_HPP
+#define HOMMEXX_TEAM_POLICY_TUNER_HPP
+
+#include "ExecSpaceDefs.hpp"
+#include "kokkos_utils.hpp"
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Homme {
+
+// Runtime selection of (#threads, #vectors) for the team policies of a functor.
+//   DefaultThreadsDistribution is a static heuristic, the same for all kernels.
+// If the env var HOMMEXX_TEAM_POLICY_TUNING is set to a file name, a functor
+// owning a TeamPolicyTuner times a few candidate configurations on its first
+// calls, on the real data, and then keeps the fastest one. Winners are stored
+// in that file, keyed by (functor, nelemd, qsize, concurrency), and reused
+// right away by later runs with the same key. If the env var is not set, the
+// tuner always returns the default configuration.
+//   Timings are maxed over ranks, so that all ranks pick the same config. Only
+// candidates needing at most as many workspace slots as the default policy are
+// tried, so buffers sized for the default policy remain valid throughout.
+//   Candidates are timed on the real model steps, so they must all give the same
+// answer. In the tuned functors, threads only split independent work (GLL
+// points, elements), while reductions and scans run over vector lanes. Hence
+// the number of threads never changes the result, and the number of vectors is
+// only varied where vector reductions are sequential (on CPU) or serialized
+// (HOMMEXX_BFB_TESTING). Results are thus BFB across candidates, and runs with
+// and without tuning are BFB with each other.
+//   Usage, in a functor whose kernels share TeamUtils m_tu:
+//     init:  m_tuner.init<ExecSpace>("name", nelemd, qsize, num_parallel_iterations, tp);
+//     run:   if (m_tuner.tuning()) m_tuner.start();
+//            launch kernels, with policies from m_tuner.make_policy<ExecSpace,Tag>(n)
+//            if (m_tuner.tuning() && m_tuner.stop()) { rebuild policies and m_tu }
+class TeamPolicyTuner {
+public:
+  using ThreadsVectors = std::pair<int,int>;
+
+  // Number of timed calls per candidate. The fastest is kept.
+  static constexpr int num_trials = 2;
+
+  template <typename ExecSpaceType>
+  void init (const std::string& name, const int nelemd, const int qsize,
+             const int num_parallel_iterations,
+             const ThreadPreferences tp = ThreadPreferences());
+
+  // The configurations to time. The first one is the default configuration.
+  template <typename ExecSpaceType>
+  static std::vector<ThreadsVectors>
+  candidates (const int num_parallel_iterations,
+              const ThreadPreferences tp = ThreadPreferences());
+
+  // Number of TeamUtils workspace slots needed by a configuration
+  template <typename ExecSpaceType>
+  static int num_ws_slots (const int num_parallel_iterations, const ThreadsVectors& tv) {
+    const Kokkos::TeamPolicy<ExecSpaceType> policy(num_parallel_iterations, tv.first, tv.second);
+    return TeamUtils<ExecSpaceType>(policy).get_num_ws_slots();
+  }
+
+  // The cache file format: one line per winner, with
+  //   functor nelemd qsize concurrency threads vectors
+  // where the first four entries form the key. Malformed lines are skipped.
+  using Cache = std::map<std::string,ThreadsVectors>;
+  static Cache read_cache (const std::string& file);
+  static void write_cache (const std::string& file, const Cache& cache);
+
+  // Index of the fastest candidate. Ties go to the earliest one, i.e., to the
+  // default configuration if it is among them.
+  static int select_winner (const std::vector<double>& times);
+
+  // Whether candidates are still being timed
+  bool tuning () const { return m_icand < static_cast<int>(m_candidates.size()); }
+
+  // The configuration to use for the next launch
+  const ThreadsVectors& current () const { return m_current; }
+
+  // Bracket the timed kernels. stop() returns true if current() changed.
+  void start ();
+  bool stop ();
+
+  // A team policy with the current configuration
+  template <typename ExecSpaceType, typename... Tags>
+  Kokkos::TeamPolicy<ExecSpaceType, Tags...>
+  make_policy (const int league_size) const {
+    auto policy = Kokkos::TeamPolicy<ExecSpaceType, Tags...>(league_size,
+                                                             m_current.first,
+                                                             m_current.second);
+    policy.set_chunk_size(1);
+    return policy;
+  }
+
+private:
+
+  // Non-templated part of init: look up the cache and, on a miss, set up
+  // timing of the candidates.
+  void setup (const std::string& name, const int nelemd, const int qsize,
+              const int concurrency, const ThreadsVectors& default_tv,
+              const std::vector<ThreadsVectors>& candidates);
+
+  std::string                 m_key;
+  std::vector<ThreadsVectors> m_candidates;
+  std::vector<double>         m_times;
+  ThreadsVectors              m_current;
+  int                         m_icand = 0;
+  int                         m_itrial = 0;
+  Kokkos::Timer               m_timer;
+};
+
+template <typename ExecSpaceType>
+void TeamPolicyTuner::init (const std::string& name, const int nelemd, const int qsize,
+                            const int num_parallel_iterations, const ThreadPreferences tp)
+{
+  const auto cands = candidates<ExecSpaceType>(num_parallel_iterations, tp);
+  setup(name, nelemd, qsize, ExecSpaceType::concurrency(), cands[0], cands);
+}
+
+template <typename ExecSpaceType>
+std::vector<TeamPolicyTuner::ThreadsVectors>
+TeamPolicyTuner::candidates (const int num_parallel_iterations, const ThreadPreferences tp)
+{
+  const auto default_tv =
+    DefaultThreadsDistribution<ExecSpaceType>::team_num_threads_vectors(
+      num_parallel_iterations, tp);
+  const int max_slots = num_ws_slots<ExecSpaceType>(num_parallel_iterations, default_tv);
+
+  // Candidates: halve/double the team and vector sizes around the default.
+  // On CPU, vectors are not a hardware resource, so only the team size varies.
+  // On GPU, the default team is already as large as the kernels' register
+  // usage allows, so candidates only redistribute or shrink it. Vector
+  // reductions are only BFB across vector lengths if serialized.
+#ifdef HOMMEXX_BFB_TESTING
+  constexpr bool vary_vectors = OnGpu<ExecSpaceType>::value;
+#else
+  constexpr bool vary_vectors = false;
+#endif
+  const int max_vectors = vary_vectors ?
+                          Kokkos::TeamPolicy<ExecSpaceType>::vector_length_max() : default_tv.second;
+  const int max_team = OnGpu<ExecSpaceType>::value ?
+                       default_tv.first*default_tv.second : ExecSpaceType::concurrency();
+  std::vector<ThreadsVectors> cands(1,default_tv);
+  for (int v : {default_tv.second/2, default_tv.second, 2*default_tv.second}) {
+    if (v<1 || v>max_vectors || v>tp.max_vectors_usable) continue;
+    if (!vary_vectors && v!=default_tv.second) continue;
+    for (int t : {default_tv.first/2, default_tv.first, 2*default_tv.first, 4*default_tv.first}) {
+      if (t<1 || t>tp.max_threads_usable || t*v>max_team) continue;
+      const ThreadsVectors tv(t,v);
+      if (tv==default_tv ||
+          num_ws_slots<ExecSpaceType>(num_parallel_iterations, tv)>max_slots) continue;
+      cands.push_back(tv);
+    }
+  }
+  return cands;
+}
+
+} // namespace Homme
+
+#endif // HOMMEXX_TEAM_POLICY_TUNER_HPP
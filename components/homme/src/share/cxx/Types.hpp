@@ -30,6 +30,14 @@ using F90Ptr = Real *const; // Using this in a function signature emphasizes
 using CF90Ptr = const Real *const; // Using this in a function signature
                                    // emphasizes that the ordering is Fortran
 
+// Storage type for the element metric terms (D, Dinv, metinv). Values are
+// promoted to Real when read, so only the storage precision changes.
+#ifdef HOMMEXX_GEOMETRY_SINGLE_PRECISION
+using GeoReal = float;
+#else
+using GeoReal = Real;
+#endif
+
 using VectorTagType = KokkosKernels::Batched::Experimental::SIMD<Real, ExecSpace>;
 
 using VectorType = KokkosKernels::Batched::Experimental::VectorTag<VectorTagType, VECTOR_SIZE>;
@@ -51,6 +51,7 @@ BoundaryExchange::BoundaryExchange()
   m_cleaned_up = true;
   m_send_pending = false;
   m_recv_pending = false;
+  m_shm_exchange = false;
 }
 
 BoundaryExchange::BoundaryExchange(std::shared_ptr<Connectivity> connectivity, std::shared_ptr<MpiBuffersManager> buffers_manager)
@@ -252,6 +253,61 @@ void BoundaryExchange::registration_completed()
   build_buffer_views_and_requests();
 }
 
+void BoundaryExchange::register_fields (const BoundaryExchange& src)
+{
+  // Sanity checks
+  assert (m_registration_started && !m_registration_completed);
+  assert (&src!=this);
+  assert (src.m_num_1d_fields==0 && m_num_1d_fields==0);
+  assert (src.m_connectivity==m_connectivity);
+  assert (m_num_2d_fields+src.m_num_2d_fields<=m_2d_fields.extent_int(1));
+  assert (m_num_3d_fields+src.m_num_3d_fields<=m_3d_fields.extent_int(1));
+  assert (m_num_3d_int_fields+src.m_num_3d_int_fields<=m_3d_int_fields.extent_int(1));
+
+  const int num_2d     = src.m_num_2d_fields;
+  const int num_3d     = src.m_num_3d_fields;
+  const int num_3d_int = src.m_num_3d_int_fields;
+
+  if (num_2d>0) {
+    auto l_num_2d_fields = m_num_2d_fields;
+    auto l_2d_fields = m_2d_fields;
+    auto src_2d_fields = src.m_2d_fields;
+    Kokkos::parallel_for(MDRangePolicy<ExecSpace, 2>({0, 0}, {m_num_elems, num_2d}, {1, 1}),
+                         KOKKOS_LAMBDA(const int ie, const int ifield){
+      l_2d_fields(ie, l_num_2d_fields+ifield) = src_2d_fields(ie, ifield);
+    });
+  }
+  if (num_3d>0) {
+    auto l_num_3d_fields = m_num_3d_fields;
+    auto l_3d_fields = m_3d_fields;
+    auto src_3d_fields = src.m_3d_fields;
+    Kokkos::parallel_for(MDRangePolicy<ExecSpace, 2>({0, 0}, {m_num_elems, num_3d}, {1, 1}),
+                         KOKKOS_LAMBDA(const int ie, const int ifield){
+      l_3d_fields(ie, l_num_3d_fields+ifield) = src_3d_fields(ie, ifield);
+    });
+  }
+  if (num_3d_int>0) {
+    auto l_num_3d_int_fields = m_num_3d_int_fields;
+    auto l_3d_int_fields = m_3d_int_fields;
+    auto src_3d_int_fields = src.m_3d_int_fields;
+    Kokkos::parallel_for(MDRangePolicy<ExecSpace, 2>({0, 0}, {m_num_elems, num_3d_int}, {1, 1}),
+                         KOKKOS_LAMBDA(const int ie, const int ifield){
+      l_3d_int_fields(ie, l_num_3d_int_fields+ifield) = src_3d_int_fields(ie, ifield);
+    });
+  }
+
+  // Once src's registration is completed, its nlev bookkeeping is dropped if all
+  // fields are exchanged on NUM_LEV levels.
+  const bool src_has_nlev = src.m_3d_nlev_pack.size()==static_cast<size_t>(num_3d);
+  for (int i = 0; i < num_3d; ++i) {
+    m_3d_nlev_pack.push_back(src_has_nlev ? src.m_3d_nlev_pack[i] : NUM_LEV);
+  }
+
+  m_num_2d_fields     += num_2d;
+  m_num_3d_fields     += num_3d;
+  m_num_3d_int_fields += num_3d_int;
+}
+
 void BoundaryExchange::exchange () {
   exchange(nullptr);
 }
@@ -453,6 +509,11 @@ void BoundaryExchange::pack_and_send ()
     tstop("be build_buffer_views_and_requests");
   }
 
+  // On-node peers must be done reading our previous writes before we pack into their windows
+  if (!m_shm_peers.empty()) {
+    m_buffers_manager->sync_shm_buffer(m_shm_peers);
+  }
+
   // ---- Pack ---- //
   const auto& ucon = m_connectivity->get_d_ucon();
   const auto& ucon_ptr = m_connectivity->get_d_ucon_ptr();
@@ -653,7 +714,7 @@ void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP
 
   // I am not sure why and if we could have this scenario, but just in case. I
   // think MPI *may* go bananas in this case
-  if (m_num_2d_fields+m_num_3d_fields==0) {
+  if (m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields==0) {
     return;
   }
 
@@ -682,6 +743,10 @@ void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP
 
   tstart("be recv_and_unpack book");
   m_buffers_manager->sync_recv_buffer(this);
+  // Wait for the on-node peers to be done packing into our window
+  if (!m_shm_peers.empty()) {
+    m_buffers_manager->sync_shm_buffer(m_shm_peers);
+  }
 
   tstop("be recv_and_unpack book");
 
@@ -821,6 +886,11 @@ void BoundaryExchange::pack_and_send_min_max ()
     tstop("be build_buffer_views_and_requests");
   }
 
+  // On-node peers must be done reading our previous writes before we pack into their windows
+  if (!m_shm_peers.empty()) {
+    m_buffers_manager->sync_shm_buffer(m_shm_peers);
+  }
+
   pack_min_max(m_connectivity->get_d_ucon(), m_connectivity->get_d_ucon_ptr(),
                m_1d_fields, m_send_1d_buffers, m_num_elems, m_num_1d_fields);
   Kokkos::fence();
@@ -934,6 +1004,10 @@ void BoundaryExchange::recv_and_unpack_min_max ()
                             m_connectivity->get_comm().mpi_comm()); // Wait for all data to arrive
 
   m_buffers_manager->sync_recv_buffer(this); // Deep copy mpi_recv_buffer into recv_buffer (no op if MPI is on device)
+  // Wait for the on-node peers to be done packing into our window
+  if (!m_shm_peers.empty()) {
+    m_buffers_manager->sync_shm_buffer(m_shm_peers);
+  }
 
   unpack_min_max(m_connectivity->get_d_ucon(), m_connectivity->get_d_ucon_ptr(),
                  m_1d_fields, m_recv_1d_buffers, m_num_elems, m_num_1d_fields);
@@ -969,6 +1043,13 @@ void BoundaryExchange::build_buffer_views_and_requests()
   m_buffers_manager->check_for_reallocation();
   m_buffers_manager->allocate_buffers();
 
+  // All processes on the node (re)build their views at the same time, since they
+  // register the same fields, so this collective call is safe.
+  m_shm_exchange = m_connectivity->is_node_comm_set();
+  if (m_shm_exchange) {
+    m_buffers_manager->allocate_shm_buffer();
+  }
+
   assert (m_3d_nlev_pack.empty() ||
           static_cast<int>(m_3d_nlev_pack.size()) == m_num_3d_fields);
 
@@ -1016,6 +1097,46 @@ void BoundaryExchange::build_buffer_views_and_requests()
 
   const auto& ucon = m_connectivity->get_h_ucon();
   const size_t nconn = ucon.size();
+  const size_t npids = pids.size();
+
+  // The size of the message to/from each remote pid, and its offset in the mpi buffers
+  std::vector<int> pid_counts(npids,0), pid_buf_offsets(npids+1,0);
+  for (size_t ip = 0; ip < npids; ++ip) {
+    for (int k = pid_offsets[ip]; k < pid_offsets[ip+1]; ++k) {
+      const auto& info = ucon(slot_idx_to_elem_conn_pair[k]);
+      pid_counts[ip] += m_elem_buf_size[info.kind];
+    }
+    pid_buf_offsets[ip+1] = pid_buf_offsets[ip] + pid_counts[ip];
+  }
+
+  // For on-node pids, we pack straight into their shared recv buffer, so we need
+  // to know where they expect our data. Each process tells its on-node partners
+  // the offset of their block in its own buffer.
+  // If none of our connections is on-node, there is nobody to synchronize with.
+  std::vector<int> node_ranks(npids,-1), peer_buf_offsets(npids,0);
+  m_shm_peers.clear();
+  if (m_shm_exchange && m_connectivity->get_num_on_node_connections()>0) {
+    const auto mpi_comm = m_connectivity->get_comm().mpi_comm();
+    std::vector<MPI_Request> reqs;
+    for (size_t ip = 0; ip < npids; ++ip) {
+      node_ranks[ip] = m_connectivity->get_node_rank(pids[ip]);
+      if (node_ranks[ip]<0) {
+        continue;
+      }
+      m_shm_peers.push_back(pids[ip]);
+      reqs.emplace_back();
+      HOMMEXX_MPI_CHECK_ERROR(MPI_Irecv(&peer_buf_offsets[ip], 1, MPI_INT, pids[ip],
+                                        MPI_EXCHANGE_SHM_SETUP, mpi_comm, &reqs.back()),
+                              mpi_comm);
+      reqs.emplace_back();
+      HOMMEXX_MPI_CHECK_ERROR(MPI_Isend(&pid_buf_offsets[ip], 1, MPI_INT, pids[ip],
+                                        MPI_EXCHANGE_SHM_SETUP, mpi_comm, &reqs.back()),
+                              mpi_comm);
+    }
+    if (!reqs.empty())
+      HOMMEXX_MPI_CHECK_ERROR(MPI_Waitall(reqs.size(), reqs.data(), MPI_STATUSES_IGNORE),
+                              mpi_comm);
+  }
   
   m_send_1d_buffers = decltype(m_send_1d_buffers)("1d send buffer", m_num_1d_fields, nconn);
   m_recv_1d_buffers = decltype(m_recv_1d_buffers)("1d recv buffer", m_num_1d_fields, nconn);
@@ -1035,44 +1156,57 @@ void BoundaryExchange::build_buffer_views_and_requests()
   const auto h_recv_3d_int_buffers = Kokkos::create_mirror_view(m_recv_3d_int_buffers);
 
   ConnectionHelpers helpers;
+  size_t ip = 0;
   for (size_t k = 0; k < nconn; ++k) {
     // Map from MPI buffer index space to (elem, connection) index space.
     const auto i = slot_idx_to_elem_conn_pair[k];
     const auto& info = ucon(i);
 
-    auto& send_buffer = h_all_send_buffers[info.sharing];
-    auto& recv_buffer = h_all_recv_buffers[info.sharing];
+    // Shared connections are sorted by pid, so keep track of which pid block we are in
+    while (ip < npids && static_cast<int>(k) >= pid_offsets[ip+1]) {
+      ++ip;
+    }
+
+    Real* send_buffer = h_all_send_buffers[info.sharing].get();
+    Real* recv_buffer = h_all_recv_buffers[info.sharing].get();
+    if (info.on_node && node_ranks[ip]>=0) {
+      // Receive in our window, at the same offset we would use in the mpi buffer;
+      // send directly into the peer's window, in the block the peer reserved for us.
+      recv_buffer = buffers_manager->get_shm_recv_buffer();
+      send_buffer = buffers_manager->get_shm_peer_recv_buffer(node_ranks[ip])
+                  + peer_buf_offsets[ip] - pid_buf_offsets[ip];
+    }
 
     for (int f = 0; f < m_num_1d_fields; ++f) {
       h_send_1d_buffers(f, i) = ExecViewUnmanaged<Scalar[2][NUM_LEV]>(
-        reinterpret_cast<Scalar*>(send_buffer.get() + h_buf_offset[info.sharing]));
+        reinterpret_cast<Scalar*>(send_buffer + h_buf_offset[info.sharing]));
       h_recv_1d_buffers(f, i) = ExecViewUnmanaged<Scalar[2][NUM_LEV]>(
-        reinterpret_cast<Scalar*>(recv_buffer.get() + h_buf_offset[info.sharing]));
+        reinterpret_cast<Scalar*>(recv_buffer + h_buf_offset[info.sharing]));
       h_buf_offset[info.sharing] += h_increment_1d[info.kind]*NUM_LEV*VECTOR_SIZE;
     }
     for (int f = 0; f < m_num_2d_fields; ++f) {
       h_send_2d_buffers(f, i) = ExecViewUnmanaged<Real*>(
-        send_buffer.get() + h_buf_offset[info.sharing], helpers.CONNECTION_SIZE[info.kind]);
+        send_buffer + h_buf_offset[info.sharing], helpers.CONNECTION_SIZE[info.kind]);
       h_recv_2d_buffers(f, i) = ExecViewUnmanaged<Real*>(
-        recv_buffer.get() + h_buf_offset[info.sharing], helpers.CONNECTION_SIZE[info.kind]);
+        recv_buffer + h_buf_offset[info.sharing], helpers.CONNECTION_SIZE[info.kind]);
       h_buf_offset[info.sharing] += h_increment_2d[info.kind];
     }
     for (int f = 0; f < m_num_3d_fields; ++f) {
       const auto nlev_3d = m_3d_nlev_pack.empty() ? NUM_LEV : m_3d_nlev_pack[f];
       h_send_3d_buffers(f, i) = ExecViewUnmanaged<Scalar**>(
-        reinterpret_cast<Scalar*>(send_buffer.get() + h_buf_offset[info.sharing]),
+        reinterpret_cast<Scalar*>(send_buffer + h_buf_offset[info.sharing]),
         helpers.CONNECTION_SIZE[info.kind], nlev_3d);
       h_recv_3d_buffers(f, i) = ExecViewUnmanaged<Scalar**>(
-        reinterpret_cast<Scalar*>(recv_buffer.get() + h_buf_offset[info.sharing]),
+        reinterpret_cast<Scalar*>(recv_buffer + h_buf_offset[info.sharing]),
         helpers.CONNECTION_SIZE[info.kind], nlev_3d);
       h_buf_offset[info.sharing] += h_increment_3d[info.kind]*nlev_3d*VECTOR_SIZE;
     }
     for (int f = 0; f < m_num_3d_int_fields; ++f) {
       h_send_3d_int_buffers(f, i) = ExecViewUnmanaged<Scalar**>(
-        reinterpret_cast<Scalar*>(send_buffer.get() + h_buf_offset[info.sharing]),
+        reinterpret_cast<Scalar*>(send_buffer + h_buf_offset[info.sharing]),
         helpers.CONNECTION_SIZE[info.kind], NUM_LEV_P);
       h_recv_3d_int_buffers(f, i) = ExecViewUnmanaged<Scalar**>(
-        reinterpret_cast<Scalar*>(recv_buffer.get() + h_buf_offset[info.sharing]),
+        reinterpret_cast<Scalar*>(recv_buffer + h_buf_offset[info.sharing]),
         helpers.CONNECTION_SIZE[info.kind], NUM_LEV_P);
       h_buf_offset[info.sharing] += h_increment_3d[info.kind]*NUM_LEV_P*VECTOR_SIZE;
     }
@@ -1107,30 +1241,27 @@ void BoundaryExchange::build_buffer_views_and_requests()
 #endif // NDEBUG
 
   {
+    // Only off-node pids need MPI messages
     const auto mpi_comm = m_connectivity->get_comm().mpi_comm();
-    const size_t npids = pids.size();
     free_requests();
-    m_send_requests.resize(npids);
-    m_recv_requests.resize(npids);
     MPIViewManaged<Real*>::pointer_type send_ptr = buffers_manager->get_mpi_send_buffer().data();
     MPIViewManaged<Real*>::pointer_type recv_ptr = buffers_manager->get_mpi_recv_buffer().data();
-    int offset = 0;
     for (size_t ip = 0; ip < npids; ++ip) {
-      int count = 0;
-      for (int k = pid_offsets[ip]; k < pid_offsets[ip+1]; ++k) {
-        const auto i = slot_idx_to_elem_conn_pair[k];
-        const auto& info = ucon(i);
-        count += m_elem_buf_size[info.kind];
+      if (node_ranks[ip]>=0) {
+        continue;
       }
+      const int offset = pid_buf_offsets[ip];
+      const int count  = pid_counts[ip];
+      m_send_requests.emplace_back();
+      m_recv_requests.emplace_back();
       HOMMEXX_MPI_CHECK_ERROR(MPI_Send_init(send_ptr + offset, count, MPI_DOUBLE,
                                             pids[ip], m_exchange_type, mpi_comm,
-                                            &m_send_requests[ip]),
+                                            &m_send_requests.back()),
                               m_connectivity->get_comm().mpi_comm());
       HOMMEXX_MPI_CHECK_ERROR(MPI_Recv_init(recv_ptr + offset, count, MPI_DOUBLE,
                                             pids[ip], m_exchange_type, mpi_comm,
-                                            &m_recv_requests[ip]),
+                                            &m_recv_requests.back()),
                               m_connectivity->get_comm().mpi_comm());
-      offset += count;
     }
   }
 
@@ -1229,6 +1360,7 @@ void BoundaryExchange::clear_buffer_views_and_requests ()
 
   // Destroy each request
   free_requests();
+  m_shm_peers.clear();
 
   // Clear buffer views
   m_send_1d_buffers = decltype(m_send_1d_buffers)("m_send_1d_buffers", 0, 0);
@@ -185,6 +185,12 @@ public:
   template<int DIM, typename... Properties>
   void register_min_max_fields (ExecView<Scalar*[DIM][2][NUM_LEV], Properties...> field_min_max, int num_dims, int start_dim);
 
+  // Register all the 2d/3d fields that were registered in another BE (which must not be
+  // a min/max exchange). The fields are appended after the ones already registered in
+  // this object, and count towards the numbers passed to set_num_fields. This is what
+  // allows ExchangeGroup to exchange the fields of several BE's with one message per neighbor.
+  void register_fields (const BoundaryExchange& src);
+
   // Size the buffers, and initialize the MPI types
   void registration_completed();
 
@@ -243,6 +249,10 @@ private:
   std::vector<MPI_Request>  m_send_requests;
   std::vector<MPI_Request>  m_recv_requests;
 
+  // The pids (in the connectivity comm) of the on-node processes we exchange
+  // data with through shared memory. Empty if there are none.
+  std::vector<int>          m_shm_peers;
+
   ExecViewManaged<ExecViewManaged<Scalar[2][NUM_LEV]>**>            m_1d_fields;
   ExecViewManaged<ExecViewManaged<Real[NP][NP]>**>                  m_2d_fields;
   ExecViewManaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV]>**>       m_3d_fields;
@@ -256,7 +266,10 @@ private:
   // send_buffer(..) points to the right area of one of the three buffers in the
   // buffers manager:
   // * local connection: point to local_buffer (on both send and recv views);
-  // * shared connection: point to the corresponding mpi buffer;
+  // * shared connection: point to the corresponding mpi buffer; if the remote
+  //   process is on this node and HOMMEXX_MPI_SHM_EXCHANGE is defined, point
+  //   instead to the shared memory recv buffer of the receiving process (so
+  //   the send view points into the remote process's window);
   // * missing connection: point to the send/recv blackhole.
 
   // Index as m_*_?d_buffers(ifield, iconn), where iconn ranges over all
@@ -293,6 +306,7 @@ private:
   bool        m_cleaned_up;
   bool        m_send_pending;
   bool        m_recv_pending;
+  bool        m_shm_exchange;     // Whether on-node values go through shared memory
 
   int         m_num_elems;
 
@@ -6,6 +6,7 @@
 
 #include "Connectivity.hpp"
 #include "ErrorDefs.hpp"
+#include "Hommexx_Debug.hpp"
 
 #include <array>
 #include <algorithm>
@@ -16,6 +17,8 @@ namespace Homme
 Connectivity::Connectivity ()
  : m_finalized    (false)
  , m_initialized  (false)
+ , m_node_comm    (MPI_COMM_NULL)
+ , m_num_on_node_connections (0)
  , m_num_local_elements (-1)
  , m_max_corner_elements(-1)
 {
@@ -28,6 +31,36 @@ void Connectivity::set_comm (const Comm& comm)
   assert (comm.mpi_comm()!=MPI_COMM_NULL);
 
   m_comm = comm;
+
+#ifdef HOMMEXX_MPI_SHM_EXCHANGE
+  // Group the processes that can share memory with us, and record, for each
+  // process in comm, its rank within our node (if any).
+  if (m_node_comm!=MPI_COMM_NULL) {
+    MPI_Comm_free(&m_node_comm);
+  }
+  HOMMEXX_MPI_CHECK_ERROR(MPI_Comm_split_type(m_comm.mpi_comm(), MPI_COMM_TYPE_SHARED, m_comm.rank(),
+                                              MPI_INFO_NULL, &m_node_comm),
+                          m_comm.mpi_comm());
+
+  MPI_Group group, node_group;
+  MPI_Comm_group(m_comm.mpi_comm(), &group);
+  MPI_Comm_group(m_node_comm, &node_group);
+
+  std::vector<int> pids(m_comm.size());
+  for (int pid=0; pid<m_comm.size(); ++pid) {
+    pids[pid] = pid;
+  }
+  m_node_ranks.resize(m_comm.size());
+  MPI_Group_translate_ranks(group, m_comm.size(), pids.data(), node_group, m_node_ranks.data());
+  for (auto& r : m_node_ranks) {
+    if (r==MPI_UNDEFINED) {
+      r = INVALID_ID;
+    }
+  }
+
+  MPI_Group_free(&node_group);
+  MPI_Group_free(&group);
+#endif
 }
 
 void Connectivity::set_num_elements (const int num_local_elements)
@@ -206,6 +239,9 @@ void Connectivity::setup_ucon () {
     info.kind = uci.kind;
     info.sharing = uci.sharing;
     info.direction = uci.direction;
+    info.on_node = (uci.sharing == etoi(ConnectionSharing::SHARED) &&
+                    get_node_rank(uci.r_pid) != INVALID_ID);
+    if (info.on_node) ++m_num_on_node_connections;
   }
   // m/d_ucon contain the much smaller HaloExchangeUnstructuredConnectionInfo
   // for use during halo exchanges.
@@ -317,6 +353,12 @@ void Connectivity::clean_up()
 {
   // Cleaning the elements counter
   Kokkos::deep_copy(h_num_connections,0);
+  m_num_on_node_connections = 0;
+
+  if (m_node_comm!=MPI_COMM_NULL) {
+    MPI_Comm_free(&m_node_comm);
+  }
+  m_node_ranks.clear();
 
   d_ucon = decltype(d_ucon)("", 0);
   h_ucon = decltype(h_ucon)("", 0);
@@ -11,6 +11,8 @@
 #include "Comm.hpp"
 #include "Types.hpp"
 
+#include <vector>
+
 namespace Homme
 {
 struct LidGidPos
@@ -42,6 +44,10 @@ struct ConnectionInfo
 
   // The following is needed only for W/E/S/N edges, in case the ordering of the NP points is different in the two elements
   std::uint8_t direction;  //0=forward, 1=backward
+
+  // Only meaningful if sharing==SHARED: whether remote_pid lives on the same node,
+  // and can therefore be reached through shared memory (see get_node_rank)
+  bool on_node;
 };
 
 // Just the data from the above that are needed on device during halo
@@ -122,6 +128,10 @@ public:
   KOKKOS_INLINE_FUNCTION
   int get_num_local_connections  () const { return get_num_connections<MemSpace>(ConnectionSharing::LOCAL, ConnectionKind::ANY); }
 
+  // Number of shared connections whose remote element is owned by a process on
+  // this node. This is 0 if the shared memory exchange is not enabled.
+  int get_num_on_node_connections () const { return m_num_on_node_connections; }
+
   int get_num_local_elements     () const { return m_num_local_elements;  }
   int get_max_corner_elements    () const { return m_max_corner_elements; }
 
@@ -129,6 +139,16 @@ public:
   bool is_finalized   () const { return m_finalized;   }
 
   const Comm& get_comm () const { return m_comm; }
+
+  // The communicator of the processes on this node, and the rank within it of
+  // the given process of get_comm(). If the shared memory exchange is not enabled
+  // (see HOMMEXX_MPI_SHM_EXCHANGE), the node comm is MPI_COMM_NULL, and
+  // get_node_rank always returns -1, as it does for processes on other nodes.
+  bool is_node_comm_set () const { return m_node_comm!=MPI_COMM_NULL; }
+  MPI_Comm get_node_comm () const { return m_node_comm; }
+  int get_node_rank (const int pid) const {
+    return m_node_ranks.empty() ? INVALID_ID : m_node_ranks[pid];
+  }
   //@}
 
 private:
@@ -139,6 +159,11 @@ private:
 
   Comm    m_comm;
 
+  // Processes on this node, and their rank in m_node_comm (INVALID_ID if off-node)
+  MPI_Comm          m_node_comm;
+  std::vector<int>  m_node_ranks;
+  int               m_num_on_node_connections;
+
   bool    m_finalized;
   bool    m_initialized;
 
@@ -0,0 +1,88 @@
+/********************************************************************************
+ * HOMMEXX 1.0: Copyright of Sandia Corporation
+ * This software is released under the BSD license
+ * See the file 'COPYRIGHT' in the HOMMEXX/src/share/cxx directory
+ *******************************************************************************/
+
+#include "ExchangeGroup.hpp"
+
+#include "MpiBuffersManager.hpp"
+
+#include <algorithm>
+
+namespace Homme
+{
+
+ExchangeGroup::ExchangeGroup(std::shared_ptr<Connectivity> connectivity, std::shared_ptr<MpiBuffersManager> buffers_manager)
+{
+  m_fused = std::make_shared<BoundaryExchange>(connectivity,buffers_manager);
+}
+
+void ExchangeGroup::add (const std::shared_ptr<BoundaryExchange>& be)
+{
+  // Members can only be added before the fused BE is set up
+  assert (!m_fused->is_registration_started() && !m_fused->is_registration_completed());
+
+  // Make sure it is a valid pointer, and that it is not already in the group
+  assert (be);
+  assert (std::find(m_members.begin(),m_members.end(),be)==m_members.end());
+
+  Errors::runtime_check(be->get_num_1d_fields()==0,
+                        "Error! ExchangeGroup cannot fuse min/max boundary exchanges.\n");
+
+  m_members.push_back(be);
+}
+
+void ExchangeGroup::registration_completed ()
+{
+  if (m_fused->is_registration_completed()) {
+    return;
+  }
+
+  int num_2d_fields = 0;
+  int num_3d_fields = 0;
+  int num_3d_int_fields = 0;
+  for (const auto& be : m_members) {
+    num_2d_fields     += be->get_num_2d_fields();
+    num_3d_fields     += be->get_num_3d_fields();
+    num_3d_int_fields += be->get_num_3d_int_fields();
+  }
+
+  m_fused->set_num_fields(0,num_2d_fields,num_3d_fields,num_3d_int_fields);
+  for (const auto& be : m_members) {
+    m_fused->register_fields(*be);
+  }
+  m_fused->registration_completed();
+}
+
+void ExchangeGroup::exchange ()
+{
+  assert (m_fused->is_registration_completed());
+  m_fused->exchange();
+}
+
+void ExchangeGroup::exchange (ExecViewUnmanaged<const Real * [NP][NP]> rspheremp)
+{
+  assert (m_fused->is_registration_completed());
+  m_fused->exchange(rspheremp);
+}
+
+void ExchangeGroup::pack_and_send ()
+{
+  assert (m_fused->is_registration_completed());
+  m_fused->pack_and_send();
+}
+
+void ExchangeGroup::recv_and_unpack ()
+{
+  assert (m_fused->is_registration_completed());
+  m_fused->recv_and_unpack();
+}
+
+void ExchangeGroup::clean_up ()
+{
+  m_fused->clean_up();
+  m_members.clear();
+}
+
+} // namespace Homme
@@ -0,0 +1,92 @@
+/********************************************************************************
+ * HOMMEXX 1.0: Copyright of Sandia Corporation
+ * This software is released under the BSD license
+ * See the file 'COPYRIGHT' in the HOMMEXX/src/share/cxx directory
+ *******************************************************************************/
+
+#ifndef HOMMEXX_EXCHANGE_GROUP_HPP
+#define HOMMEXX_EXCHANGE_GROUP_HPP
+
+#include "BoundaryExchange.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace Homme
+{
+
+/*
+ * ExchangeGroup: fuse the exchanges of several BoundaryExchange objects
+ *
+ * Each BoundaryExchange (BE) packs its fields into one message per neighbor, and
+ * goes through its own MPI_Startall/MPI_Waitall cycle. If two or more BE's are
+ * exchanged back to back (or, more generally, if their exchanges are independent),
+ * the message latency is paid once per BE. An ExchangeGroup collects the fields
+ * registered in several BE's into a single internal BE, so that all of them
+ * travel in one message per neighbor, with one set of persistent requests, one
+ * pack kernel and one unpack kernel.
+ *
+ * Usage:
+ *
+ *  - register fields in the member BE's as usual (calling registration_completed
+ *    on them is allowed, but not needed);
+ *  - add the member BE's to the group, via add(be);
+ *  - call registration_completed on the group;
+ *  - call exchange (or pack_and_send/recv_and_unpack) on the group, in place of
+ *    the corresponding calls on each member.
+ *
+ * Notes:
+ *  - the group stores views to the members' fields, not copies of them; hence,
+ *    changing the content of a field is seen by the group, but re-registering
+ *    fields in a member BE after the group registration is completed is not.
+ *  - min/max BE's (used for exchange_min_max) cannot be grouped.
+ *  - the group's internal BE is a customer of the given MpiBuffersManager, like
+ *    any other BE. In particular, since the buffers are shared, the group and
+ *    the other customers of the same buffers manager must not be exchanging at
+ *    the same time.
+ *  - the optional rspheremp passed to exchange is applied to all the fields in
+ *    the group, so only group BE's whose fields are either all scaled by it or
+ *    all not scaled by it.
+ */
+
+class ExchangeGroup
+{
+public:
+
+  ExchangeGroup(std::shared_ptr<Connectivity> connectivity, std::shared_ptr<MpiBuffersManager> buffers_manager);
+
+  // Thou shall not copy this class
+  ExchangeGroup(const ExchangeGroup&) = delete;
+  ExchangeGroup& operator= (const ExchangeGroup&) = delete;
+
+  // Add a BE to the group. Fields must already be registered in the BE.
+  void add (const std::shared_ptr<BoundaryExchange>& be);
+
+  // Fuse the fields of all members into the internal BE, and build buffers and requests
+  void registration_completed ();
+
+  bool is_registration_completed () const { return m_fused->is_registration_completed(); }
+
+  int get_num_members () const { return m_members.size(); }
+
+  // Exchange all the fields of all the members
+  void exchange ();
+  void exchange (ExecViewUnmanaged<const Real * [NP][NP]> rspheremp);
+
+  // Split version of exchange, to overlap communication with computation
+  void pack_and_send ();
+  void recv_and_unpack ();
+
+  // Release the fused fields and the members (but leaves connectivity and buffers manager)
+  void clean_up ();
+
+private:
+
+  std::vector<std::shared_ptr<BoundaryExchange>>  m_members;
+
+  std::shared_ptr<BoundaryExchange>               m_fused;
+};
+
+} // namespace Homme
+
+#endif // HOMMEXX_EXCHANGE_GROUP_HPP
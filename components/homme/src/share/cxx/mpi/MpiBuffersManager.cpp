@@ -8,6 +8,9 @@
 
 #include "BoundaryExchange.hpp"
 #include "Connectivity.hpp"
+#include "Hommexx_Debug.hpp"
+
+#include <algorithm>
 
 namespace Homme
 {
@@ -18,6 +21,8 @@ MpiBuffersManager::MpiBuffersManager ()
  , m_local_buffer_size (0)
  , m_buffers_busy      (false)
  , m_views_are_valid   (false)
+ , m_shm_win           (MPI_WIN_NULL)
+ , m_shm_buffer_size   (0)
 {
   // The "fake" buffers used for MISSING connections. These do not depend on the requirements
   // from the custormers, so we can create them right away.
@@ -41,6 +46,8 @@ MpiBuffersManager::~MpiBuffersManager ()
 
   // Check our buffers are not busy
   assert (!m_buffers_busy);
+
+  free_shm_buffer();
 }
 
 void MpiBuffersManager::check_for_reallocation ()
@@ -93,6 +100,103 @@ void MpiBuffersManager::allocate_buffers ()
   }
 }
 
+void MpiBuffersManager::allocate_shm_buffer ()
+{
+  assert (m_connectivity && m_connectivity->is_node_comm_set());
+
+  // If any process on the node needs a larger window, all of them must take part
+  // in the (collective) reallocation.
+  const MPI_Comm node_comm = m_connectivity->get_node_comm();
+  int needs_realloc = (m_shm_win==MPI_WIN_NULL || m_mpi_buffer_size>m_shm_buffer_size) ? 1 : 0;
+  HOMMEXX_MPI_CHECK_ERROR(MPI_Allreduce(MPI_IN_PLACE, &needs_realloc, 1, MPI_INT, MPI_MAX, node_comm),
+                          node_comm);
+  if (needs_realloc==0) {
+    return;
+  }
+
+  free_shm_buffer();
+
+  // Ask for at least one Real, since some implementations dislike zero-sized segments
+  m_shm_buffer_size = std::max(m_mpi_buffer_size,size_t(1));
+  Real* my_buffer;
+  HOMMEXX_MPI_CHECK_ERROR(MPI_Win_allocate_shared(m_shm_buffer_size*sizeof(Real), sizeof(Real),
+                                                  MPI_INFO_NULL, node_comm, &my_buffer, &m_shm_win),
+                          node_comm);
+
+  int node_size;
+  MPI_Comm_size(node_comm, &node_size);
+  m_shm_recv_buffers.resize(node_size);
+  for (int r=0; r<node_size; ++r) {
+    MPI_Aint size;
+    int disp_unit;
+    HOMMEXX_MPI_CHECK_ERROR(MPI_Win_shared_query(m_shm_win, r, &size, &disp_unit, &m_shm_recv_buffers[r]),
+                            node_comm);
+  }
+
+  // We only access the window with loads/stores, synchronized in sync_shm_buffer,
+  // so we can open a passive target epoch once and for all.
+  HOMMEXX_MPI_CHECK_ERROR(MPI_Win_lock_all(MPI_MODE_NOCHECK, m_shm_win), node_comm);
+
+  // Our customers' send views may point to the old windows of the other processes
+  for (auto& be_ptr : m_customers) {
+    be_ptr.first->clear_buffer_views_and_requests ();
+  }
+}
+
+void MpiBuffersManager::free_shm_buffer ()
+{
+  if (m_shm_win==MPI_WIN_NULL) {
+    return;
+  }
+
+  int finalized;
+  MPI_Finalized(&finalized);
+  if (finalized==0) {
+    MPI_Win_unlock_all(m_shm_win);
+    MPI_Win_free(&m_shm_win);
+  }
+  m_shm_win = MPI_WIN_NULL;
+  m_shm_buffer_size = 0;
+  m_shm_recv_buffers.clear();
+}
+
+void MpiBuffersManager::sync_shm_buffer (const std::vector<int>& peers)
+{
+  assert (m_shm_win!=MPI_WIN_NULL);
+
+  // The usual load/store synchronization for the unified memory model:
+  // flush our stores, wait for the peers we share data with, then refresh our view.
+  // A zero-byte handshake with each peer is enough, and, unlike a barrier on the
+  // node comm, it does not make us wait for processes we do not talk to.
+  const MPI_Comm mpi_comm = m_connectivity->get_comm().mpi_comm();
+  MPI_Win_sync(m_shm_win);
+  std::vector<MPI_Request> reqs(2*peers.size());
+  for (size_t i=0; i<peers.size(); ++i) {
+    HOMMEXX_MPI_CHECK_ERROR(MPI_Irecv(nullptr, 0, MPI_BYTE, peers[i], MPI_EXCHANGE_SHM_SYNC,
+                                      mpi_comm, &reqs[2*i]),
+                            mpi_comm);
+    HOMMEXX_MPI_CHECK_ERROR(MPI_Isend(nullptr, 0, MPI_BYTE, peers[i], MPI_EXCHANGE_SHM_SYNC,
+                                      mpi_comm, &reqs[2*i+1]),
+                            mpi_comm);
+  }
+  HOMMEXX_MPI_CHECK_ERROR(MPI_Waitall(reqs.size(), reqs.data(), MPI_STATUSES_IGNORE), mpi_comm);
+  MPI_Win_sync(m_shm_win);
+}
+
+Real* MpiBuffersManager::get_shm_recv_buffer () const
+{
+  assert (is_shm_buffer_allocated());
+  const int my_pid = m_connectivity->get_comm().rank();
+  return m_shm_recv_buffers[m_connectivity->get_node_rank(my_pid)];
+}
+
+Real* MpiBuffersManager::get_shm_peer_recv_buffer (const int node_rank) const
+{
+  assert (is_shm_buffer_allocated());
+  assert (node_rank>=0 && node_rank<static_cast<int>(m_shm_recv_buffers.size()));
+  return m_shm_recv_buffers[node_rank];
+}
+
 void MpiBuffersManager::lock_buffers ()
 {
   // Make sure we are not trying to lock buffers already locked
@@ -15,6 +15,8 @@
 
 #include "MpiHelpers.hpp"
 
+#include <mpi.h>
+
 namespace Homme
 {
 
@@ -64,6 +66,12 @@ class BoundaryExchange;
  *    it may or may not be true for GPU builds.
  *    The send/recv buffers are used to pack/unpack the data, while
  *    the mpi_send/mpi_recv buffers are used by MPI.
+ *  - a shared memory recv buffer (only if HOMMEXX_MPI_SHM_EXCHANGE
+ *    is defined): this buffer lives in an MPI-3 shared memory window,
+ *    allocated on the node comm of the connectivity. Processes on the
+ *    same node pack their outgoing values directly into each other's
+ *    shared recv buffer, so that only off-node values go through MPI
+ *    messages. See BoundaryExchange::build_buffer_views_and_requests.
  *
  * The BM class also takes care of syncing the send/recv buffers
  * with the mpi_send/mpi_recv buffers, via a call to Kokkos::deep_copy,
@@ -114,6 +122,13 @@ public:
   ExecViewUnmanaged<Real*> get_blackhole_send_buffer () const;
   ExecViewUnmanaged<Real*> get_blackhole_recv_buffer () const;
 
+  // The shared memory recv buffer of this process, and the one of the process
+  // with the given rank in the node comm. These are null if the shared memory
+  // window was not allocated.
+  bool is_shm_buffer_allocated () const { return m_shm_win!=MPI_WIN_NULL; }
+  Real* get_shm_recv_buffer () const;
+  Real* get_shm_peer_recv_buffer (const int node_rank) const;
+
   std::shared_ptr<Connectivity> get_connectivity () const { return m_connectivity; }
 
 private:
@@ -131,6 +146,16 @@ private:
   void sync_send_buffer (BoundaryExchange* customer);
   void sync_recv_buffer (BoundaryExchange* customer);
 
+  // (Re)allocate the shared memory window if any process on the node needs a
+  // larger one. Must be called collectively by all the processes on the node.
+  void allocate_shm_buffer ();
+  void free_shm_buffer ();
+
+  // Make our stores into the shared memory window visible to the given on-node
+  // peers (pids in the connectivity comm), and theirs visible to us. Each peer
+  // must make the matching call, with us in its list of peers.
+  void sync_shm_buffer (const std::vector<int>& peers);
+
   // Small struct, to hold customer's needs. We could use an std::pair, but this is more verbose
   struct CustomerNeeds {
     size_t local_buffer_size;
@@ -181,6 +206,12 @@ private:
   // The blackhole send/recv buffers (used for missing connections)
   ExecViewManaged<Real*>  m_blackhole_send_buffer;
   ExecViewManaged<Real*>  m_blackhole_recv_buffer;
+
+  // The shared memory window, its size (in Real's), and the base address of the
+  // recv buffer of each process on the node (our own included)
+  MPI_Win                 m_shm_win;
+  size_t                  m_shm_buffer_size;
+  std::vector<Real*>      m_shm_recv_buffers;
 };
 
 inline void MpiBuffersManager::sync_send_buffer (BoundaryExchange* customer)
@@ -16,7 +16,9 @@ namespace Homme
 
 enum ExchangeType : short int {
   MPI_EXCHANGE         = 1000,
-  MPI_EXCHANGE_MIN_MAX = 2000
+  MPI_EXCHANGE_MIN_MAX = 2000,
+  MPI_EXCHANGE_SHM_SETUP = 3000, // Used only to set up the shared memory exchange
+  MPI_EXCHANGE_SHM_SYNC  = 4000  // Used only to synchronize the shared memory exchange
 };
 
 // For min/max exchange, we store the two values in a single array, and often need to access it
@@ -9,7 +9,9 @@
 
 #include "Types.hpp"
 #include "ErrorDefs.hpp"
+#include <cassert>
 #include <functional>
+#include <type_traits>
 
 namespace Homme {
 
@@ -63,6 +65,25 @@ genRandArray(ViewType view, rngAlg &engine, PDF &&pdf) {
                [](typename ViewType::HostMirror) { return true; });
 }
 
+// Copy Real host data into a view storing metric terms as GeoReal (see Types.hpp).
+// The host values are rounded to GeoReal in place, so that host computations
+// (e.g., the f90 reference implementation) use the same metric terms as the device.
+template <typename GeoViewType, typename HostViewType>
+typename std::enable_if<Kokkos::is_view<GeoViewType>::value, void>::type
+deep_copy_geo(GeoViewType geo, HostViewType host) {
+  static_assert(std::is_same<typename GeoViewType::value_type,GeoReal>::value,
+                "Error! Target view must store GeoReal.\n");
+  static_assert(std::is_same<typename HostViewType::value_type,Real>::value,
+                "Error! Source view must store Real.\n");
+  assert(geo.size()==host.size());
+  auto geo_host = Kokkos::create_mirror_view(geo);
+  for (size_t i = 0; i < host.size(); ++i) {
+    geo_host.data()[i] = static_cast<GeoReal>(host.data()[i]);
+    host.data()[i] = geo_host.data()[i];
+  }
+  Kokkos::deep_copy(geo, geo_host);
+}
+
 template <typename FPType>
 Real compare_answers(FPType target, FPType computed,
                      FPType relative_coeff = 1.0) {
@@ -20,6 +20,7 @@
 #include "RKStageData.hpp"
 #include "SimulationParams.hpp"
 #include "SphereOperators.hpp"
+#include "TeamPolicyTuner.hpp"
 #include "kokkos_utils.hpp"
 
 #include "mpi/BoundaryExchange.hpp"
@@ -121,6 +122,9 @@ struct CaarFunctorImpl {
 
   TeamUtils<ExecSpace> m_tu;
 
+  // Picks (#threads,#vectors) for m_policy_pre (and m_tu)
+  TeamPolicyTuner m_tuner;
+
   Kokkos::Array<std::shared_ptr<BoundaryExchange>, NUM_TIME_LEVELS> m_bes;
 
   CaarFunctorImpl(const Elements &elements, const Tracers &/* tracers */,
@@ -141,6 +145,10 @@ struct CaarFunctorImpl {
       , m_policy_post (0,m_num_elems*NP*NP)
       , m_tu(m_policy_pre)
   {
+    // If a tuned configuration is cached, use it right away.
+    m_tuner.init<ExecSpace>("caar",m_num_elems,params.qsize,m_num_elems);
+    set_team_policy();
+
     // Initialize equation of state
     m_eos.init(params.theta_hydrostatic_mode,m_hvcoord);
 
@@ -157,7 +165,17 @@ struct CaarFunctorImpl {
       , m_policy_pre (Homme::get_default_team_policy<ExecSpace,TagPreExchange>(m_num_elems))
       , m_policy_post (0,num_elems*NP*NP)
       , m_tu(m_policy_pre)
-  {}
+  {
+    // If a tuned configuration is cached, use it right away.
+    m_tuner.init<ExecSpace>("caar",m_num_elems,params.qsize,m_num_elems);
+    set_team_policy();
+  }
+
+  // Rebuild m_policy_pre (and m_tu) with the tuner's current configuration
+  void set_team_policy () {
+    m_policy_pre = m_tuner.make_policy<ExecSpace,TagPreExchange>(m_num_elems);
+    m_tu = TeamUtils<ExecSpace>(m_policy_pre);
+  }
 
   void setup (const Elements &elements, const Tracers &/*tracers*/,
               const ReferenceElement &ref_FE, const HybridVCoord &hvcoord,
@@ -343,9 +361,16 @@ struct CaarFunctorImpl {
     profiling_resume();
 
     GPTLstart("caar compute");
+    const bool tuning = m_tuner.tuning();
+    if (tuning) {
+      m_tuner.start();
+    }
     int nerr;
     Kokkos::parallel_reduce("caar loop pre-boundary exchange", m_policy_pre, *this, nerr);
     Kokkos::fence();
+    if (tuning && m_tuner.stop()) {
+      set_team_policy();
+    }
     GPTLstop("caar compute");
     if (nerr > 0)
       check_print_abort_on_bad_elems("CaarFunctorImpl::run TagPreExchange", data.n0);
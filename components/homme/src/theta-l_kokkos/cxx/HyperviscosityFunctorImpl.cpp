@@ -66,6 +66,10 @@ void HyperviscosityFunctorImpl::init_params(const SimulationParams& params)
   // Sanity check
   assert(params.params_set);
 
+  // If a tuned configuration is cached, use it right away.
+  m_tuner.init<ExecSpace>("hyperviscosity",m_num_elems,params.qsize,m_num_elems);
+  set_team_policies();
+
   if (m_data.nu_top>0) {
 
     m_nu_scale_top = ExecViewManaged<Scalar[NUM_LEV]>("nu_scale_top");
@@ -124,6 +128,16 @@ void HyperviscosityFunctorImpl::init_params(const SimulationParams& params)
 #endif
 }
 
+void HyperviscosityFunctorImpl::set_team_policies ()
+{
+  m_policy_update_states = m_tuner.make_policy<ExecSpace,TagUpdateStates>(m_num_elems);
+  m_policy_first_laplace = m_tuner.make_policy<ExecSpace,TagFirstLaplaceHV>(m_num_elems);
+  m_policy_pre_exchange = m_tuner.make_policy<ExecSpace,TagHyperPreExchange>(m_num_elems);
+  m_policy_nutop_laplace = m_tuner.make_policy<ExecSpace,TagNutopLaplace>(m_num_elems);
+  m_policy_nutop_update_states = m_tuner.make_policy<ExecSpace,TagNutopUpdateStates>(m_num_elems);
+  m_tu = TeamUtils<ExecSpace>(m_policy_update_states);
+}
+
 void HyperviscosityFunctorImpl::setup(const ElementsGeometry&     geometry,
                                       const ElementsState&        state,
                                       const ElementsDerivedState& derived)
@@ -241,6 +255,10 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
   }
   m_data.eta_ave_w = eta_ave_w;
 
+  if (m_tuner.tuning()) {
+    m_tuner.start();
+  }
+
   // Convert vtheta_dp -> theta
   auto state = m_state;
   Kokkos::parallel_for(Homme::get_default_team_policy<ExecSpace>(state.num_elems()),
@@ -344,6 +362,10 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
       Kokkos::fence();
     }
   } // for sponge layer
+
+  if (m_tuner.tuning() && m_tuner.stop()) {
+    set_team_policies();
+  }
 } // run()
 
 void HyperviscosityFunctorImpl::biharmonic_wk_theta() const
@@ -363,10 +385,10 @@ void HyperviscosityFunctorImpl::biharmonic_wk_theta() const
   // Compute second laplacian, tensor or const hv
   const int ne = m_geometry.num_elems();
   if ( m_data.consthv ) {
-    auto policy = Homme::get_default_team_policy<ExecSpace,TagSecondLaplaceConstHV>(ne);
+    auto policy = m_tuner.make_policy<ExecSpace,TagSecondLaplaceConstHV>(ne);
     Kokkos::parallel_for(policy, *this);
   }else{
-    auto policy = Homme::get_default_team_policy<ExecSpace,TagSecondLaplaceTensorHV>(ne);
+    auto policy = m_tuner.make_policy<ExecSpace,TagSecondLaplaceTensorHV>(ne);
     Kokkos::parallel_for(policy, *this);
   }
   Kokkos::fence();
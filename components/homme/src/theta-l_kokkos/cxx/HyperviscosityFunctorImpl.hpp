@@ -17,6 +17,7 @@
 #include "KernelVariables.hpp"
 #include "SimulationParams.hpp"
 #include "SphereOperators.hpp"
+#include "TeamPolicyTuner.hpp"
 
 #include "utilities/VectorUtils.hpp"
 
@@ -107,6 +108,9 @@ public:
 
   void biharmonic_wk_theta () const;
 
+  // Rebuild the policies (and m_tu) with the tuner's current configuration
+  void set_team_policies ();
+
   // first iter of laplace, const hv
   KOKKOS_INLINE_FUNCTION
   void operator() (const TagFirstLaplaceHV&, const TeamMember& team) const {
@@ -409,6 +413,9 @@ protected:
 
   TeamUtils<ExecSpace> m_tu; // If the policies only differ by tag, just need one tu
 
+  // Picks (#threads,#vectors) for all the policies above (and m_tu)
+  TeamPolicyTuner m_tuner;
+
   std::shared_ptr<BoundaryExchange> m_be, m_be_tom;
 
   ExecViewManaged<Scalar[NUM_LEV]> m_nu_scale_top;
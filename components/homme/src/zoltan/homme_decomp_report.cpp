@@ -0,0 +1,52 @@
+
+#include "homme_graph_tools.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+// Offline report on the quality of an element decomposition.
+//
+//   homme_decomp_report homme_graph.bin parts.txt ranks_per_node [bytes_per_point]
+//
+// homme_graph.bin is written by zoltanpart_ on rank 0. parts.txt holds one
+// 1-based part id per element. The metrics are printed for the given
+// decomposition, and for the same decomposition after the node-aware
+// renumbering used by z2_map_method=4.
+int main (int argc, char** argv)
+{
+  if (argc<4) {
+    std::cerr << "Usage: " << argv[0]
+              << " graph_file decomposition_file ranks_per_node [bytes_per_point]\n";
+    return 1;
+  }
+
+  const int ranks_per_node = std::atoi(argv[3]);
+  const double bytes_per_point = argc>4 ? std::atof(argv[4]) : 8.0;
+  if (ranks_per_node<1 || bytes_per_point<=0) {
+    std::cerr << "Error! Invalid ranks_per_node or bytes_per_point.\n";
+    return 1;
+  }
+
+  try {
+    const auto graph = Homme::read_element_graph(argv[1]);
+    auto parts = Homme::read_decomposition(argv[2], graph.nelem);
+
+    const auto before = Homme::compute_decomposition_metrics(graph, parts, ranks_per_node, bytes_per_point);
+    std::cout << "Input decomposition:\n";
+    Homme::print_decomposition_metrics(before, std::cout);
+
+    const auto new_part = Homme::map_parts_to_hierarchy(graph, parts, before.nparts, ranks_per_node);
+    for (auto& p : parts) {
+      p = new_part[p-1];
+    }
+    const auto after = Homme::compute_decomposition_metrics(graph, parts, ranks_per_node, bytes_per_point);
+    std::cout << "After node-aware mapping:\n";
+    Homme::print_decomposition_metrics(after, std::cout);
+  } catch (std::exception& e) {
+    std::cerr << "Error! " << e.what() << "\n";
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,238 @@
+
+#ifdef HAVE_CONFIG_H
+#include "config.h.c"
+#endif
+
+#include "homme_graph_tools.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <queue>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace Homme {
+
+ElementGraph read_element_graph (const std::string& filename)
+{
+  // Format: nelem, nnz, xadj[nelem+1], adjncy[nnz], adjwgt[nnz] (doubles)
+  ElementGraph g;
+  FILE* f = fopen(filename.c_str(), "rb");
+  if (f==nullptr) {
+    throw std::runtime_error("Could not open graph file '" + filename + "'.");
+  }
+  int nnz;
+  bool ok = fread(&g.nelem, sizeof(int), 1, f)==1 &&
+            fread(&nnz, sizeof(int), 1, f)==1;
+  if (ok) {
+    g.xadj.resize(g.nelem+1);
+    g.adjncy.resize(nnz);
+    g.adjwgt.resize(nnz);
+    ok = fread(g.xadj.data(), sizeof(int), g.nelem+1, f)==static_cast<size_t>(g.nelem+1) &&
+         fread(g.adjncy.data(), sizeof(int), nnz, f)==static_cast<size_t>(nnz) &&
+         fread(g.adjwgt.data(), sizeof(double), nnz, f)==static_cast<size_t>(nnz);
+  }
+  fclose(f);
+  if (!ok || g.xadj[g.nelem]!=nnz) {
+    throw std::runtime_error("Graph file '" + filename + "' is truncated or corrupted.");
+  }
+  return g;
+}
+
+std::vector<int> read_decomposition (const std::string& filename, const int nelem)
+{
+  std::ifstream f(filename);
+  if (!f.good()) {
+    throw std::runtime_error("Could not open decomposition file '" + filename + "'.");
+  }
+  std::vector<int> parts(nelem);
+  for (int i=0; i<nelem; ++i) {
+    if (!(f >> parts[i]) || parts[i]<1) {
+      throw std::runtime_error("Decomposition file '" + filename + "' must contain " +
+                               std::to_string(nelem) + " positive part ids.");
+    }
+  }
+  return parts;
+}
+
+DecompositionMetrics
+compute_decomposition_metrics (const ElementGraph& graph, const std::vector<int>& parts,
+                               const int ranks_per_node, const double bytes_per_point)
+{
+  DecompositionMetrics m;
+  m.nparts = *std::max_element(parts.begin(), parts.end());
+
+  std::vector<int> part_sizes(m.nparts,0);
+  for (int i=0; i<graph.nelem; ++i) {
+    ++part_sizes[parts[i]-1];
+  }
+  m.min_part_size = *std::min_element(part_sizes.begin(), part_sizes.end());
+  m.max_part_size = *std::max_element(part_sizes.begin(), part_sizes.end());
+
+  m.num_cut_edges = 0;
+  m.edge_cut = m.off_rank_bytes = m.off_node_bytes = m.total_bytes = 0;
+  for (int i=0; i<graph.nelem; ++i) {
+    const int pi = parts[i]-1;
+    for (int k=graph.xadj[i]; k<graph.xadj[i+1]; ++k) {
+      const int j = graph.adjncy[k];
+      const int pj = parts[j]-1;
+      const double w = graph.adjwgt[k];
+      const double bytes = w*bytes_per_point;
+      m.total_bytes += bytes;
+      if (pi==pj) {
+        continue;
+      }
+      // Each graph edge appears once from each end
+      if (i<j) {
+        ++m.num_cut_edges;
+        m.edge_cut += w;
+      }
+      m.off_rank_bytes += bytes;
+      if (pi/ranks_per_node != pj/ranks_per_node) {
+        m.off_node_bytes += bytes;
+      }
+    }
+  }
+  return m;
+}
+
+void print_decomposition_metrics (const DecompositionMetrics& m, std::ostream& out)
+{
+  out << "  parts:           " << m.nparts << "\n"
+      << "  part size:       min " << m.min_part_size << ", max " << m.max_part_size << "\n"
+      << "  cut edges:       " << m.num_cut_edges << "\n"
+      << "  edge cut:        " << m.edge_cut << "\n"
+      << "  bytes sent:      " << m.total_bytes << "\n"
+      << "  off-rank bytes:  " << m.off_rank_bytes << "\n"
+      << "  off-node bytes:  " << m.off_node_bytes << "\n";
+}
+
+// Greedily split the given parts into groups of at most group_size, growing each
+// group by the part most strongly connected to it. Returns the groups' parts,
+// concatenated, in the order they were added.
+static std::vector<int>
+group_parts (const std::vector<std::unordered_map<int,double>>& qgraph,
+             const std::vector<int>& subset, const int group_size)
+{
+  const int nparts = qgraph.size();
+  std::vector<char> in_subset(nparts,0), taken(nparts,0);
+  for (int p : subset) {
+    in_subset[p] = 1;
+  }
+  std::vector<double> gain(nparts,0);
+
+  // Deterministic ordering: heaviest first, then lowest id
+  using Entry = std::pair<double,int>;
+  auto cmp = [](const Entry& a, const Entry& b) {
+    return a.first<b.first || (a.first==b.first && a.second>b.second);
+  };
+
+  std::vector<int> order;
+  order.reserve(subset.size());
+  size_t next_seed = 0;
+  while (order.size()<subset.size()) {
+    // Seed a new group with the first part not taken yet
+    while (taken[subset[next_seed]]) {
+      ++next_seed;
+    }
+    std::priority_queue<Entry,std::vector<Entry>,decltype(cmp)> candidates(cmp);
+    std::vector<int> touched;
+    int p = subset[next_seed];
+    for (int n=0; n<group_size && p>=0; ++n) {
+      taken[p] = 1;
+      order.push_back(p);
+      for (const auto& it : qgraph[p]) {
+        const int q = it.first;
+        if (in_subset[q] && !taken[q]) {
+          if (gain[q]==0) {
+            touched.push_back(q);
+          }
+          gain[q] += it.second;
+          candidates.emplace(gain[q],q);
+        }
+      }
+      // Skip stale entries (taken, or superseded by a larger gain)
+      p = -1;
+      while (!candidates.empty()) {
+        const auto top = candidates.top();
+        candidates.pop();
+        if (!taken[top.second] && top.first==gain[top.second]) {
+          p = top.second;
+          break;
+        }
+      }
+    }
+    for (int q : touched) {
+      gain[q] = 0;
+    }
+  }
+  return order;
+}
+
+std::vector<int>
+map_parts_to_hierarchy (const ElementGraph& graph, const std::vector<int>& parts,
+                        const int nparts, const int ranks_per_node)
+{
+  // Build the (symmetric) quotient graph of the parts
+  std::vector<std::unordered_map<int,double>> qgraph(nparts);
+  for (int i=0; i<graph.nelem; ++i) {
+    const int pi = parts[i]-1;
+    for (int k=graph.xadj[i]; k<graph.xadj[i+1]; ++k) {
+      const int pj = parts[graph.adjncy[k]]-1;
+      if (pi!=pj) {
+        qgraph[pi][pj] += graph.adjwgt[k];
+      }
+    }
+  }
+
+  std::vector<int> all(nparts);
+  for (int p=0; p<nparts; ++p) {
+    all[p] = p;
+  }
+  std::vector<int> order = group_parts(qgraph, all, std::max(ranks_per_node,1));
+
+  // The k-th part in the final order goes to rank k
+  std::vector<int> new_part(nparts);
+  for (int k=0; k<nparts; ++k) {
+    new_part[order[k]] = k+1;
+  }
+  return new_part;
+}
+
+} // namespace Homme
+
+void homme_node_aware_mapping (int *nelem, int *xadj, int *adjncy, double *adjwgt,
+                               int *nparts, MPI_Comm comm, int *result_parts)
+{
+  // All ranks must compute the same mapping, so use rank 0's node size
+  int rank, ranks_per_node;
+  MPI_Comm node_comm;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &node_comm);
+  MPI_Comm_size(node_comm, &ranks_per_node);
+  MPI_Comm_free(&node_comm);
+  MPI_Bcast(&ranks_per_node, 1, MPI_INT, 0, comm);
+
+  Homme::ElementGraph graph;
+  graph.nelem = *nelem;
+  graph.xadj.assign(xadj, xadj + *nelem + 1);
+  graph.adjncy.assign(adjncy, adjncy + xadj[*nelem]);
+  graph.adjwgt.assign(adjwgt, adjwgt + xadj[*nelem]);
+  const std::vector<int> parts(result_parts, result_parts + *nelem);
+
+  const auto new_part = Homme::map_parts_to_hierarchy(graph, parts, *nparts, ranks_per_node);
+  for (int i=0; i<*nelem; ++i) {
+    result_parts[i] = new_part[parts[i]-1];
+  }
+
+  if (rank==0) {
+    const std::vector<int> remapped(result_parts, result_parts + *nelem);
+    const auto before = Homme::compute_decomposition_metrics(graph, parts, ranks_per_node, 1.0);
+    const auto after  = Homme::compute_decomposition_metrics(graph, remapped, ranks_per_node, 1.0);
+    std::cout << "Node-aware mapping (" << ranks_per_node << " ranks per node): "
+              << "off-node shared points " << before.off_node_bytes
+              << " -> " << after.off_node_bytes << "\n";
+  }
+}
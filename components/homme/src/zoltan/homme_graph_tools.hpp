@@ -0,0 +1,76 @@
+#ifndef HOMME_GRAPH_TOOLS_HPP
+#define HOMME_GRAPH_TOOLS_HPP
+
+#include "mpi.h"
+
+#ifdef __cplusplus
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace Homme {
+
+// The element graph, in the same CSR format handed to zoltanpart_ by
+// zoltan_mod.F90: the neighbors of element i are adjncy[xadj[i]:xadj[i+1]],
+// with 0-based ids. adjwgt is the number of GLL points shared with each
+// neighbor (NP for edges, 1 for corners).
+struct ElementGraph {
+  int nelem = 0;
+  std::vector<int>    xadj;
+  std::vector<int>    adjncy;
+  std::vector<double> adjwgt;
+};
+
+// Read the graph written by zoltanpart_ in homme_graph.bin
+// (see WRITE_INPUT_FILE in zoltan_interface.c).
+ElementGraph read_element_graph (const std::string& filename);
+
+// Read a decomposition: one 1-based part id per element, whitespace separated.
+std::vector<int> read_decomposition (const std::string& filename, const int nelem);
+
+// Quality of a decomposition, assuming part p runs on rank p-1, and that ranks
+// are placed on nodes in contiguous blocks of ranks_per_node.
+// Weights are multiplied by bytes_per_point, the number of bytes one element
+// sends for each shared GLL point in one exchange (e.g., 8*nlev*nfields).
+struct DecompositionMetrics {
+  int    nparts;
+  int    min_part_size, max_part_size;
+  int    num_cut_edges;     // Graph edges whose ends are on different ranks
+  double edge_cut;          // Sum of the weights of those edges
+  double off_rank_bytes;    // Bytes sent to other ranks (both directions)
+  double off_node_bytes;    // Bytes sent to ranks on other nodes (both directions)
+  double total_bytes;       // Bytes sent to all neighbors (both directions)
+};
+
+DecompositionMetrics
+compute_decomposition_metrics (const ElementGraph& graph, const std::vector<int>& parts,
+                               const int ranks_per_node, const double bytes_per_point);
+
+void print_decomposition_metrics (const DecompositionMetrics& m, std::ostream& out);
+
+// Renumber the parts of a decomposition so that strongly connected parts land
+// on the same node. Parts are
+// greedily grown into groups of ranks_per_node, always adding the part with the
+// heaviest connection to the current group; each group then takes a contiguous
+// block of ranks. Returns the new (1-based) part of each old part.
+std::vector<int>
+map_parts_to_hierarchy (const ElementGraph& graph, const std::vector<int>& parts,
+                        const int nparts, const int ranks_per_node);
+
+} // namespace Homme
+
+extern "C" {
+#endif
+
+// Apply map_parts_to_hierarchy to result_parts in place, with the node size
+// deduced from comm via MPI_COMM_TYPE_SHARED. Meant to be called from
+// zoltanpart_, after the partitioning step.
+void homme_node_aware_mapping (int *nelem, int *xadj, int *adjncy, double *adjwgt,
+                               int *nparts, MPI_Comm comm, int *result_parts);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOMME_GRAPH_TOOLS_HPP
@@ -12,6 +12,7 @@
 #include "zoltan_cppinterface.hpp"
 #endif
 #endif
+#include "homme_graph_tools.hpp"
 #include "stdio.h"
 
 
@@ -85,6 +86,14 @@ void zoltanpart_(int *nelem, int *xadj,int *adjncy,double *adjwgt,double *vwgt,
   }
 #endif
 
+  //node aware mapping (4) is done in homme_node_aware_mapping, after
+  //zoltan2 partitioned without task mapping.
+  int z2_node_aware_mapping = (*mappingmethod == 4);
+  int no_task_mapping = 1;
+  if (z2_node_aware_mapping){
+    mappingmethod = &no_task_mapping;
+  }
+
   if (*partmethod > 5 && *partmethod <= 22){
     zoltan_partition_problem(
         nelem, xadj,adjncy,adjwgt,vwgt,
@@ -126,6 +135,9 @@ void zoltanpart_(int *nelem, int *xadj,int *adjncy,double *adjwgt,double *vwgt,
 #endif
 
   }
+  if (z2_node_aware_mapping){
+    homme_node_aware_mapping(nelem, xadj, adjncy, adjwgt, nparts, c_comm, result_parts);
+  }
 #else
   int mype2, size2;
   MPI_Comm_rank(c_comm, &mype2);
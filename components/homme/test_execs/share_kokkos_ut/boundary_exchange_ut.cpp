@@ -3,6 +3,7 @@
 #include "Context.hpp"
 #include "mpi/MpiBuffersManager.hpp"
 #include "mpi/BoundaryExchange.hpp"
+#include "mpi/ExchangeGroup.hpp"
 #include "mpi/Connectivity.hpp"
 #include "utilities/SubviewUtils.hpp"
 #include "utilities/SyncUtils.hpp"
@@ -50,7 +51,7 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
   std::uniform_int_distribution<int>   dint(0,1);
 
   constexpr int ne        = 2;
-  constexpr int num_tests = 1;
+  constexpr int num_tests = 2;
   constexpr int DIM       = 2;
   constexpr double test_tolerance = 1e-13;
   constexpr int num_min_max_fields_1d = 1; // Count min and max of a field as 1, does not count the x2 due to min and max
@@ -80,6 +81,15 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
   int num_elements = connectivity->get_num_local_elements();
   int rank = connectivity->get_comm().rank();
 
+#ifdef HOMMEXX_MPI_SHM_EXCHANGE
+  // All ranks of this test run on one node, so, if there are 2+ ranks, all the
+  // shared connections go through shared memory. Make sure that is the case.
+  REQUIRE (connectivity->get_comm().size()>1);
+  REQUIRE (connectivity->is_node_comm_set());
+  REQUIRE (connectivity->get_num_on_node_connections()>0);
+  REQUIRE (connectivity->get_num_on_node_connections()==connectivity->get_num_shared_connections<HostMemSpace>());
+#endif
+
   // Create input data arrays
   HostViewManaged<Real*[num_min_max_fields_1d][NUM_PHYSICAL_LEV]> field_min_1d_f90("", num_elements);
   HostViewManaged<Real*[num_min_max_fields_1d][NUM_PHYSICAL_LEV]> field_max_1d_f90("", num_elements);
@@ -131,6 +141,12 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
   be3->register_min_max_fields(field_1d_cxx,num_min_max_fields_1d,0);
   be3->registration_completed();
 
+  // Fuse be1 and be2, so that their fields travel in a single message per neighbor
+  ExchangeGroup group(connectivity,buffers_manager);
+  group.add(be1);
+  group.add(be2);
+  group.registration_completed();
+
   for (int itest=0; itest<num_tests; ++itest)
   {
     // Whether the neighbor min/max should be done as a whole or with two separate calls (start/pack_and_send and finish/recv_and_unpack)
@@ -204,16 +220,27 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
                                field_3d_int_f90.data(), field_4d_f90.data(),
                                DIM, NUM_TIME_LEVELS, field_2d_idim+1, field_3d_idim+1, field_4d_outer_idim+1, minmax_split);
     minmax_split = 1;
+    // Even tests exchange be1/be2 separately, odd tests through the group
+    const bool use_group = (itest%2==1);
     if (minmax_split==0) {
-      be1->exchange();
-      be2->exchange();
+      if (use_group) {
+        group.exchange();
+      } else {
+        be1->exchange();
+        be2->exchange();
+      }
       be3->exchange_min_max();
     } else {
       be3->pack_and_send_min_max();
-      be1->pack_and_send();
-      be1->recv_and_unpack();
-      be2->pack_and_send();
-      be2->recv_and_unpack();
+      if (use_group) {
+        group.pack_and_send();
+        group.recv_and_unpack();
+      } else {
+        be1->pack_and_send();
+        be1->recv_and_unpack();
+        be2->pack_and_send();
+        be2->recv_and_unpack();
+      }
       be3->recv_and_unpack_min_max();
     }
     Kokkos::deep_copy(field_1d_cxx_host,     field_1d_cxx);
@@ -303,6 +330,7 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
 
   // Cleanup
   cleanup_f90();  // Deallocate stuff in the F90 module
+  group.clean_up();
   be1->clean_up();
   be2->clean_up();
   be3->clean_up();
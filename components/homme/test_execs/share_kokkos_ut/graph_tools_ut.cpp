@@ -0,0 +1,102 @@
+#include <catch2/catch.hpp>
+
+#include "homme_graph_tools.hpp"
+
+#include <algorithm>
+
+using namespace Homme;
+
+namespace {
+
+// A chain of nelem elements, 0-1-2-...-(nelem-1), sharing an edge (NP=4
+// points) with each neighbor.
+ElementGraph chain_graph (const int nelem) {
+  ElementGraph g;
+  g.nelem = nelem;
+  g.xadj.push_back(0);
+  for (int i=0; i<nelem; ++i) {
+    for (int j : {i-1, i+1}) {
+      if (j>=0 && j<nelem) {
+        g.adjncy.push_back(j);
+        g.adjwgt.push_back(4);
+      }
+    }
+    g.xadj.push_back(g.adjncy.size());
+  }
+  return g;
+}
+
+} // anonymous namespace
+
+TEST_CASE("decomposition_metrics", "graph_tools") {
+  // Parts 1 and 2 go to node 0, parts 3 and 4 to node 1, but each part only
+  // talks to parts on the other node:
+  //   elem: 0 1 2 3 4 5 6 7
+  //   part: 1 1 3 3 2 2 4 4
+  const auto g = chain_graph(8);
+  const std::vector<int> parts = {1, 1, 3, 3, 2, 2, 4, 4};
+
+  const auto m = compute_decomposition_metrics(g, parts, 2, 8.0);
+  REQUIRE (m.nparts==4);
+  REQUIRE (m.min_part_size==2);
+  REQUIRE (m.max_part_size==2);
+  REQUIRE (m.num_cut_edges==3);
+  REQUIRE (m.edge_cut==12);
+  // 7 edges, 4 points each, counted from both ends
+  REQUIRE (m.total_bytes==7*4*2*8);
+  REQUIRE (m.off_rank_bytes==3*4*2*8);
+  REQUIRE (m.off_node_bytes==3*4*2*8);
+
+  // With one rank per node, off-node and off-rank traffic are the same thing
+  const auto m1 = compute_decomposition_metrics(g, parts, 1, 8.0);
+  REQUIRE (m1.off_node_bytes==m1.off_rank_bytes);
+
+  // With everything on one node, nothing goes off-node
+  const auto m4 = compute_decomposition_metrics(g, parts, 4, 8.0);
+  REQUIRE (m4.off_node_bytes==0);
+  REQUIRE (m4.off_rank_bytes==m.off_rank_bytes);
+}
+
+TEST_CASE("map_parts_to_hierarchy", "graph_tools") {
+  const auto g = chain_graph(8);
+  const std::vector<int> parts = {1, 1, 3, 3, 2, 2, 4, 4};
+  const int nparts = 4;
+
+  auto remap = [&](const std::vector<int>& new_part) {
+    std::vector<int> remapped(parts.size());
+    for (size_t i=0; i<parts.size(); ++i) {
+      remapped[i] = new_part[parts[i]-1];
+    }
+    return remapped;
+  };
+
+  SECTION ("node_aware") {
+    const auto new_part = map_parts_to_hierarchy(g, parts, nparts, 2);
+
+    // The result must be a permutation of the part ids
+    auto sorted = new_part;
+    std::sort(sorted.begin(), sorted.end());
+    REQUIRE (sorted==std::vector<int>({1, 2, 3, 4}));
+
+    // Neighboring parts are grouped on the same node: only the middle edge is off-node
+    const auto remapped = remap(new_part);
+    REQUIRE (remapped==std::vector<int>({1, 1, 2, 2, 3, 3, 4, 4}));
+
+    const auto before = compute_decomposition_metrics(g, parts, 2, 1.0);
+    const auto after  = compute_decomposition_metrics(g, remapped, 2, 1.0);
+    REQUIRE (after.off_node_bytes==1*4*2);
+    REQUIRE (after.off_node_bytes<before.off_node_bytes);
+
+    // Renumbering parts does not change the partition itself
+    REQUIRE (after.num_cut_edges==before.num_cut_edges);
+    REQUIRE (after.off_rank_bytes==before.off_rank_bytes);
+    REQUIRE (after.min_part_size==before.min_part_size);
+    REQUIRE (after.max_part_size==before.max_part_size);
+  }
+
+  SECTION ("one_rank_per_node") {
+    // Groups of one part: nothing to gain, the numbering is unchanged
+    const auto new_part = map_parts_to_hierarchy(g, parts, nparts, 1);
+    REQUIRE (new_part==std::vector<int>({1, 2, 3, 4}));
+  }
+}
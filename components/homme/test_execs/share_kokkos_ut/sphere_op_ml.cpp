@@ -160,29 +160,29 @@ class compute_sphere_operator_test_ml {
     Kokkos::deep_copy(vector_input_d, vector_input_host);
 
     // D
-    ExecViewManaged<Real * [2][2][NP][NP]> d_d("",num_elems);
-    d_host = Kokkos::create_mirror_view(d_d);
+    ExecViewManaged<GeoReal * [2][2][NP][NP]> d_d("",num_elems);
+    d_host = decltype(d_host)("",num_elems);
     genRandArray(d_host, engine,
                  std::uniform_real_distribution<Real>(
                      -100.0, 100.0));
-    Kokkos::deep_copy(d_d, d_host);
+    deep_copy_geo(d_d, d_host);
 
     // Dinv
-    ExecViewManaged<Real * [2][2][NP][NP]> dinv_d("",num_elems);
-    dinv_host = Kokkos::create_mirror_view(dinv_d);
+    ExecViewManaged<GeoReal * [2][2][NP][NP]> dinv_d("",num_elems);
+    dinv_host = decltype(dinv_host)("",num_elems);
     genRandArray(dinv_host,
                  engine,
                  std::uniform_real_distribution<Real>(
                      -100.0, 100.0));
-    Kokkos::deep_copy(dinv_d, dinv_host);
+    deep_copy_geo(dinv_d, dinv_host);
 
     // metinv
-    ExecViewManaged<Real * [2][2][NP][NP]> metinv_d("",num_elems);
-    metinv_host = Kokkos::create_mirror_view(metinv_d);
+    ExecViewManaged<GeoReal * [2][2][NP][NP]> metinv_d("",num_elems);
+    metinv_host = decltype(metinv_host)("",num_elems);
     genRandArray(metinv_host, engine,
                  std::uniform_real_distribution<Real>(
                      -100.0, 100.0));
-    Kokkos::deep_copy(metinv_d, metinv_host);
+    deep_copy_geo(metinv_d, metinv_host);
 
     // metdet
     ExecViewManaged<Real * [NP][NP]> metdet_d("",num_elems);
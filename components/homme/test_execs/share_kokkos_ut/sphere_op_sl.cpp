@@ -80,20 +80,20 @@ class compute_sphere_operator_test {
     Kokkos::deep_copy(vector_input_d, vector_input_host);
 
     // D
-    ExecViewManaged<Real * [2][2][NP][NP]> d_d("",num_elems);
-    d_host = Kokkos::create_mirror_view(d_d);
+    ExecViewManaged<GeoReal * [2][2][NP][NP]> d_d("",num_elems);
+    d_host = decltype(d_host)("",num_elems);
     genRandArray(d_host, engine,
                  std::uniform_real_distribution<Real>(
                      0, 1.0));
-    Kokkos::deep_copy(d_d, d_host);
+    deep_copy_geo(d_d, d_host);
 
     // Dinv
-    ExecViewManaged<Real * [2][2][NP][NP]> dinv_d("",num_elems);
-    dinv_host = Kokkos::create_mirror_view(dinv_d);
+    ExecViewManaged<GeoReal * [2][2][NP][NP]> dinv_d("",num_elems);
+    dinv_host = decltype(dinv_host)("",num_elems);
     genRandArray(dinv_host, engine,
                  std::uniform_real_distribution<Real>(
                      0, 1.0));
-    Kokkos::deep_copy(dinv_d, dinv_host);
+    deep_copy_geo(dinv_d, dinv_host);
 
     // metdet
     ExecViewManaged<Real * [NP][NP]> metdet_d("",num_elems);
@@ -121,7 +121,7 @@ class compute_sphere_operator_test {
 
     // Set device views in SphereOperators
     ExecViewManaged<Real       [NP][NP]> mp_d("");  // Unused by this test, but needed by sphere_ops
-    ExecViewManaged<Real*[2][2][NP][NP]> metinv_d("",num_elems);  // Unused by this test, but needed by sphere_ops
+    ExecViewManaged<GeoReal*[2][2][NP][NP]> metinv_d("",num_elems);  // Unused by this test, but needed by sphere_ops
     sphere_ops.set_views(dvv_d,d_d,dinv_d,metinv_d,metdet_d,spheremp_d,mp_d);
   }
 
@@ -0,0 +1,199 @@
+#include <catch2/catch.hpp>
+
+#include "TeamPolicyTuner.hpp"
+#include "Types.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+
+using namespace Homme;
+
+namespace {
+
+using ThreadsVectors = TeamPolicyTuner::ThreadsVectors;
+
+constexpr int num_elems = 10;
+
+// A kernel with the intra-team patterns of the tuned functors: independent
+// work split over threads, with reductions and scans over vector lanes.
+void run_kernel (const ThreadsVectors& tv,
+                 const ExecViewManaged<Real***>& in,
+                 const ExecViewManaged<Real**>& sums,
+                 const ExecViewManaged<Real***>& scans)
+{
+  const int nlev = in.extent_int(2);
+  Kokkos::TeamPolicy<ExecSpace> policy(num_elems, tv.first, tv.second);
+  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const TeamMember& team) {
+    const int ie = team.league_rank();
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, NP*NP), [&] (const int igp) {
+      Real sum;
+      Dispatch<>::parallel_reduce(team, Kokkos::ThreadVectorRange(team, nlev),
+                                  [&] (const int k, Real& s) { s += in(ie,igp,k); }, sum);
+      Kokkos::single(Kokkos::PerThread(team), [&] () { sums(ie,igp) = sum; });
+      Dispatch<>::parallel_scan(team, nlev, [&] (const int k, Real& acc, const bool last) {
+        acc += in(ie,igp,k);
+        if (last) scans(ie,igp,k) = acc;
+      });
+    });
+  });
+  Kokkos::fence();
+}
+
+} // anonymous namespace
+
+TEST_CASE("candidates", "team_policy_tuner") {
+  const ThreadPreferences tp;
+  const auto cands = TeamPolicyTuner::candidates<ExecSpace>(num_elems, tp);
+  const auto default_tv =
+    DefaultThreadsDistribution<ExecSpace>::team_num_threads_vectors(num_elems, tp);
+
+  REQUIRE (cands.size()>=1);
+  REQUIRE (cands[0]==default_tv);
+
+  const int max_slots = TeamPolicyTuner::num_ws_slots<ExecSpace>(num_elems, default_tv);
+  for (size_t i=0; i<cands.size(); ++i) {
+    const auto& tv = cands[i];
+    REQUIRE (tv.first>=1);
+    REQUIRE (tv.second>=1);
+    REQUIRE (tv.first<=tp.max_threads_usable);
+    REQUIRE (tv.second<=tp.max_vectors_usable);
+    // Buffers sized for the default policy must stay valid
+    REQUIRE (TeamPolicyTuner::num_ws_slots<ExecSpace>(num_elems, tv)<=max_slots);
+    if (OnGpu<ExecSpace>::value) {
+      REQUIRE (tv.first*tv.second<=default_tv.first*default_tv.second);
+    }
+    REQUIRE (std::count(cands.begin(), cands.end(), tv)==1);
+  }
+
+  // A tighter thread bound is honored too
+  ThreadPreferences tp1;
+  tp1.max_threads_usable = 1;
+  for (const auto& tv : TeamPolicyTuner::candidates<ExecSpace>(num_elems, tp1)) {
+    REQUIRE (tv.first==1);
+  }
+}
+
+TEST_CASE("bfb_across_candidates", "team_policy_tuner") {
+  const int nlev = NUM_PHYSICAL_LEV;
+  ExecViewManaged<Real***> in("in", num_elems, NP*NP, nlev);
+  ExecViewManaged<Real**>  sums("sums", num_elems, NP*NP), sums0("sums0", num_elems, NP*NP);
+  ExecViewManaged<Real***> scans("scans", num_elems, NP*NP, nlev), scans0("scans0", num_elems, NP*NP, nlev);
+
+  // Values of very different magnitudes, so that the summation order matters
+  std::mt19937_64 engine(1);
+  std::uniform_real_distribution<Real> mantissa(-1, 1);
+  std::uniform_int_distribution<int> exponent(-20, 20);
+  auto in_h = Kokkos::create_mirror_view(in);
+  for (int ie=0; ie<num_elems; ++ie) {
+    for (int igp=0; igp<NP*NP; ++igp) {
+      for (int k=0; k<nlev; ++k) {
+        in_h(ie,igp,k) = std::ldexp(mantissa(engine), exponent(engine));
+      }
+    }
+  }
+  Kokkos::deep_copy(in, in_h);
+
+  const auto cands = TeamPolicyTuner::candidates<ExecSpace>(num_elems);
+  run_kernel(cands[0], in, sums0, scans0);
+  const auto sums0_h  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), sums0);
+  const auto scans0_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), scans0);
+
+  for (const auto& tv : cands) {
+    Kokkos::deep_copy(sums, 0);
+    Kokkos::deep_copy(scans, 0);
+    run_kernel(tv, in, sums, scans);
+    const auto sums_h  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), sums);
+    const auto scans_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), scans);
+    for (int ie=0; ie<num_elems; ++ie) {
+      for (int igp=0; igp<NP*NP; ++igp) {
+        REQUIRE (sums_h(ie,igp)==sums0_h(ie,igp));
+        for (int k=0; k<nlev; ++k) {
+          REQUIRE (scans_h(ie,igp,k)==scans0_h(ie,igp,k));
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("cache_io", "team_policy_tuner") {
+  const std::string file = "team_policy_tuner_cache_io.txt";
+  {
+    std::ofstream out(file);
+    out << "caar 96 4 16 8 1\n"
+        << "\n"
+        << "this line is malformed\n"
+        << "hyperviscosity 96 4 16 4 2 trailing entries are ignored\n"
+        << "euler_step 96 4\n";
+  }
+  const auto c = TeamPolicyTuner::read_cache(file);
+  REQUIRE (c.size()==2);
+  REQUIRE (c.at("caar 96 4 16")==ThreadsVectors(8,1));
+  REQUIRE (c.at("hyperviscosity 96 4 16")==ThreadsVectors(4,2));
+
+  // Round trip
+  auto c2 = c;
+  c2["euler_step 24 10 64"] = ThreadsVectors(16,4);
+  TeamPolicyTuner::write_cache(file, c2);
+  REQUIRE (TeamPolicyTuner::read_cache(file)==c2);
+
+  // A missing file is an empty cache
+  REQUIRE (TeamPolicyTuner::read_cache("team_policy_tuner_missing.txt").empty());
+}
+
+TEST_CASE("select_winner", "team_policy_tuner") {
+  REQUIRE (TeamPolicyTuner::select_winner({3.0, 1.0, 2.0})==1);
+  REQUIRE (TeamPolicyTuner::select_winner({1.0})==0);
+  // Ties go to the default configuration
+  REQUIRE (TeamPolicyTuner::select_winner({1.0, 2.0, 1.0})==0);
+  REQUIRE (TeamPolicyTuner::select_winner({2.0, 1.0, 1.0})==1);
+}
+
+TEST_CASE("online_tuning", "team_policy_tuner") {
+  // The cache file is read from the environment on first use
+  const std::string file = "team_policy_tuner_cache.txt";
+  std::remove(file.c_str());
+  setenv("HOMMEXX_TEAM_POLICY_TUNING", file.c_str(), 1);
+
+  const auto cands = TeamPolicyTuner::candidates<ExecSpace>(num_elems);
+
+  TeamPolicyTuner tuner;
+  tuner.init<ExecSpace>("ut", num_elems, 4, num_elems);
+  REQUIRE (tuner.tuning());
+  REQUIRE (tuner.current()==cands[0]);
+
+  // Each candidate is timed num_trials times, in order
+  int ncalls = 0;
+  while (tuner.tuning()) {
+    const int icand = ncalls / TeamPolicyTuner::num_trials;
+    REQUIRE (tuner.current()==cands[icand]);
+    tuner.start();
+    const bool changed = tuner.stop();
+    ++ncalls;
+    REQUIRE (changed==(ncalls % TeamPolicyTuner::num_trials == 0));
+  }
+  REQUIRE (ncalls==static_cast<int>(cands.size())*TeamPolicyTuner::num_trials);
+  const auto winner = tuner.current();
+  REQUIRE (std::count(cands.begin(), cands.end(), winner)==1);
+
+  // The winner is stored in the cache file...
+  const auto c = TeamPolicyTuner::read_cache(file);
+  REQUIRE (c.size()==1);
+  REQUIRE (c.begin()->first=="ut " + std::to_string(num_elems) + " 4 " +
+                             std::to_string(ExecSpace::concurrency()));
+  REQUIRE (c.begin()->second==winner);
+
+  // ... and reused right away by the next tuner with the same key
+  TeamPolicyTuner tuner2;
+  tuner2.init<ExecSpace>("ut", num_elems, 4, num_elems);
+  REQUIRE (not tuner2.tuning());
+  REQUIRE (tuner2.current()==winner);
+
+  // A different key is tuned from scratch
+  TeamPolicyTuner tuner3;
+  tuner3.init<ExecSpace>("ut", num_elems, 5, num_elems);
+  REQUIRE (tuner3.tuning());
+}
@@ -89,6 +89,12 @@ exchangeList_Type const *sendVerticesList_F = 0, *recvVerticesList_F = 0;
 exchangeList_Type sendVerticesListReversed, recvVerticesListReversed,
     sendCellsListReversed, recvCellsListReversed;
 
+// mask bits the 2D grid was last built with (see gridMasksChanged), and whether
+// the 2D grid has changed since the last extrusion of the 3D grid.
+std::vector<int> gridMasksSnapshot;
+std::vector<double> extrudedLevelsRatio;
+bool is2dGridUpdated = false;
+
 exchange::exchange(int _procID, int const* vec_first, int const* vec_last,
     int fieldDim) :
     procID(_procID), vec(vec_first, vec_last), buffer(
@@ -357,6 +363,13 @@ void velocity_solver_compute_2d_grid(int const* _verticesMask_F, int const* _cel
   verticesMask_F = _verticesMask_F;
   dirichletCellsMask_F = _dirichletCellsMask_F;
 
+  // The FE grid only depends on the masks (the MPAS mesh does not change), so if
+  // none of the mask bits used below changed on any proc, we keep the current grid,
+  // exchange lists and reduced communicator.
+  if (!gridMasksChanged())
+    return;
+  is2dGridUpdated = true;
+
   MPI_Comm_size(comm, &numProcs);
   MPI_Comm_rank(comm, &me);
   std::vector<int> partialOffset(numProcs + 1), globalOffsetTriangles(
@@ -476,9 +489,6 @@ void velocity_solver_compute_2d_grid(int const* _verticesMask_F, int const* _cel
     minTriangleID = (indexToTriangleID[index] < minTriangleID) ? indexToTriangleID[index] : minTriangleID;
   }
 
-  MPI_Allreduce(&maxTriangleID, &maxGlobalTriangleID, 1, MPI_INT, MPI_MAX, comm);
-  MPI_Allreduce(&minTriangleID, &minGlobalTriangleID, 1, MPI_INT, MPI_MIN, comm);
-  globalTriangleStride = maxGlobalTriangleID - minGlobalTriangleID +1;
 
   // Second, we compute the FE edges belonging to the FE triangles owned by this processor.
   // We first compute boundary edges, and then all the other edges.
@@ -588,9 +598,6 @@ void velocity_solver_compute_2d_grid(int const* _verticesMask_F, int const* _cel
     }
   }
 
-  MPI_Allreduce(&maxEdgeID, &maxGlobalEdgeID, 1, MPI_INT, MPI_MAX, comm);
-  MPI_Allreduce(&minEdgeID, &minGlobalEdgeID, 1, MPI_INT, MPI_MIN, comm);
-  globalEdgeStride = maxGlobalEdgeID - minGlobalEdgeID + 1;
 
   // Third, we compute the FE vertices belonging to the FE triangles owned by this processor.
   // We need to make sure that an FE vertex is owned by a proc that owns a FE triangle that contain that vertex
@@ -657,8 +664,16 @@ void velocity_solver_compute_2d_grid(int const* _verticesMask_F, int const* _cel
     minVertexID = (indexToVertexID[index] < minVertexID) ? indexToVertexID[index] : minVertexID;
   }
 
-  MPI_Allreduce(&maxVertexID, &maxGlobalVertexID, 1, MPI_INT, MPI_MAX, comm);
-  MPI_Allreduce(&minVertexID, &minGlobalVertexID, 1, MPI_INT, MPI_MIN, comm);
+  // compute the global strides of triangles, edges and vertices IDs with a single reduction
+  // (min is computed as -max(-x)).
+  int localExtrema[6] = {maxTriangleID, -minTriangleID, maxEdgeID, -minEdgeID, maxVertexID, -minVertexID};
+  int globalExtrema[6];
+  MPI_Allreduce(localExtrema, globalExtrema, 6, MPI_INT, MPI_MAX, comm);
+  maxGlobalTriangleID = globalExtrema[0]; minGlobalTriangleID = -globalExtrema[1];
+  maxGlobalEdgeID = globalExtrema[2]; minGlobalEdgeID = -globalExtrema[3];
+  maxGlobalVertexID = globalExtrema[4]; minGlobalVertexID = -globalExtrema[5];
+  globalTriangleStride = maxGlobalTriangleID - minGlobalTriangleID +1;
+  globalEdgeStride = maxGlobalEdgeID - minGlobalEdgeID + 1;
   globalVertexStride = maxGlobalVertexID - minGlobalVertexID + 1;
 
 
@@ -733,6 +748,14 @@ void velocity_solver_extrude_3d_grid(double const* levelsRatio_F) {
   if (isDomainEmpty)
     return;
 
+  // nothing to do if neither the 2D grid nor the layers changed since the last extrusion
+  // (isDomainEmpty is the same on all procs of reducedComm, so they all skip or none does)
+  std::vector<double> newLevelsRatio(levelsRatio_F, levelsRatio_F + nLayers);
+  if (!is2dGridUpdated && (newLevelsRatio == extrudedLevelsRatio))
+    return;
+  is2dGridUpdated = false;
+  extrudedLevelsRatio = newLevelsRatio;
+
   layersRatio.resize(nLayers);
   // !!Indexing of layers is reversed
   for (int i = 0; i < nLayers; i++)
@@ -975,6 +998,26 @@ void get_prism_velocity_on_FEdges(double * uNormal,
   } //loop over edges
 }
 
+bool gridMasksChanged() {
+  // collect the mask bits that the FE grid depends on
+  std::vector<int> masks;
+  masks.reserve(nVertices_F + nCells_F * (nLayers + 2));
+  for (int i = 0; i < nVertices_F; i++)
+    masks.push_back(verticesMask_F[i] & dynamic_ice_bit_value);
+  for (int i = 0; i < nCells_F; i++)
+    masks.push_back(cellsMask_F[i] & dynamic_ice_bit_value);
+  for (int i = 0; i < nCells_F * (nLayers + 1); i++)
+    masks.push_back(dirichletCellsMask_F[i] != 0);
+
+  int localChanged = (masks != gridMasksSnapshot) ? 1 : 0;
+  int globalChanged;
+  MPI_Allreduce(&localChanged, &globalChanged, 1, MPI_INT, MPI_MAX, comm);
+
+  if (localChanged)
+    gridMasksSnapshot.swap(masks);
+  return globalChanged != 0;
+}
+
 void mapVerticesToCells(const std::vector<double>& velocityOnVertices,
     double* velocityOnCells, int fieldDim, int numLayers, int ordering) {
   int lVertexColumnShift = (ordering == 1) ? 1 : nVertices;
@@ -1016,47 +1059,36 @@ void createReverseExchangeLists(exchangeList_Type& sendListReverse_F,
     const std::vector<int>& newProcIds, const int* indexToID_F, exchangeList_Type const * recvList_F) {
   sendListReverse_F.clear();
   receiveListReverse_F.clear();
-  std::map<int, std::map<int, int> > sendMap, receiveMap;
   int nFEntities = newProcIds.size();
   std::vector<int> procIds(nFEntities);
   getProcIds(procIds, recvList_F);
   int me;
   MPI_Comm_rank(comm, &me);
+
+  // (proc, global ID, local index) triplets; once sorted, the entities exchanged with each proc
+  // are contiguous and ordered by global ID, which is the order both sides of the exchange agree on.
+  typedef std::array<int, 3> ProcIdIndex;
+  std::vector<ProcIdIndex> sendEntities, receiveEntities;
   for (int fEntity = 0; fEntity < nFEntities; fEntity++) {
-    if ((procIds[fEntity] != me) && (newProcIds[fEntity] == me)) {
-      sendMap[procIds[fEntity]].insert(
-        std::make_pair(indexToID_F[fEntity], fEntity));
-    }
+    if ((procIds[fEntity] != me) && (newProcIds[fEntity] == me))
+      sendEntities.push_back({{procIds[fEntity], indexToID_F[fEntity], fEntity}});
+    else if((procIds[fEntity] == me) && (newProcIds[fEntity] != NotAnId) && (newProcIds[fEntity] != me))
+      receiveEntities.push_back({{newProcIds[fEntity], indexToID_F[fEntity], fEntity}});
   }
 
-  for (std::map<int, std::map<int, int> >::const_iterator it = sendMap.begin();
-      it != sendMap.end(); it++) {
-    std::vector<int> sendVec(it->second.size());
-    int i = 0;
-    for (std::map<int, int>::const_iterator iter = it->second.begin();
-        iter != it->second.end(); iter++)
-      sendVec[i++] = iter->second;
-    sendListReverse_F.push_back(
-        exchange(it->first, &sendVec[0], &sendVec[0] + sendVec.size()));
-  }
+  buildExchangeList(sendListReverse_F, sendEntities);
+  buildExchangeList(receiveListReverse_F, receiveEntities);
+}
 
-  for (int fEntity = 0; fEntity < nFEntities; fEntity++) {
-    if((procIds[fEntity] == me) && (newProcIds[fEntity] != NotAnId) && (newProcIds[fEntity] != me)) {
-      receiveMap[newProcIds[fEntity]].insert(
-        std::make_pair(indexToID_F[fEntity], fEntity));
-    }
-  }
+void buildExchangeList(exchangeList_Type& list, std::vector<std::array<int, 3> >& entities) {
+  std::sort(entities.begin(), entities.end());
+  std::vector<int> indices(entities.size());
+  for (size_t i = 0; i < entities.size(); i++)
+    indices[i] = entities[i][2];
 
-  for (std::map<int, std::map<int, int> >::const_iterator it =
-      receiveMap.begin(); it != receiveMap.end(); it++) {
-    std::vector<int> receiveVec(it->second.size());
-    int i = 0;
-    for (std::map<int, int>::const_iterator iter = it->second.begin();
-        iter != it->second.end(); iter++)
-      receiveVec[i++] = iter->second;
-    receiveListReverse_F.push_back(
-        exchange(it->first, &receiveVec[0],
-            &receiveVec[0] + receiveVec.size()));
+  for (size_t first = 0, last; first < entities.size(); first = last) {
+    for (last = first + 1; last < entities.size() && entities[last][0] == entities[first][0]; last++);
+    list.push_back(exchange(entities[first][0], &indices[first], &indices[0] + last));
   }
 }
 
@@ -1468,87 +1500,62 @@ void allToAll(std::vector<int>& field, int const * sendArray,
   }
 }
 
-void allToAll(std::vector<int>& field, exchangeList_Type const * sendList,
-    exchangeList_Type const * recvList, int fieldDim) {
+// All the fieldDim components of the entities exchanged with a proc are packed in
+// a single message (rather than one message per component).
+template<typename T>
+void allToAll(T* field, exchangeList_Type const * sendList,
+    exchangeList_Type const * recvList, int fieldDim, std::vector<T> exchange::* buffer, MPI_Datatype type) {
   int me;
   MPI_Comm_rank(comm, &me);
 
-  for (int iComp = 0; iComp < fieldDim; iComp++) {
-    exchangeList_Type::const_iterator it;
-    for (it = recvList->begin(); it != recvList->end(); ++it) {
-      if (it->procID == me)
-        continue;
-      MPI_Irecv(&(it->buffer[0]), it->buffer.size(), MPI_INT, it->procID,
-          it->procID, comm, &it->reqID);
-    }
-
-    for (it = sendList->begin(); it != sendList->end(); ++it) {
-      if (it->procID == me)
-        continue;
-      for (ID i = 0; i < it->vec.size(); i++)
-        it->buffer[i] = field[fieldDim * it->vec[i] + iComp];
+  exchangeList_Type::const_iterator it;
+  for (it = recvList->begin(); it != recvList->end(); ++it) {
+    if (it->procID == me)
+      continue;
+    std::vector<T>& buf = const_cast<exchange&>(*it).*buffer; // buffers are mutable
+    buf.resize(fieldDim * it->vec.size());
+    MPI_Irecv(buf.data(), buf.size(), type, it->procID, it->procID, comm, &it->reqID);
+  }
 
-      MPI_Isend(&(it->buffer[0]), it->buffer.size(), MPI_INT, it->procID, me,
-          comm, &it->reqID);
+  for (it = sendList->begin(); it != sendList->end(); ++it) {
+    if (it->procID == me)
+      continue;
+    std::vector<T>& buf = const_cast<exchange&>(*it).*buffer; // buffers are mutable
+    buf.resize(fieldDim * it->vec.size());
+    const int* vec = it->vec.data();
+    for (int i = 0; i < int(it->vec.size()); i++) {
+      T const* src = field + fieldDim * vec[i];
+      std::copy(src, src + fieldDim, buf.data() + fieldDim * i);
     }
+    MPI_Isend(buf.data(), buf.size(), type, it->procID, me, comm, &it->reqID);
+  }
 
-    for (it = recvList->begin(); it != recvList->end(); ++it) {
-      if (it->procID == me)
-        continue;
-      MPI_Wait(&it->reqID, MPI_STATUS_IGNORE);
+  for (it = recvList->begin(); it != recvList->end(); ++it) {
+    if (it->procID == me)
+      continue;
+    MPI_Wait(&it->reqID, MPI_STATUS_IGNORE);
 
-      for (int i = 0; i < int(it->vec.size()); i++)
-        field[fieldDim * it->vec[i] + iComp] = it->buffer[i];
-    }
+    std::vector<T> const& buf = (*it).*buffer;
+    const int* vec = it->vec.data();
+    for (int i = 0; i < int(it->vec.size()); i++)
+      std::copy(buf.data() + fieldDim * i, buf.data() + fieldDim * (i + 1), field + fieldDim * vec[i]);
+  }
 
-    for (it = sendList->begin(); it != sendList->end(); ++it) {
-      if (it->procID == me)
-        continue;
-      MPI_Wait(&it->reqID, MPI_STATUS_IGNORE);
-    }
+  for (it = sendList->begin(); it != sendList->end(); ++it) {
+    if (it->procID == me)
+      continue;
+    MPI_Wait(&it->reqID, MPI_STATUS_IGNORE);
   }
 }
 
-void allToAll(double* field, exchangeList_Type const * sendList,
+void allToAll(std::vector<int>& field, exchangeList_Type const * sendList,
     exchangeList_Type const * recvList, int fieldDim) {
-  int me;
-  MPI_Comm_rank(comm, &me);
-
-  for (int iComp = 0; iComp < fieldDim; iComp++) {
-    exchangeList_Type::const_iterator it;
-
-    for (it = recvList->begin(); it != recvList->end(); ++it) {
-      if (it->procID == me)
-        continue;
-      MPI_Irecv(&(it->doubleBuffer[0]), it->doubleBuffer.size(), MPI_DOUBLE,
-          it->procID, it->procID, comm, &it->reqID);
-    }
-
-    for (it = sendList->begin(); it != sendList->end(); ++it) {
-      if (it->procID == me)
-        continue;
-      for (ID i = 0; i < it->vec.size(); i++)
-        it->doubleBuffer[i] = field[fieldDim * it->vec[i] + iComp];
-
-      MPI_Isend(&(it->doubleBuffer[0]), it->doubleBuffer.size(), MPI_DOUBLE,
-          it->procID, me, comm, &it->reqID);
-    }
-
-    for (it = recvList->begin(); it != recvList->end(); ++it) {
-      if (it->procID == me)
-        continue;
-      MPI_Wait(&it->reqID, MPI_STATUS_IGNORE);
-
-      for (int i = 0; i < int(it->vec.size()); i++)
-        field[fieldDim * it->vec[i] + iComp] = it->doubleBuffer[i];
-    }
+  allToAll(field.data(), sendList, recvList, fieldDim, &exchange::buffer, MPI_INT);
+}
 
-    for (it = sendList->begin(); it != sendList->end(); ++it) {
-      if (it->procID == me)
-        continue;
-      MPI_Wait(&it->reqID, MPI_STATUS_IGNORE);
-    }
-  }
+void allToAll(double* field, exchangeList_Type const * sendList,
+    exchangeList_Type const * recvList, int fieldDim) {
+  allToAll(field, sendList, recvList, fieldDim, &exchange::doubleBuffer, MPI_DOUBLE);
 }
 
 int initialize_iceProblem(int nTriangles) {
@@ -21,6 +21,7 @@ distributed with this code, or at http://mpas-dev.github.io/license.html
 #include <limits>
 #include <cmath>
 #include <map>
+#include <array>
 
 #ifndef MPASLI_EXTERNAL_INTERFACE_DISABLE_MANGLING
 #define velocity_solver_init_mpi velocity_solver_init_mpi_
@@ -238,10 +239,16 @@ void get_prism_velocity_on_FEdges(double* uNormal,
 
 int initialize_iceProblem(int nTriangles);
 
+// returns true if, on any proc, the mask bits the FE grid is built from changed since the last call
+bool gridMasksChanged();
+
 void createReverseExchangeLists(exchangeList_Type& sendListReverse_F,
     exchangeList_Type& receiveListReverse_F,
     const std::vector<int>& newProcIds, const int* indexToID_F, exchangeList_Type const * recvList_F);
 
+// sorts the (proc, global ID, local index) triplets, and builds one exchange per proc
+void buildExchangeList(exchangeList_Type& list, std::vector<std::array<int, 3> >& entities);
+
 void mapCellsToVertices(const std::vector<double>& velocityOnCells,
     std::vector<double>& velocityOnVertices, int fieldDim, int numLayers,
     int ordering);